@@ -514,8 +514,8 @@ typedef UIImage * (^ImageLoadBlock)(NSURL *url);
         UIImage *img = nil;
         if ([url.scheme isEqualToString:@"data"]) {
             NSString *absoluteUri = url.absoluteString;
-            std::string dataUri = AdaptiveCards::AdaptiveBase64Util::ExtractDataFromUri(std::string([absoluteUri UTF8String]));
-            std::vector<char> decodedDataUri = AdaptiveCards::AdaptiveBase64Util::Decode(dataUri);
+            const std::string absoluteUriString([absoluteUri UTF8String]);
+            std::vector<char> decodedDataUri = AdaptiveCards::AdaptiveBase64Util::Decode(AdaptiveCards::AdaptiveBase64Util::GetDataFromUri(absoluteUriString));
             NSData *decodedBase64 = [NSData dataWithBytes:decodedDataUri.data() length:decodedDataUri.size()];
             img = [UIImage imageWithData:decodedBase64];
         } else {
@@ -0,0 +1,178 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replaces the whole operator new and delete family, so that every allocation is counted and every allocation is
+// freed by the allocator that made it. This lives in a file of its own so that the compiler never sees a delete
+// expression and the free behind it at once (which GCC's -Wmismatched-new-delete takes for a mismatch).
+namespace
+{
+std::atomic<std::uint64_t> g_allocationCount{0};
+std::atomic<std::uint64_t> g_allocatedBytes{0};
+
+void CountAllocation(std::size_t size) noexcept
+{
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void* Allocate(std::size_t size) noexcept
+{
+    CountAllocation(size);
+    return std::malloc(size != 0 ? size : 1);
+}
+
+void* AllocateAligned(std::size_t size, std::align_val_t alignment) noexcept
+{
+    CountAllocation(size);
+    const auto alignmentValue = static_cast<std::size_t>(alignment);
+    const std::size_t allocationSize = (size != 0) ? size : 1;
+#ifdef _MSC_VER
+    return _aligned_malloc(allocationSize, alignmentValue);
+#else
+    // aligned_alloc wants a size that's a multiple of the alignment
+    return std::aligned_alloc(alignmentValue, (allocationSize + alignmentValue - 1) / alignmentValue * alignmentValue);
+#endif
+}
+
+void FreeAligned(void* allocation) noexcept
+{
+#ifdef _MSC_VER
+    _aligned_free(allocation);
+#else
+    std::free(allocation);
+#endif
+}
+
+void* AllocateOrThrow(std::size_t size)
+{
+    if (void* allocation = Allocate(size))
+    {
+        return allocation;
+    }
+    throw std::bad_alloc();
+}
+
+void* AllocateAlignedOrThrow(std::size_t size, std::align_val_t alignment)
+{
+    if (void* allocation = AllocateAligned(size, alignment))
+    {
+        return allocation;
+    }
+    throw std::bad_alloc();
+}
+} // namespace
+
+std::uint64_t GetAllocationCount()
+{
+    return g_allocationCount.load(std::memory_order_relaxed);
+}
+
+std::uint64_t GetAllocatedBytes()
+{
+    return g_allocatedBytes.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size)
+{
+    return AllocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return AllocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return AllocateAlignedOrThrow(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return AllocateAlignedOrThrow(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateAligned(size, alignment);
+}
+
+void operator delete(void* allocation) noexcept
+{
+    std::free(allocation);
+}
+
+void operator delete[](void* allocation) noexcept
+{
+    std::free(allocation);
+}
+
+void operator delete(void* allocation, std::size_t) noexcept
+{
+    std::free(allocation);
+}
+
+void operator delete[](void* allocation, std::size_t) noexcept
+{
+    std::free(allocation);
+}
+
+void operator delete(void* allocation, const std::nothrow_t&) noexcept
+{
+    std::free(allocation);
+}
+
+void operator delete[](void* allocation, const std::nothrow_t&) noexcept
+{
+    std::free(allocation);
+}
+
+void operator delete(void* allocation, std::align_val_t) noexcept
+{
+    FreeAligned(allocation);
+}
+
+void operator delete[](void* allocation, std::align_val_t) noexcept
+{
+    FreeAligned(allocation);
+}
+
+void operator delete(void* allocation, std::size_t, std::align_val_t) noexcept
+{
+    FreeAligned(allocation);
+}
+
+void operator delete[](void* allocation, std::size_t, std::align_val_t) noexcept
+{
+    FreeAligned(allocation);
+}
+
+void operator delete(void* allocation, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FreeAligned(allocation);
+}
+
+void operator delete[](void* allocation, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FreeAligned(allocation);
+}
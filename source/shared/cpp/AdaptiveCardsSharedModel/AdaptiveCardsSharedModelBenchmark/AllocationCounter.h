@@ -0,0 +1,11 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <cstdint>
+
+// The number of allocations made through operator new, in any of its forms, since the process started
+std::uint64_t GetAllocationCount();
+
+// The number of bytes asked for in those allocations (not counting what the allocator itself adds to each)
+std::uint64_t GetAllocatedBytes();
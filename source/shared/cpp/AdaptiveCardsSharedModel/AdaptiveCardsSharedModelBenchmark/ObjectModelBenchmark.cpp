@@ -0,0 +1,492 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ActionSet.h"
+#include "AdaptiveBase64Util.h"
+#include "AdaptiveCardParseException.h"
+#include "AllocationCounter.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "DateTimePreparser.h"
+#include "FactSet.h"
+#include "HostConfig.h"
+#include "Image.h"
+#include "JsonWriter.h"
+#include "MarkDownParser.h"
+#include "ParseResult.h"
+#include "ParseThreadPool.h"
+#include "ParseTimingAggregator.h"
+#include "ParseUtil.h"
+#include "ResolvedHostConfig.h"
+#include "SharedAdaptiveCard.h"
+#include "SubmitAction.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+
+using namespace AdaptiveCards;
+
+// Each benchmark makes one pass over every card in the sample corpus per iteration, so results stay comparable as
+// long as the corpus doesn't change. Set ADAPTIVECARDS_SAMPLES_DIR in the environment to run over other cards.
+namespace
+{
+struct Corpus
+{
+    std::vector<std::string> cardJson;
+    std::vector<std::shared_ptr<AdaptiveCard>> cards;
+    std::vector<std::string> texts; // every "text" property in the cards, for markdown and date preparsing
+    std::int64_t cardBytes = 0;
+    std::int64_t textBytes = 0;
+};
+
+void CollectTexts(const Json::Value& json, std::vector<std::string>& texts)
+{
+    if (json.isObject())
+    {
+        for (auto it = json.begin(); it != json.end(); ++it)
+        {
+            if (it->isString() && it.name() == "text")
+            {
+                texts.push_back(it->asString());
+            }
+            CollectTexts(*it, texts);
+        }
+    }
+    else if (json.isArray())
+    {
+        for (const auto& item : json)
+        {
+            CollectTexts(item, texts);
+        }
+    }
+}
+
+Corpus LoadCorpus()
+{
+    const char* samplesDirOverride = std::getenv("ADAPTIVECARDS_SAMPLES_DIR");
+    const std::filesystem::path samplesDir(samplesDirOverride != nullptr ? samplesDirOverride : ADAPTIVECARDS_SAMPLES_DIR);
+
+    // visit the files in a fixed order so that runs see the same corpus
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(samplesDir))
+    {
+        const auto relativePath = entry.path().lexically_relative(samplesDir).generic_string();
+        // host configs aren't cards, and templates need data bound before they are
+        if (entry.is_regular_file() && entry.path().extension() == ".json" &&
+            relativePath.rfind("HostConfig/", 0) != 0 && relativePath.rfind("Templates/", 0) != 0)
+        {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    Corpus corpus;
+    for (const auto& file : files)
+    {
+        std::ifstream stream(file, std::ios::binary);
+        std::string json((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+        // some samples are deliberately invalid; only time the ones that parse
+        try
+        {
+            auto card = AdaptiveCard::DeserializeFromString(json, c_sharedModelVersion)->GetAdaptiveCard();
+            CollectTexts(ParseUtil::GetJsonValueFromString(json), corpus.texts);
+            corpus.cardBytes += static_cast<std::int64_t>(json.size());
+            corpus.cards.push_back(std::move(card));
+            corpus.cardJson.push_back(std::move(json));
+        }
+        catch (const std::exception&)
+        {
+        }
+    }
+
+    for (const auto& text : corpus.texts)
+    {
+        corpus.textBytes += static_cast<std::int64_t>(text.size());
+    }
+
+    benchmark::AddCustomContext("samples_dir", samplesDir.generic_string());
+    benchmark::AddCustomContext("sample_cards", std::to_string(corpus.cards.size()));
+    benchmark::AddCustomContext("sample_texts", std::to_string(corpus.texts.size()));
+    return corpus;
+}
+
+const Corpus& GetCorpus()
+{
+    static const Corpus corpus = LoadCorpus();
+    return corpus;
+}
+
+void SetCorpusCounters(benchmark::State& state, std::size_t items, std::int64_t bytes)
+{
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(items));
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+// Reports the allocations made since allocationCountBefore, per item processed
+void SetAllocationCounter(benchmark::State& state, std::uint64_t allocationCountBefore, std::size_t items)
+{
+    const auto allocations = GetAllocationCount() - allocationCountBefore;
+    state.counters["allocs_per_item"] =
+        benchmark::Counter(static_cast<double>(allocations) / static_cast<double>(state.iterations() * items));
+}
+
+// Reports the bytes allocated since allocatedBytesBefore, per item processed
+void SetAllocatedBytesCounter(benchmark::State& state, std::uint64_t allocatedBytesBefore, std::size_t items)
+{
+    const auto bytes = GetAllocatedBytes() - allocatedBytesBefore;
+    state.counters["bytes_per_item"] =
+        benchmark::Counter(static_cast<double>(bytes) / static_cast<double>(state.iterations() * items));
+}
+
+void BM_Parse(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    const auto allocationCountBefore = GetAllocationCount();
+    for (auto _ : state)
+    {
+        for (const auto& json : corpus.cardJson)
+        {
+            benchmark::DoNotOptimize(AdaptiveCard::DeserializeFromString(json, c_sharedModelVersion));
+        }
+    }
+    SetCorpusCounters(state, corpus.cardJson.size(), corpus.cardBytes);
+    SetAllocationCounter(state, allocationCountBefore, corpus.cardJson.size());
+}
+BENCHMARK(BM_Parse);
+
+// The same cards through the streaming parser, which reads each element from the text as it gets to it instead of
+// building the whole card's json first
+void BM_ParseStreaming(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    const auto allocationCountBefore = GetAllocationCount();
+    for (auto _ : state)
+    {
+        for (const auto& json : corpus.cardJson)
+        {
+            benchmark::DoNotOptimize(AdaptiveCard::DeserializeFromStringStreaming(json, c_sharedModelVersion));
+        }
+    }
+    SetCorpusCounters(state, corpus.cardJson.size(), corpus.cardBytes);
+    SetAllocationCounter(state, allocationCountBefore, corpus.cardJson.size());
+}
+BENCHMARK(BM_ParseStreaming);
+
+// The same cards with each parse's elements, actions and warnings placed in an arena of its own, which is freed all at
+// once when the parse result goes
+void BM_ParseWithArena(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    const auto allocationCountBefore = GetAllocationCount();
+    for (auto _ : state)
+    {
+        for (const auto& json : corpus.cardJson)
+        {
+            ParseContext context;
+            context.EnableArenaAllocation();
+            benchmark::DoNotOptimize(AdaptiveCard::DeserializeFromString(json, c_sharedModelVersion, context));
+        }
+    }
+    SetCorpusCounters(state, corpus.cardJson.size(), corpus.cardBytes);
+    SetAllocationCounter(state, allocationCountBefore, corpus.cardJson.size());
+}
+BENCHMARK(BM_ParseWithArena);
+
+// The same as BM_Parse with per element type timing turned on, to keep an eye on what the instrumentation costs
+void BM_ParseWithTimingAggregator(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    const auto aggregator = std::make_shared<ParseTimingAggregator>();
+    for (auto _ : state)
+    {
+        for (const auto& json : corpus.cardJson)
+        {
+            ParseContext context;
+            context.SetInstrumentation(aggregator);
+            benchmark::DoNotOptimize(AdaptiveCard::DeserializeFromString(json, c_sharedModelVersion, context));
+        }
+    }
+    SetCorpusCounters(state, corpus.cardJson.size(), corpus.cardBytes);
+}
+BENCHMARK(BM_ParseWithTimingAggregator);
+
+// A generated form of state.range(0) inputs, each of a type the parser doesn't know with an Input.Text fallback that
+// reuses its id, so every input exercises id collision detection on both the element and its fallback
+void BM_ParseGeneratedInputs(benchmark::State& state)
+{
+    const auto inputCount = static_cast<std::size_t>(state.range(0));
+    std::string json = R"({"type": "AdaptiveCard", "version": "1.2", "body": [)";
+    for (std::size_t i = 0; i < inputCount; ++i)
+    {
+        const auto id = "input" + std::to_string(i);
+        json.append(i == 0 ? "" : ",")
+            .append(R"({"type": "Input.Fancy", "id": ")")
+            .append(id)
+            .append(R"(", "fallback": {"type": "Input.Text", "id": ")")
+            .append(id)
+            .append(R"("}})");
+    }
+    json.append("]}");
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(AdaptiveCard::DeserializeFromString(json, c_sharedModelVersion));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(inputCount));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(json.size()));
+}
+BENCHMARK(BM_ParseGeneratedInputs)->Arg(1000)->Arg(10000);
+
+// The corpus as one batch on a pool of state.range(0) threads, made once up front as a service would. Items per second
+// against the thread count is the throughput curve; on a machine with fewer cores than threads it levels off.
+void BM_DeserializeFromStrings(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    ParseThreadPool pool(static_cast<unsigned int>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(AdaptiveCard::DeserializeFromStrings(corpus.cardJson, c_sharedModelVersion, nullptr, nullptr, pool));
+    }
+    SetCorpusCounters(state, corpus.cardJson.size(), corpus.cardBytes);
+}
+BENCHMARK(BM_DeserializeFromStrings)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+// What an element costs in memory as the parsers make it, before any of its properties are set: the bytes and
+// allocations it takes, shared_ptr control block included
+template <typename Element>
+void BM_ConstructElement(benchmark::State& state)
+{
+    const auto allocationCountBefore = GetAllocationCount();
+    const auto allocatedBytesBefore = GetAllocatedBytes();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::make_shared<Element>());
+    }
+    state.SetItemsProcessed(state.iterations());
+    SetAllocationCounter(state, allocationCountBefore, 1);
+    SetAllocatedBytesCounter(state, allocatedBytesBefore, 1);
+}
+BENCHMARK_TEMPLATE(BM_ConstructElement, TextBlock);
+BENCHMARK_TEMPLATE(BM_ConstructElement, Image);
+BENCHMARK_TEMPLATE(BM_ConstructElement, FactSet);
+BENCHMARK_TEMPLATE(BM_ConstructElement, Container);
+BENCHMARK_TEMPLATE(BM_ConstructElement, Column);
+BENCHMARK_TEMPLATE(BM_ConstructElement, ColumnSet);
+BENCHMARK_TEMPLATE(BM_ConstructElement, ActionSet);
+BENCHMARK_TEMPLATE(BM_ConstructElement, TextInput);
+BENCHMARK_TEMPLATE(BM_ConstructElement, SubmitAction);
+
+void BM_Serialize(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    const auto allocationCountBefore = GetAllocationCount();
+    for (auto _ : state)
+    {
+        for (const auto& card : corpus.cards)
+        {
+            benchmark::DoNotOptimize(card->Serialize());
+        }
+    }
+    SetCorpusCounters(state, corpus.cards.size(), corpus.cardBytes);
+    SetAllocationCounter(state, allocationCountBefore, corpus.cards.size());
+}
+BENCHMARK(BM_Serialize);
+
+// Serialize, writing into the same buffer every time, as a host writing cards out to a stream might
+void BM_SerializeToWriter(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    std::string output;
+    const auto allocationCountBefore = GetAllocationCount();
+    for (auto _ : state)
+    {
+        for (const auto& card : corpus.cards)
+        {
+            output.clear();
+            JsonWriter writer(output);
+            card->Serialize(writer);
+            benchmark::DoNotOptimize(output.data());
+        }
+    }
+    SetCorpusCounters(state, corpus.cards.size(), corpus.cardBytes);
+    SetAllocationCounter(state, allocationCountBefore, corpus.cards.size());
+}
+BENCHMARK(BM_SerializeToWriter);
+
+// What Serialize used to do, building the card's json and then writing it out, for comparison
+void BM_SerializeThroughJsonValue(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    const auto allocationCountBefore = GetAllocationCount();
+    for (auto _ : state)
+    {
+        for (const auto& card : corpus.cards)
+        {
+            benchmark::DoNotOptimize(ParseUtil::JsonToString(card->SerializeToJsonValue()));
+        }
+    }
+    SetCorpusCounters(state, corpus.cards.size(), corpus.cardBytes);
+    SetAllocationCounter(state, allocationCountBefore, corpus.cards.size());
+}
+BENCHMARK(BM_SerializeThroughJsonValue);
+
+void BM_MarkDown(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    for (auto _ : state)
+    {
+        for (const auto& text : corpus.texts)
+        {
+            MarkDownParser parser(text);
+            benchmark::DoNotOptimize(parser.TransformToHtml());
+        }
+    }
+    SetCorpusCounters(state, corpus.texts.size(), corpus.textBytes);
+}
+BENCHMARK(BM_MarkDown);
+
+void BM_DateTimePreparse(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    for (auto _ : state)
+    {
+        for (const auto& text : corpus.texts)
+        {
+            DateTimePreparser preparser(text);
+            benchmark::DoNotOptimize(preparser.GetTextTokens().data());
+        }
+    }
+    SetCorpusCounters(state, corpus.texts.size(), corpus.textBytes);
+}
+BENCHMARK(BM_DateTimePreparse);
+
+// What a renderer asks about each text run (font size, weight and color) for every style, color and subtlety, straight
+// from a HostConfig and from its ResolvedHostConfig
+template <typename Config>
+void TextRunLookups(benchmark::State& state, const Config& config)
+{
+    std::size_t lookups = 0;
+    for (auto _ : state)
+    {
+        for (int style = 0; style <= static_cast<int>(ContainerStyle::Accent); ++style)
+        {
+            for (int color = 0; color <= static_cast<int>(ForegroundColor::Attention); ++color)
+            {
+                for (const bool isSubtle : {false, true})
+                {
+                    benchmark::DoNotOptimize(config.GetFontSize(FontType::Default, TextSize::Medium));
+                    benchmark::DoNotOptimize(config.GetFontWeight(FontType::Monospace, TextWeight::Bolder));
+                    benchmark::DoNotOptimize(
+                        config.GetForegroundColor(static_cast<ContainerStyle>(style), static_cast<ForegroundColor>(color), isSubtle));
+                    ++lookups;
+                }
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(lookups));
+}
+
+void BM_HostConfigTextRunLookups(benchmark::State& state)
+{
+    TextRunLookups(state, HostConfig::DeserializeFromString("{}"));
+}
+BENCHMARK(BM_HostConfigTextRunLookups);
+
+void BM_ResolvedHostConfigTextRunLookups(benchmark::State& state)
+{
+    TextRunLookups(state, *HostConfig::DeserializeFromString("{}").GetResolved());
+}
+BENCHMARK(BM_ResolvedHostConfigTextRunLookups);
+
+void BM_GetResourceInformation(benchmark::State& state)
+{
+    const auto& corpus = GetCorpus();
+    for (auto _ : state)
+    {
+        for (const auto& card : corpus.cards)
+        {
+            benchmark::DoNotOptimize(card->GetResourceInformation());
+        }
+    }
+    SetCorpusCounters(state, corpus.cards.size(), corpus.cardBytes);
+}
+BENCHMARK(BM_GetResourceInformation);
+
+// The same bytes every run, as random as image data
+std::vector<char> GenerateImageBytes(std::size_t size)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+    std::vector<char> bytes(size);
+    for (auto& byte : bytes)
+    {
+        byte = static_cast<char>(byteDistribution(generator));
+    }
+    return bytes;
+}
+
+// Decodes an inline image's data URI as the renderers do, into a buffer that's reused from image to image
+void BM_Base64Decode(benchmark::State& state)
+{
+    const std::string dataUri =
+        "data:image/png;base64," + AdaptiveBase64Util::Encode(GenerateImageBytes(static_cast<std::size_t>(state.range(0))));
+    std::vector<char> decoded;
+    for (auto _ : state)
+    {
+        const auto encoded = AdaptiveBase64Util::GetDataFromUri(dataUri);
+        decoded.resize(AdaptiveBase64Util::GetMaxDecodedLength(encoded));
+        benchmark::DoNotOptimize(AdaptiveBase64Util::DecodeTo(encoded, decoded.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(dataUri.size()));
+}
+BENCHMARK(BM_Base64Decode)->Arg(256 << 10)->Arg(768 << 10);
+
+// The same data URI through the lenient decoder, which is what all decoding went through before DecodeTo and is still
+// what Decode falls back on
+void BM_Base64DecodeLenient(benchmark::State& state)
+{
+    const std::string dataUri =
+        "data:image/png;base64," + AdaptiveBase64Util::Encode(GenerateImageBytes(static_cast<std::size_t>(state.range(0))));
+    std::vector<char> decoded;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(AdaptiveBase64Util::Decode(AdaptiveBase64Util::GetDataFromUri(dataUri), &decoded));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(dataUri.size()));
+}
+BENCHMARK(BM_Base64DecodeLenient)->Arg(256 << 10)->Arg(768 << 10);
+
+void BM_Base64Encode(benchmark::State& state)
+{
+    const std::vector<char> bytes = GenerateImageBytes(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(AdaptiveBase64Util::Encode(bytes));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes.size()));
+}
+BENCHMARK(BM_Base64Encode)->Arg(256 << 10)->Arg(768 << 10);
+} // namespace
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    // load the corpus up front so that its description makes it into the context of the results
+    GetCorpus();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
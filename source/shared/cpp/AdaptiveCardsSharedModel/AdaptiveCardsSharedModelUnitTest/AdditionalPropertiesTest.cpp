@@ -143,6 +143,40 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual("{\"unknown\":\"testing unknown\"}\n"s, ParseUtil::JsonToString(value));
         }
 
+        TEST_METHOD(KnownPropertiesArePerElementTypeTest)
+        {
+            // "wrap" is known to TextBlock but not to Image, and both types share their known property tables across
+            // every instance -- make sure neither table leaks into the other.
+            std::string testJsonString =
+            "{\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.0\",\
+                \"body\": [\
+                    {\
+                        \"type\": \"TextBlock\",\
+                        \"text\": \"first\",\
+                        \"wrap\": true\
+                    },\
+                    {\
+                        \"type\": \"Image\",\
+                        \"url\": \"http://adaptivecards.io/content/cats/1.png\",\
+                        \"wrap\": true\
+                    },\
+                    {\
+                        \"type\": \"TextBlock\",\
+                        \"text\": \"second\",\
+                        \"wrap\": true,\
+                        \"unknown\": \"testing unknown\"\
+                    }\
+                ]\
+            }";
+            std::shared_ptr<ParseResult> parseResult = AdaptiveCard::DeserializeFromString(testJsonString, "1.0");
+            const auto& body = parseResult->GetAdaptiveCard()->GetBody();
+            Assert::AreEqual("null\n"s, ParseUtil::JsonToString(body.at(0)->GetAdditionalProperties()));
+            Assert::AreEqual("{\"wrap\":true}\n"s, ParseUtil::JsonToString(body.at(1)->GetAdditionalProperties()));
+            Assert::AreEqual("{\"unknown\":\"testing unknown\"}\n"s, ParseUtil::JsonToString(body.at(2)->GetAdditionalProperties()));
+        }
+
         TEST_METHOD(CanGetAdditionalProperitesTest_Action)
         {
             std::string testJsonString =
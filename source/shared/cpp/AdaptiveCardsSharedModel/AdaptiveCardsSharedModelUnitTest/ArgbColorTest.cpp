@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ArgbColor.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(ArgbColorTest)
+    {
+    public:
+        TEST_METHOD(TryParseTest)
+        {
+            Assert::AreEqual(0xFFFF00AAU, ArgbColor::TryParse("#FF00aa")->GetArgb());
+            Assert::AreEqual(0x80FF00AAU, ArgbColor::TryParse("#80FF00aa")->GetArgb());
+            Assert::AreEqual(0x00000000U, ArgbColor::TryParse("#00000000")->GetArgb());
+            Assert::AreEqual(0xFFABCDEFU, ArgbColor::TryParse("#AbCdEf")->GetArgb());
+
+            for (const char* invalid : {"", "#", "#GG00aa", "FF00aa", "#FF00a", "#FF00aa0", "#FF00aa000", "red", "#12 456", "#1234567g"})
+            {
+                Assert::IsFalse(ArgbColor::TryParse(invalid).has_value());
+                Assert::AreEqual(0U, ArgbColor::FromString(invalid).GetArgb());
+            }
+        }
+
+        TEST_METHOD(ChannelsTest)
+        {
+            constexpr ArgbColor color(0x80FF00AA);
+            Assert::AreEqual<int>(0x80, color.GetAlpha());
+            Assert::AreEqual<int>(0xFF, color.GetRed());
+            Assert::AreEqual<int>(0x00, color.GetGreen());
+            Assert::AreEqual<int>(0xAA, color.GetBlue());
+            Assert::AreEqual(0U, ArgbColor().GetArgb());
+        }
+
+        TEST_METHOD(ToStringTest)
+        {
+            Assert::AreEqual(std::string("#80FF00AA"), ArgbColor(0x80FF00AA).ToString());
+            Assert::AreEqual(std::string("#00000000"), ArgbColor().ToString());
+            Assert::AreEqual(std::string("#FFABCDEF"), ArgbColor::FromString("#abcdef").ToString());
+            Assert::IsTrue(ArgbColor::FromString("#abcdef") == ArgbColor::FromString("#FFABCDEF"));
+            Assert::IsTrue(ArgbColor::FromString("#abcdef") != ArgbColor::FromString("#00ABCDEF"));
+        }
+    };
+}
@@ -70,6 +70,69 @@ namespace AdaptiveCardsSharedModelUnitTest
                 AdaptiveBase64Util::Decode(uri);
             }
 
+            // nor on text that is mostly padding
+            for (const char* text : {"=", "==", "i-====", "AAAA====", "A=A="})
+            {
+                AdaptiveBase64Util::Decode(text);
+            }
+        }
+
+        TEST_METHOD(DecodeToTest)
+        {
+            const std::pair<const char*, const char*> validCases[] = {
+                {"", ""},
+                {"Zg==", "f"},
+                {"Zg", "f"},
+                {"Zm8=", "fo"},
+                {"Zm8", "fo"},
+                {"Zm9v", "foo"},
+                {"Zm9vYmFy", "foobar"},
+                {"Zm9vYmE", "fooba"},
+                {"+/+/", "\xFB\xFF\xBF"},
+            };
+
+            for (const auto& testCase : validCases)
+            {
+                std::vector<char> buffer(AdaptiveBase64Util::GetMaxDecodedLength(testCase.first));
+                const auto decodedLength = AdaptiveBase64Util::DecodeTo(testCase.first, buffer.data());
+                Assert::IsTrue(decodedLength.has_value());
+                Assert::AreEqual(std::string(testCase.second), std::string(buffer.data(), *decodedLength));
+            }
+
+            for (const char* invalid : {"Z", "Zm9vY", "Zg=", "Zg===", "Z===", "=Zg=", "Zm9v Yg==", "Zm9v\nYg==", "Zm9v-_==", "Zm9v\x80g=="})
+            {
+                std::vector<char> buffer(AdaptiveBase64Util::GetMaxDecodedLength(invalid));
+                Assert::IsFalse(AdaptiveBase64Util::DecodeTo(invalid, buffer.data()).has_value());
+            }
+        }
+
+        TEST_METHOD(RoundTripTest)
+        {
+            std::vector<char> data;
+            for (int i = 0; i < 300; ++i)
+            {
+                const std::string encoded = AdaptiveBase64Util::Encode(data);
+                Assert::AreEqual<size_t>((data.size() + 2) / 3 * 4, encoded.size());
+
+                std::vector<char> decoded(AdaptiveBase64Util::GetMaxDecodedLength(encoded));
+                const auto decodedLength = AdaptiveBase64Util::DecodeTo(encoded, decoded.data());
+                Assert::IsTrue(decodedLength.has_value());
+                decoded.resize(*decodedLength);
+                Assert::IsTrue(data == decoded);
+                Assert::IsTrue(data == AdaptiveBase64Util::Decode(encoded));
+
+                data.push_back(static_cast<char>(i * 37));
+            }
+        }
+
+        TEST_METHOD(GetDataFromUriTest)
+        {
+            const std::string uri = "data:image/png;base64,Zm9vYmFy";
+            const auto data = AdaptiveBase64Util::GetDataFromUri(uri);
+            Assert::AreEqual(std::string("Zm9vYmFy"), std::string(data));
+            Assert::IsTrue(data.data() == uri.data() + uri.size() - data.size());
+            Assert::AreEqual(std::string(data), AdaptiveBase64Util::ExtractDataFromUri(uri));
+            Assert::AreEqual(std::string("Zm9v"), std::string(AdaptiveBase64Util::GetDataFromUri("Zm9v")));
         }
     };
 }
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "CardCache.h"
+#include "TextBlock.h"
+#include <mutex>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    std::string MakeCachedCard(const std::string& text)
+    {
+        return "{\"type\":\"AdaptiveCard\",\"version\":\"1.2\",\"body\":[{\"type\":\"TextBlock\",\"text\":\"" + text + "\"}]}";
+    }
+
+    std::string GetCachedCardText(const std::shared_ptr<const CachedParseResult>& result)
+    {
+        return std::static_pointer_cast<TextBlock>(result->GetAdaptiveCard()->GetBody().front())->GetText();
+    }
+
+    TEST_CLASS(CardCacheTest)
+    {
+    public:
+        TEST_METHOD(RepeatedCardIsServedFromCache)
+        {
+            CardCache cache;
+            const auto first = cache.DeserializeFromString(MakeCachedCard("hello"), "1.2");
+            const auto second = cache.DeserializeFromString(MakeCachedCard("hello"), "1.2");
+            Assert::IsTrue(first == second);
+            Assert::AreEqual("hello"s, GetCachedCardText(second));
+            Assert::AreEqual<std::uint64_t>(1, cache.GetHitCount());
+            Assert::AreEqual<std::uint64_t>(1, cache.GetMissCount());
+            Assert::AreEqual<std::size_t>(1, cache.GetSize());
+        }
+
+        TEST_METHOD(CachedResultsAreReadOnly)
+        {
+            static_assert(std::is_same_v<decltype(std::declval<CachedParseResult>().GetAdaptiveCard()), std::shared_ptr<const AdaptiveCard>>);
+            static_assert(std::is_same_v<decltype(std::declval<CachedParseResult>().GetWarnings()),
+                                         std::vector<std::shared_ptr<const AdaptiveCardParseWarning>>>);
+
+            CardCache cache;
+            const std::string card = R"({"type":"AdaptiveCard","version":"1.2","body":[{"type":"FactSet","facts":[]}]})";
+            const auto first = cache.DeserializeFromString(card, "1.2");
+            const auto second = cache.DeserializeFromString(card, "1.2");
+            Assert::IsTrue(first->GetAdaptiveCard() == second->GetAdaptiveCard());
+            Assert::AreEqual<std::size_t>(1, second->GetWarnings().size());
+            Assert::IsTrue(first->GetWarnings().front() == second->GetWarnings().front());
+        }
+
+        TEST_METHOD(KeyIncludesVersionAndRegistrations)
+        {
+            CardCache cache;
+            const auto card = MakeCachedCard("hello");
+            const auto defaults = cache.DeserializeFromString(card, "1.2");
+            Assert::IsFalse(defaults == cache.DeserializeFromString(card, "1.1"));
+            Assert::IsFalse(defaults == cache.DeserializeFromString(card, "1.2", std::make_shared<ElementParserRegistration>()));
+            Assert::IsFalse(defaults == cache.DeserializeFromString(card, "1.2", nullptr, std::make_shared<ActionParserRegistration>()));
+            Assert::IsFalse(defaults == cache.DeserializeFromString(MakeCachedCard("goodbye"), "1.2"));
+            Assert::AreEqual<std::uint64_t>(0, cache.GetHitCount());
+            Assert::AreEqual<std::uint64_t>(5, cache.GetMissCount());
+        }
+
+        TEST_METHOD(LeastRecentlyUsedCardIsEvicted)
+        {
+            CardCache cache(2);
+            const auto first = cache.DeserializeFromString(MakeCachedCard("first"), "1.2");
+            const auto second = cache.DeserializeFromString(MakeCachedCard("second"), "1.2");
+
+            // touch the first card so that the second becomes the least recently used
+            Assert::IsTrue(first == cache.DeserializeFromString(MakeCachedCard("first"), "1.2"));
+            cache.DeserializeFromString(MakeCachedCard("third"), "1.2");
+            Assert::AreEqual<std::size_t>(2, cache.GetSize());
+
+            Assert::IsTrue(first == cache.DeserializeFromString(MakeCachedCard("first"), "1.2"));
+            Assert::IsFalse(second == cache.DeserializeFromString(MakeCachedCard("second"), "1.2"));
+            Assert::AreEqual<std::uint64_t>(2, cache.GetHitCount());
+            Assert::AreEqual<std::uint64_t>(4, cache.GetMissCount());
+
+            cache.Clear();
+            Assert::AreEqual<std::size_t>(0, cache.GetSize());
+        }
+
+        TEST_METHOD(ParseFailuresAreNotCached)
+        {
+            CardCache cache;
+            for (int i = 0; i < 2; ++i)
+            {
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { cache.DeserializeFromString("{ this is not json", "1.2"); });
+            }
+            Assert::AreEqual<std::uint64_t>(2, cache.GetMissCount());
+            Assert::AreEqual<std::size_t>(0, cache.GetSize());
+        }
+
+        TEST_METHOD(CacheIsSharedAcrossThreads)
+        {
+            constexpr unsigned int threadCount = 8;
+            constexpr unsigned int cardCount = 16;
+            constexpr unsigned int iterationsPerThread = 200;
+
+            CardCache cache(cardCount);
+            std::mutex failuresLock;
+            std::vector<std::string> failures;
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < threadCount; ++i)
+            {
+                threads.emplace_back([&, i]() {
+                    for (unsigned int j = 0; j < iterationsPerThread; ++j)
+                    {
+                        const auto text = std::to_string((i + j) % cardCount);
+                        const auto result = cache.DeserializeFromString(MakeCachedCard(text), "1.2");
+                        if (GetCachedCardText(result) != text)
+                        {
+                            std::lock_guard<std::mutex> lock(failuresLock);
+                            failures.push_back(text);
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            Assert::IsTrue(failures.empty(), L"A cached lookup returned the wrong card");
+            Assert::AreEqual<std::uint64_t>(threadCount * iterationsPerThread, cache.GetHitCount() + cache.GetMissCount());
+            Assert::AreEqual<std::size_t>(cardCount, cache.GetSize());
+        }
+    };
+}
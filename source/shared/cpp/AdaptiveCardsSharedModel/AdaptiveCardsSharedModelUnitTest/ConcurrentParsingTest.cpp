@@ -0,0 +1,294 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "Container.h"
+#include "InternalId.h"
+#include "ParseContext.h"
+#include "ParseThreadPool.h"
+#include "ParseUtil.h"
+#include "TextBlock.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Fallback content reuses its parent's id, which is only legal because ID collision detection can tell the two
+    // apart by their internal IDs.
+    const std::string c_fallbackCard = R"card({
+        "type": "AdaptiveCard",
+        "version": "1.2",
+        "body": [
+            {
+                "type": "Container",
+                "id": "outer",
+                "items": [
+                    {
+                        "type": "Graph",
+                        "id": "telephoneNumber",
+                        "fallback": {
+                            "type": "Input.Text",
+                            "id": "telephoneNumber"
+                        }
+                    },
+                    {
+                        "type": "TextBlock",
+                        "id": "label",
+                        "text": "label"
+                    }
+                ]
+            }
+        ]
+    })card";
+
+    const std::string c_collidingCard = R"card({
+        "type": "AdaptiveCard",
+        "version": "1.2",
+        "body": [
+            {
+                "type": "TextBlock",
+                "id": "duplicate",
+                "text": "first"
+            },
+            {
+                "type": "Container",
+                "items": [
+                    {
+                        "type": "TextBlock",
+                        "id": "duplicate",
+                        "text": "second"
+                    }
+                ]
+            }
+        ]
+    })card";
+
+    constexpr unsigned int c_threadCount = 8;
+    constexpr unsigned int c_iterationsPerThread = 250;
+
+    void CollectInternalIds(const std::vector<std::shared_ptr<BaseCardElement>>& elements, std::vector<unsigned int>& ids)
+    {
+        for (const auto& element : elements)
+        {
+            ids.push_back(element->GetInternalId().Hash());
+            if (const auto container = std::dynamic_pointer_cast<Container>(element))
+            {
+                CollectInternalIds(container->GetItems(), ids);
+            }
+        }
+    }
+
+    std::string MakeTextBlockCard(const std::string& type, const std::string& text)
+    {
+        return "{\"type\":\"AdaptiveCard\",\"version\":\"1.2\",\"body\":[{\"type\":\"" + type + "\",\"text\":\"" + text + "\"}]}";
+    }
+
+    TEST_CLASS(ConcurrentParsingTest)
+    {
+    public:
+        TEST_METHOD(InternalIdsAreUniqueAcrossThreads)
+        {
+            std::mutex idsLock;
+            std::vector<unsigned int> allIds;
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < c_threadCount; ++i)
+            {
+                threads.emplace_back([&]() {
+                    std::vector<unsigned int> ids;
+                    for (unsigned int j = 0; j < c_iterationsPerThread; ++j)
+                    {
+                        const InternalId id = InternalId::Next();
+                        if (InternalId::Current() != id)
+                        {
+                            ids.push_back(InternalId::Invalid);
+                        }
+                        ids.push_back(id.Hash());
+                    }
+                    std::lock_guard<std::mutex> lock(idsLock);
+                    allIds.insert(allIds.end(), ids.begin(), ids.end());
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            std::unordered_set<unsigned int> uniqueIds(allIds.begin(), allIds.end());
+            Assert::AreEqual(allIds.size(), uniqueIds.size(), L"InternalId::Next() handed out a duplicate id");
+            Assert::IsTrue(uniqueIds.find(InternalId::Invalid) == uniqueIds.end(), L"InternalId::Current() didn't match Next()");
+        }
+
+        TEST_METHOD(ConcurrentParsesDetectCollisionsIndependently)
+        {
+            std::atomic<unsigned int> fallbackSuccesses{0};
+            std::atomic<unsigned int> collisionsDetected{0};
+            std::mutex idsLock;
+            std::vector<unsigned int> allIds;
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < c_threadCount; ++i)
+            {
+                threads.emplace_back([&]() {
+                    std::vector<unsigned int> ids;
+                    for (unsigned int j = 0; j < c_iterationsPerThread; ++j)
+                    {
+                        try
+                        {
+                            const auto parseResult = AdaptiveCard::DeserializeFromString(c_fallbackCard, "1.2");
+                            CollectInternalIds(parseResult->GetAdaptiveCard()->GetBody(), ids);
+                            ++fallbackSuccesses;
+                        }
+                        catch (const AdaptiveCardParseException&)
+                        {
+                        }
+
+                        try
+                        {
+                            AdaptiveCard::DeserializeFromString(c_collidingCard, "1.2");
+                        }
+                        catch (const AdaptiveCardParseException& e)
+                        {
+                            if (e.GetStatusCode() == ErrorStatusCode::IdCollision)
+                            {
+                                ++collisionsDetected;
+                            }
+                        }
+                    }
+                    std::lock_guard<std::mutex> lock(idsLock);
+                    allIds.insert(allIds.end(), ids.begin(), ids.end());
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            const unsigned int expected = c_threadCount * c_iterationsPerThread;
+            Assert::AreEqual(expected, fallbackSuccesses.load(), L"Legal fallback id reuse was reported as a collision");
+            Assert::AreEqual(expected, collisionsDetected.load(), L"A genuine id collision went undetected");
+
+            std::unordered_set<unsigned int> uniqueIds(allIds.begin(), allIds.end());
+            Assert::AreEqual(allIds.size(), uniqueIds.size(), L"Elements from different parses shared an internal id");
+        }
+
+        TEST_METHOD(BatchResultsAreInInputOrder)
+        {
+            std::vector<std::string> cards;
+            for (unsigned int i = 0; i < c_iterationsPerThread; ++i)
+            {
+                cards.push_back(i % 2 ? c_fallbackCard : MakeTextBlockCard("TextBlock", std::to_string(i)));
+            }
+
+            ParseThreadPool pool(c_threadCount);
+            const auto results = AdaptiveCard::DeserializeFromStrings(cards, "1.2", nullptr, nullptr, pool);
+            Assert::AreEqual(cards.size(), results.size());
+            for (unsigned int i = 0; i < results.size(); ++i)
+            {
+                Assert::IsFalse(static_cast<bool>(results[i].error));
+                const auto& first = results[i].parseResult->GetAdaptiveCard()->GetBody().front();
+                if (i % 2)
+                {
+                    Assert::IsTrue(CardElementType::Container == first->GetElementType());
+                }
+                else
+                {
+                    Assert::AreEqual(std::to_string(i), std::static_pointer_cast<TextBlock>(first)->GetText());
+                }
+            }
+        }
+
+        TEST_METHOD(BatchSharesRegistrations)
+        {
+            class CountingParser : public BaseCardElementParser
+            {
+            public:
+                std::atomic<unsigned int> calls{0};
+
+                std::shared_ptr<BaseCardElement> Deserialize(ParseContext& /*context*/, const Json::Value& value) override
+                {
+                    ++calls;
+                    auto textBlock = std::make_shared<TextBlock>();
+                    textBlock->SetText(value["text"].asString());
+                    return textBlock;
+                }
+                std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& value) override
+                {
+                    return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
+                }
+            };
+
+            auto parser = std::make_shared<CountingParser>();
+            auto elementRegistration = std::make_shared<ElementParserRegistration>();
+            elementRegistration->AddParser("Counted", parser);
+
+            const std::vector<std::string> cards(c_iterationsPerThread, MakeTextBlockCard("Counted", "counted"));
+            ParseThreadPool pool(c_threadCount);
+            const auto results = AdaptiveCard::DeserializeFromStrings(cards, "1.2", elementRegistration, nullptr, pool);
+            Assert::AreEqual(c_iterationsPerThread, parser->calls.load());
+            for (const auto& result : results)
+            {
+                const auto& first = result.parseResult->GetAdaptiveCard()->GetBody().front();
+                Assert::AreEqual("counted"s, std::static_pointer_cast<TextBlock>(first)->GetText());
+            }
+        }
+
+        TEST_METHOD(BatchReportsEachFailure)
+        {
+            std::vector<std::string> cards(c_iterationsPerThread, c_fallbackCard);
+            cards[c_iterationsPerThread / 2] = "{ this is not json";
+            cards[c_iterationsPerThread / 4] = c_collidingCard;
+
+            const auto getStatusCode = [](const std::exception_ptr& error) {
+                try
+                {
+                    std::rethrow_exception(error);
+                }
+                catch (const AdaptiveCardParseException& e)
+                {
+                    return e.GetStatusCode();
+                }
+                return ErrorStatusCode::CustomError;
+            };
+
+            // the default pool, and the other cards in the batch still come back parsed
+            const auto results = AdaptiveCard::DeserializeFromStrings(cards, "1.2");
+            Assert::AreEqual(cards.size(), results.size());
+            for (unsigned int i = 0; i < results.size(); ++i)
+            {
+                if (i == c_iterationsPerThread / 2 || i == c_iterationsPerThread / 4)
+                {
+                    Assert::IsNull(results[i].parseResult.get());
+                    Assert::IsTrue(static_cast<bool>(results[i].error));
+                }
+                else
+                {
+                    Assert::IsFalse(static_cast<bool>(results[i].error));
+                    Assert::IsTrue(CardElementType::Container == results[i].parseResult->GetAdaptiveCard()->GetBody().front()->GetElementType());
+                }
+            }
+            Assert::IsTrue(ErrorStatusCode::InvalidJson == getStatusCode(results[c_iterationsPerThread / 2].error));
+            Assert::IsTrue(ErrorStatusCode::IdCollision == getStatusCode(results[c_iterationsPerThread / 4].error));
+        }
+
+        TEST_METHOD(PoolRunsEveryJobOncePerBatch)
+        {
+            ParseThreadPool pool(c_threadCount);
+            Assert::AreEqual(c_threadCount, pool.GetThreadCount());
+            Assert::AreEqual(1U, ParseThreadPool(1).GetThreadCount());
+
+            // the same threads serve one batch after another, including empty ones
+            for (std::size_t jobCount : {0, 1, 7, 1000, 3})
+            {
+                std::vector<std::atomic<unsigned int>> runs(jobCount);
+                pool.ParallelFor(jobCount, [&](std::size_t i) { ++runs[i]; });
+                for (const auto& count : runs)
+                {
+                    Assert::AreEqual(1U, count.load());
+                }
+            }
+        }
+    };
+}
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "stdafx.h"
 #include "TextBlock.h"
+#include "Fact.h"
 
 #define WIN32_LEAN_AND_MEAN 1
 #include <Windows.h>
@@ -424,5 +425,87 @@ namespace AdaptiveCardsSharedModelUnitTest
             blck.SetText(testString);
             Assert::AreEqual<std::string>("{{DATE(1994-02-29T06:08:00Z)}}", blck.GetText());
         }
+        TEST_METHOD(TimeWithStyleIsLeftAsTextTest)
+        {
+            DateTimePreparser preparser("{{TIME(2017-10-27T22:23:00Z, SHORT)}}");
+            const auto& tokens = preparser.GetTextTokens();
+            Assert::AreEqual<size_t>(1, tokens.size());
+            Assert::AreEqual<std::string>("{{TIME(2017-10-27T22:23:00Z, SHORT)}}", tokens[0]->GetText());
+            Assert::IsTrue(tokens[0]->GetFormat() == DateTimePreparsedTokenFormat::RegularString);
+            Assert::IsFalse(preparser.HasDateTokens());
+        }
+        TEST_METHOD(DateAfterExtraOpeningBraceTest)
+        {
+            SKIP_TEST_OUTSIDE_PACIFIC_TIME();
+            DateTimePreparser preparser("{{{DATE(2017-10-27T22:23:00Z)}}{{DATE(2017-10-27T22:23:00Z)}");
+            const auto& tokens = preparser.GetTextTokens();
+            Assert::AreEqual<size_t>(3, tokens.size());
+            Assert::AreEqual<std::string>("{", tokens[0]->GetText());
+            Assert::AreEqual<std::string>("{{DATE(2017-10-27T22:23:00Z)}}", tokens[1]->GetText());
+            Assert::IsTrue(tokens[1]->GetDay() == 27 && tokens[1]->GetMonth() == 9 && tokens[1]->GetYear() == 2017);
+            Assert::IsTrue(tokens[1]->GetFormat() == DateTimePreparsedTokenFormat::DateCompact);
+            Assert::AreEqual<std::string>("{{DATE(2017-10-27T22:23:00Z)}", tokens[2]->GetText());
+        }
+        TEST_METHOD(TimeInDaylightSavingTimeTest)
+        {
+            SKIP_TEST_OUTSIDE_PACIFIC_TIME();
+            // PDT, PDT just after midnight, and PST
+            DateTimePreparser preparser("{{TIME(2017-07-04T19:30:00Z)}} {{TIME(2017-10-28T07:05:00Z)}} {{TIME(2017-12-28T08:05:00Z)}}");
+            const auto& tokens = preparser.GetTextTokens();
+            Assert::AreEqual<size_t>(5, tokens.size());
+            Assert::AreEqual<std::string>("12:30 PM", tokens[0]->GetText());
+            Assert::AreEqual<std::string>("12:05 AM", tokens[2]->GetText());
+            Assert::AreEqual<std::string>("12:05 AM", tokens[4]->GetText());
+
+            // converting again after dropping the cached offsets gives the same answer
+            DateTimePreparser::ResetTimeZoneCache();
+            DateTimePreparser again("{{TIME(2017-07-04T19:30:00Z)}}");
+            Assert::AreEqual<std::string>("12:30 PM", again.GetTextTokens().front()->GetText());
+        }
+        TEST_METHOD(TimeZoneChangeTest)
+        {
+            // the way a host that changes zones sees it: the C runtime's zone changes under the cached offsets
+            char* originalZone = nullptr;
+            size_t originalZoneLength = 0;
+            _dupenv_s(&originalZone, &originalZoneLength, "TZ");
+            const std::string restoreZone = originalZone ? originalZone : "";
+            free(originalZone);
+
+            TextBlock blck;
+            blck.SetText("{{DATE(2017-10-27T02:00:00Z)}}");
+
+            _putenv_s("TZ", "UTC0");
+            Assert::AreEqual<std::string>("07:30 PM", DateTimePreparser("{{TIME(2017-07-04T19:30:00Z)}}").GetTextTokens().front()->GetText());
+            Assert::AreEqual(27, blck.GetTextForDateParsing().GetTextTokens().front()->GetDay());
+
+            _putenv_s("TZ", "EST5");
+            Assert::AreEqual<std::string>("02:30 PM", DateTimePreparser("{{TIME(2017-07-04T19:30:00Z)}}").GetTextTokens().front()->GetText());
+            Assert::AreEqual(26, blck.GetTextForDateParsing().GetTextTokens().front()->GetDay());
+
+            _putenv_s("TZ", restoreZone.c_str());
+        }
+        TEST_METHOD(PreparsedTokensAreKeptUntilTextChangesTest)
+        {
+            TextBlock blck;
+            blck.SetText("Arriving {{DATE(2017-10-27T22:23:00Z, SHORT)}}");
+            const DateTimePreparser& first = blck.GetTextForDateParsing();
+            Assert::IsTrue(&first == &blck.GetTextForDateParsing());
+            Assert::IsTrue(&first.GetTextTokens() == &blck.GetTextForDateParsing().GetTextTokens());
+            Assert::AreEqual<size_t>(2, first.GetTextTokens().size());
+
+            blck.SetText("Departing");
+            const auto& tokens = blck.GetTextForDateParsing().GetTextTokens();
+            Assert::AreEqual<size_t>(1, tokens.size());
+            Assert::AreEqual<std::string>("Departing", tokens[0]->GetText());
+
+            Fact fact("{{DATE(2017-10-27T22:23:00Z)}}", "value");
+            Assert::IsTrue(&fact.GetTitleForDateParsing() == &fact.GetTitleForDateParsing());
+            Assert::IsTrue(fact.GetTitleForDateParsing().HasDateTokens());
+            Assert::IsFalse(fact.GetValueForDateParsing().HasDateTokens());
+            fact.SetTitle("title");
+            Assert::IsFalse(fact.GetTitleForDateParsing().HasDateTokens());
+            fact.SetValue("{{DATE(2017-10-27T22:23:00Z)}}");
+            Assert::IsTrue(fact.GetValueForDateParsing().HasDateTokens());
+        }
     };
 }
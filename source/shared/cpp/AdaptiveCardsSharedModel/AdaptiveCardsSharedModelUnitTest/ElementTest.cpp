@@ -67,7 +67,7 @@ namespace AdaptiveCardsSharedModelUnitTest
 
             Assert::IsTrue(choiceSet->GetIsMultiSelect());
             Assert::IsTrue(ChoiceSetStyle::Filtered == choiceSet->GetChoiceSetStyle());
-            Assert::AreEqual(context.warnings.size(), 1ui64);
+            Assert::AreEqual(context.warnings.size(), 1ULL);
             Assert::IsTrue(context.warnings[0]->GetStatusCode() == WarningStatusCode::InvalidValue);
             Assert::AreEqual(context.warnings[0]->GetReason(), "Input.ChoiceSet does not support filtering with multiselect"s);
         }
@@ -12,6 +12,8 @@ using namespace std::string_literals;
 #define ENUM_TO_FROM_STRING_TEST(ENUMNAME, VALIDVALUE, VALIDSTRING) \
         Assert::AreEqual(ENUMNAME##ToString(VALIDVALUE), VALIDSTRING); \
         Assert::IsTrue(ENUMNAME##FromString(VALIDSTRING) == VALIDVALUE); \
+        Assert::IsTrue(ENUMNAME##TryFromString(VALIDSTRING) == VALIDVALUE); \
+        Assert::IsFalse(ENUMNAME##TryFromString("This is invalid.").has_value()); \
 
 #define ENUM_TEST(ENUMNAME, VALIDVALUE, VALIDSTRING) \
     ENUM_TEST_START(ENUMNAME)                                           \
@@ -58,5 +60,57 @@ namespace AdaptiveCardsSharedModelUnitTest
         ENUM_TEST_WITH_REVERSE_MAP(TextSize, TextSize::Large, "Large"s, {{"Normal", TextSize::Default}});
         ENUM_TEST_WITH_REVERSE_MAP(TextWeight, TextWeight::Bolder, "Bolder"s, {{"Normal", TextWeight::Default}});
         ENUM_TEST(VerticalContentAlignment, VerticalContentAlignment::Center, "Center"s);
+
+        TEST_METHOD(EnumLookupIsCaseInsensitiveTest)
+        {
+            Assert::IsTrue(TextWeight::Bolder == TextWeightFromString("bOLDER"));
+            Assert::IsTrue(TextWeight::Default == TextWeightFromString("NORMAL"));
+            Assert::IsTrue(ActionType::OpenUrl == ActionTypeTryFromString("action.openurl"));
+            Assert::IsFalse(ActionTypeTryFromString("Action.OpenUr").has_value());
+            Assert::IsFalse(ActionTypeTryFromString("Action.OpenUrlX").has_value());
+            Assert::IsFalse(ActionTypeTryFromString("").has_value());
+        }
+
+        TEST_METHOD(CaseFoldingIsAsciiOnlyTest)
+        {
+            Assert::AreEqual('A', AsciiToUpper('a'));
+            Assert::AreEqual('z', AsciiToLower('Z'));
+            Assert::AreEqual('@', AsciiToLower('@'));
+            Assert::AreEqual('[', AsciiToUpper('['));
+            Assert::AreEqual(L'Q', AsciiToUpper(L'q'));
+
+            Assert::IsTrue(CaseInsensitiveEqualTo{}("Action.OpenUrl"s, "ACTION.openurl"s));
+            Assert::IsFalse(CaseInsensitiveEqualTo{}("Action.OpenUrl"s, "Action.OpenUr"s));
+            Assert::IsTrue(CaseInsensitiveEqualTo{}(std::wstring_view(L"TextBlock"), std::wstring_view(L"textblock")));
+            Assert::AreEqual(CaseInsensitiveHash{}("Input.ChoiceSet"s), CaseInsensitiveHash{}("input.choiceset"s));
+
+            // bytes outside ASCII, like the halves of UTF-8 "\xC3\xA9" and "\xC3\x89" (e and E acute), aren't folded
+            Assert::IsFalse(CaseInsensitiveEqualTo{}("caf\xC3\xA9"s, "CAF\xC3\x89"s));
+            Assert::IsTrue(CaseInsensitiveEqualTo{}("caf\xC3\xA9"s, "CAF\xC3\xA9"s));
+        }
+
+        TEST_METHOD(EveryEnumValueRoundTripsTest)
+        {
+            // schema keys are by far the largest mapping, so walk all of them (a few, like ActionOrientation, have
+            // no string at all)
+            unsigned int mapped = 0;
+            for (auto i = 0; i <= static_cast<int>(AdaptiveCardSchemaKey::Wrap); ++i)
+            {
+                const auto key = static_cast<AdaptiveCardSchemaKey>(i);
+                std::string name;
+                try
+                {
+                    name = AdaptiveCardSchemaKeyToString(key);
+                }
+                catch (const std::out_of_range&)
+                {
+                    continue;
+                }
+                // compare names rather than keys, since more than one key can share a name
+                Assert::AreEqual(name, AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKeyFromString(name)));
+                ++mapped;
+            }
+            Assert::IsTrue(mapped > 100);
+        }
     };
 }
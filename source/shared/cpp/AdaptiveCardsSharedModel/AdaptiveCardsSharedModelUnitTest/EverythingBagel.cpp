@@ -19,6 +19,7 @@
 #include "ImageSet.h"
 #include "NumberInput.h"
 #include "OpenUrlAction.h"
+#include "ParseContext.h"
 #include "RichTextBlock.h"
 #include "ShowCardAction.h"
 #include "SubmitAction.h"
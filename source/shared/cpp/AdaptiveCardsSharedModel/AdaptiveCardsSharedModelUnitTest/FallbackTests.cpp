@@ -595,6 +595,14 @@ namespace AdaptiveCardsSharedModelUnitTest
             featureRegistration.AddFeature("foobar", "99");
             Assert::IsTrue(textBlock->MeetsRequirements(featureRegistration));
             Assert::IsTrue(textBlockNoRequires->MeetsRequirements(featureRegistration));
+
+            // feature names match whatever their case
+            featureRegistration.RemoveFeature("FOOBAR");
+            Assert::IsFalse(textBlock->MeetsRequirements(featureRegistration));
+            featureRegistration.AddFeature("FooBar", "2");
+            Assert::IsTrue(textBlock->MeetsRequirements(featureRegistration));
+            Assert::AreEqual("2"s, featureRegistration.GetFeatureVersion("fOObAR"));
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { featureRegistration.AddFeature("foobar", "3"); });
         }
 
         TEST_METHOD(NestedFallbacksSerialization)
@@ -774,5 +782,92 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto column = (std::static_pointer_cast<ColumnSet>(parseResult->GetAdaptiveCard()->GetBody().at(0)))->GetColumns().at(0);
             Assert::IsTrue(FallbackType::None == column->GetFallbackType());
         }
+
+        TEST_METHOD(DuplicateIdBesideFallbackWithUnrelatedId)
+        {
+            // the container and its item collide; the fallback's id has nothing to do with it
+            std::string cardStr = R"card({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                {
+                    "type": "Container",
+                    "id": "b",
+                    "items": [
+                    {
+                        "type": "TextBlock",
+                        "text": "not okay",
+                        "id": "b"
+                    }],
+                    "fallback": {
+                        "type": "Graph",
+                        "id": "c"
+                    }
+                }]
+            })card";
+
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { AdaptiveCard::DeserializeFromString(cardStr, "1.2"); });
+        }
+
+        TEST_METHOD(DuplicateSiblingIdsBesideFallbackWithSameId)
+        {
+            // the fallback may share an id with one of the container's items, but the items may not share it
+            std::string cardStr = R"card({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                {
+                    "type": "Container",
+                    "items": [
+                    {
+                        "type": "Graph",
+                        "id": "b"
+                    },
+                    {
+                        "type": "TextBlock",
+                        "text": "not okay",
+                        "id": "b"
+                    }],
+                    "fallback": {
+                        "type": "TextBlock",
+                        "text": "okay",
+                        "id": "b"
+                    }
+                }]
+            })card";
+
+            try
+            {
+                AdaptiveCard::DeserializeFromString(cardStr, "1.2");
+                Assert::IsTrue(false, L"Deserializing should throw an exception");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::IsTrue(ErrorStatusCode::IdCollision == e.GetStatusCode(), L"ErrorStatusCode incorrect");
+                Assert::AreEqual("Collision detected for id 'b'", e.GetReason().c_str(), L"GetReason incorrect");
+            }
+
+            // with just one of the items it's fine
+            std::string okayCard = R"card({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                {
+                    "type": "Container",
+                    "items": [
+                    {
+                        "type": "TextBlock",
+                        "text": "okay",
+                        "id": "b"
+                    }],
+                    "fallback": {
+                        "type": "TextBlock",
+                        "text": "okay",
+                        "id": "b"
+                    }
+                }]
+            })card";
+            Assert::IsTrue(AdaptiveCard::DeserializeFromString(okayCard, "1.2")->GetAdaptiveCard() != nullptr);
+        }
     };
 }
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "stdafx.h"
 #include "HostConfig.h"
+#include "ResolvedHostConfig.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
@@ -21,13 +22,13 @@ namespace AdaptiveCardsSharedModelUnitTest
 
             const auto hostConfig = HostConfig::DeserializeFromString(tableConfigJson);
             const auto tableConfig = hostConfig.GetTable();
-            Assert::AreEqual(11ui32, tableConfig.cellSpacing);
+            Assert::AreEqual(11U, tableConfig.cellSpacing);
         }
 
         TEST_METHOD(DeserializeDefaultTableTest)
         {
             const auto hostConfig = HostConfig::DeserializeFromString("{}");
-            Assert::AreEqual(8ui32, hostConfig.GetTable().cellSpacing);
+            Assert::AreEqual(8U, hostConfig.GetTable().cellSpacing);
         }
 
         TEST_METHOD(DeserializeColumnHeaderTest)
@@ -67,5 +68,169 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::IsTrue(expectedConfig.fontType == actualConfig.fontType);
         }
 
+        TEST_METHOD(ResolvedMatchesHostConfigTest)
+        {
+            const std::string hostConfigJson = R"({
+                "fontFamily": "Deprecated Family",
+                "fontSizes": { "small": 9, "large": 30 },
+                "fontTypes": {
+                    "default": { "fontSizes": { "medium": 15 }, "fontWeights": { "bolder": 700 } },
+                    "monospace": { "fontFamily": "Courier", "fontSizes": { "small": 8 } }
+                },
+                "containerStyles": {
+                    "emphasis": {
+                        "backgroundColor": "#F0F0F0",
+                        "foregroundColors": {
+                            "accent": { "default": "#0063B1", "subtle": "#880063B1" }
+                        }
+                    },
+                    "good": { "backgroundColor": "not a color" }
+                }
+            })";
+
+            const auto hostConfig = HostConfig::DeserializeFromString(hostConfigJson);
+            const auto resolved = hostConfig.GetResolved();
+            Assert::IsTrue(resolved == hostConfig.GetResolved());
+
+            // every lookup gives what HostConfig gives
+            for (const auto fontType : {FontType::Default, FontType::Monospace})
+            {
+                Assert::AreEqual(hostConfig.GetFontFamily(fontType), std::string(resolved->GetFontFamily(fontType)));
+                for (const auto size : {TextSize::Small, TextSize::Default, TextSize::Medium, TextSize::Large, TextSize::ExtraLarge})
+                {
+                    Assert::AreEqual(hostConfig.GetFontSize(fontType, size), resolved->GetFontSize(fontType, size));
+                }
+                for (const auto weight : {TextWeight::Lighter, TextWeight::Default, TextWeight::Bolder})
+                {
+                    Assert::AreEqual(hostConfig.GetFontWeight(fontType, weight), resolved->GetFontWeight(fontType, weight));
+                }
+            }
+            for (int styleIndex = static_cast<int>(ContainerStyle::None); styleIndex <= static_cast<int>(ContainerStyle::Accent); ++styleIndex)
+            {
+                const auto style = static_cast<ContainerStyle>(styleIndex);
+                Assert::AreEqual(hostConfig.GetBackgroundColor(style), std::string(resolved->GetBackgroundColor(style)));
+                Assert::AreEqual(hostConfig.GetBorderColor(style), std::string(resolved->GetBorderColor(style)));
+                Assert::AreEqual(hostConfig.GetBorderThickness(style), resolved->GetBorderThickness(style));
+                for (int colorIndex = static_cast<int>(ForegroundColor::Default); colorIndex <= static_cast<int>(ForegroundColor::Attention); ++colorIndex)
+                {
+                    const auto color = static_cast<ForegroundColor>(colorIndex);
+                    for (const bool isSubtle : {false, true})
+                    {
+                        Assert::AreEqual(hostConfig.GetForegroundColor(style, color, isSubtle), std::string(resolved->GetForegroundColor(style, color, isSubtle)));
+                        Assert::AreEqual(hostConfig.GetHighlightColor(style, color, isSubtle), std::string(resolved->GetHighlightColor(style, color, isSubtle)));
+                    }
+                }
+            }
+
+            // the fallbacks: type, then default type, then the deprecated sizes, then the built-in default
+            Assert::AreEqual(8U, resolved->GetFontSize(FontType::Monospace, TextSize::Small));
+            Assert::AreEqual(15U, resolved->GetFontSize(FontType::Monospace, TextSize::Medium));
+            Assert::AreEqual(30U, resolved->GetFontSize(FontType::Monospace, TextSize::Large));
+            Assert::AreEqual(20U, resolved->GetFontSize(FontType::Monospace, TextSize::ExtraLarge));
+            Assert::AreEqual(700U, resolved->GetFontWeight(FontType::Monospace, TextWeight::Bolder));
+            Assert::AreEqual(std::string("Deprecated Family"), std::string(resolved->GetFontFamily(FontType::Default)));
+            Assert::AreEqual(std::string("Courier"), std::string(resolved->GetFontFamily(FontType::Monospace)));
+
+            Assert::AreEqual(0xFFF0F0F0U, resolved->GetBackgroundColorArgb(ContainerStyle::Emphasis).GetArgb());
+            Assert::AreEqual(0xFFFFFFFFU, resolved->GetBackgroundColorArgb(ContainerStyle::None).GetArgb());
+            Assert::AreEqual(0U, resolved->GetBackgroundColorArgb(ContainerStyle::Good).GetArgb());
+            Assert::AreEqual(0xFF0063B1U, resolved->GetForegroundColorArgb(ContainerStyle::Emphasis, ForegroundColor::Accent, false).GetArgb());
+            Assert::AreEqual(0x880063B1U, resolved->GetForegroundColorArgb(ContainerStyle::Emphasis, ForegroundColor::Accent, true).GetArgb());
+            Assert::AreEqual(0xFFFFFF00U, resolved->GetHighlightColorArgb(ContainerStyle::Emphasis, ForegroundColor::Accent, false).GetArgb());
+            Assert::AreEqual(0xFF7F7F7FU, resolved->GetBorderColorArgb(ContainerStyle::Default).GetArgb());
+        }
+
+        TEST_METHOD(ColorsDecodedWithTheirStringsTest)
+        {
+            // the built-in defaults, including the one written as #RRGGBB
+            const HostConfig defaultConfig;
+            Assert::AreEqual(0xFF0000FFU, defaultConfig.GetForegroundColorArgb(ContainerStyle::Default, ForegroundColor::Accent, false).GetArgb());
+            Assert::AreEqual(0xB20000FFU, defaultConfig.GetForegroundColorArgb(ContainerStyle::Default, ForegroundColor::Accent, true).GetArgb());
+            Assert::AreEqual(0xFFFFFFE0U, defaultConfig.GetHighlightColorArgb(ContainerStyle::Good, ForegroundColor::Dark, true).GetArgb());
+            Assert::AreEqual(0xFFF7E9E9U, defaultConfig.GetBackgroundColorArgb(ContainerStyle::Attention).GetArgb());
+            Assert::AreEqual(0x08000000U, defaultConfig.GetBorderColorArgb(ContainerStyle::Emphasis).GetArgb());
+
+            // parsed colors, and defaults for the ones the json leaves out
+            const auto hostConfig = HostConfig::DeserializeFromString(R"({
+                "containerStyles": {
+                    "default": {
+                        "backgroundColor": "#80112233",
+                        "borderColor": "red",
+                        "foregroundColors": {
+                            "good": { "subtle": "#445566", "highlightColors": { "default": "#01020304" } }
+                        }
+                    }
+                }
+            })");
+            Assert::AreEqual(0x80112233U, hostConfig.GetBackgroundColorArgb(ContainerStyle::Default).GetArgb());
+            Assert::AreEqual(0U, hostConfig.GetBorderColorArgb(ContainerStyle::Default).GetArgb());
+            Assert::AreEqual(0xFF008000U, hostConfig.GetForegroundColorArgb(ContainerStyle::Default, ForegroundColor::Good, false).GetArgb());
+            Assert::AreEqual(0xFF445566U, hostConfig.GetForegroundColorArgb(ContainerStyle::Default, ForegroundColor::Good, true).GetArgb());
+            Assert::AreEqual(0x01020304U, hostConfig.GetHighlightColorArgb(ContainerStyle::Default, ForegroundColor::Good, false).GetArgb());
+            Assert::AreEqual(0xFFFFFFE0U, hostConfig.GetHighlightColorArgb(ContainerStyle::Default, ForegroundColor::Good, true).GetArgb());
+
+            for (int styleIndex = static_cast<int>(ContainerStyle::None); styleIndex <= static_cast<int>(ContainerStyle::Accent); ++styleIndex)
+            {
+                const auto style = static_cast<ContainerStyle>(styleIndex);
+                Assert::IsTrue(ArgbColor::FromString(hostConfig.GetBackgroundColor(style)) == hostConfig.GetBackgroundColorArgb(style));
+                Assert::IsTrue(ArgbColor::FromString(hostConfig.GetBorderColor(style)) == hostConfig.GetBorderColorArgb(style));
+                for (int colorIndex = static_cast<int>(ForegroundColor::Default); colorIndex <= static_cast<int>(ForegroundColor::Attention); ++colorIndex)
+                {
+                    const auto color = static_cast<ForegroundColor>(colorIndex);
+                    for (const bool isSubtle : {false, true})
+                    {
+                        Assert::IsTrue(ArgbColor::FromString(hostConfig.GetForegroundColor(style, color, isSubtle)) ==
+                                       hostConfig.GetForegroundColorArgb(style, color, isSubtle));
+                        Assert::IsTrue(ArgbColor::FromString(hostConfig.GetHighlightColor(style, color, isSubtle)) ==
+                                       hostConfig.GetHighlightColorArgb(style, color, isSubtle));
+                        Assert::IsTrue(hostConfig.GetResolved()->GetForegroundColorArgb(style, color, isSubtle) ==
+                                       hostConfig.GetForegroundColorArgb(style, color, isSubtle));
+                    }
+                }
+            }
+        }
+
+        TEST_METHOD(ColorsFollowSetContainerStylesTest)
+        {
+            auto hostConfig = HostConfig::DeserializeFromString("{}");
+            Assert::AreEqual(0xFF000000U, hostConfig.GetForegroundColorArgb(ContainerStyle::Default, ForegroundColor::Default, false).GetArgb());
+
+            auto containerStyles = hostConfig.GetContainerStyles();
+            containerStyles.defaultPalette.foregroundColors.defaultColor.defaultColor = "#FF112233";
+            containerStyles.emphasisPalette.backgroundColor = "#445566";
+            containerStyles.emphasisPalette.foregroundColors.accent.highlightColors.subtleColor = "not a color";
+            hostConfig.SetContainerStyles(containerStyles);
+
+            const auto resolved = hostConfig.GetResolved();
+            Assert::AreEqual(0xFF112233U, hostConfig.GetForegroundColorArgb(ContainerStyle::Default, ForegroundColor::Default, false).GetArgb());
+            Assert::AreEqual(0xFF112233U, resolved->GetForegroundColorArgb(ContainerStyle::Default, ForegroundColor::Default, false).GetArgb());
+            Assert::AreEqual(0xFF445566U, hostConfig.GetBackgroundColorArgb(ContainerStyle::Emphasis).GetArgb());
+            Assert::AreEqual(0xFF445566U, resolved->GetBackgroundColorArgb(ContainerStyle::Emphasis).GetArgb());
+            Assert::AreEqual(0U, hostConfig.GetHighlightColorArgb(ContainerStyle::Emphasis, ForegroundColor::Accent, true).GetArgb());
+            Assert::AreEqual(0U, resolved->GetHighlightColorArgb(ContainerStyle::Emphasis, ForegroundColor::Accent, true).GetArgb());
+        }
+
+        TEST_METHOD(ResolvedFollowsChangesTest)
+        {
+            auto hostConfig = HostConfig::DeserializeFromString("{}");
+            const auto before = hostConfig.GetResolved();
+
+            auto fontTypes = hostConfig.GetFontTypes();
+            fontTypes.defaultFontType.fontFamily = "Segoe UI";
+            hostConfig.SetFontTypes(fontTypes);
+
+            // the one already handed out is a snapshot; asking again sees the change
+            Assert::AreEqual(std::string(), std::string(before->GetFontFamily(FontType::Default)));
+            Assert::AreEqual(std::string("Segoe UI"), std::string(hostConfig.GetResolved()->GetFontFamily(FontType::Default)));
+            Assert::AreEqual(std::string("Segoe UI"), std::string(HostConfig(hostConfig).GetResolved()->GetFontFamily(FontType::Default)));
+
+            // colors are decoded from the strings as they are now
+            auto containerStyles = hostConfig.GetContainerStyles();
+            containerStyles.defaultPalette.foregroundColors.defaultColor.defaultColor = "#FF112233";
+            hostConfig.SetContainerStyles(containerStyles);
+            const auto resolved = hostConfig.GetResolved();
+            Assert::AreEqual(std::string("#FF112233"), std::string(resolved->GetForegroundColor(ContainerStyle::Default, ForegroundColor::Default, false)));
+            Assert::AreEqual(0xFF112233U, resolved->GetForegroundColorArgb(ContainerStyle::Default, ForegroundColor::Default, false).GetArgb());
+        }
     };
 }
@@ -31,6 +31,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string(""), backgroundColor);
+            Assert::AreEqual(0x00000000U, image->GetBackgroundColorArgb().GetArgb());
         }
         TEST_METHOD(AARRGGBBTest)
         {
@@ -52,6 +53,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#ABF65314"), backgroundColor);
+            Assert::AreEqual(0xABF65314U, image->GetBackgroundColorArgb().GetArgb());
         }
 
         TEST_METHOD(RRGGBBTest)
@@ -74,6 +76,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#FF00A1F1"), backgroundColor);
+            Assert::AreEqual(0xFF00A1F1U, image->GetBackgroundColorArgb().GetArgb());
         }
 
         TEST_METHOD(LowerCaseCharactersTest)
@@ -96,6 +99,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#ffa65314"), backgroundColor);
+            Assert::AreEqual(0xFFA65314U, image->GetBackgroundColorArgb().GetArgb());
         }
 
         TEST_METHOD(InvalidLengthTest)
@@ -118,6 +122,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#00000000"), backgroundColor);
+            Assert::AreEqual(0U, image->GetBackgroundColorArgb().GetArgb());
         }
 
         TEST_METHOD(InvalidCharacterTest)
@@ -140,6 +145,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#00000000"), backgroundColor);
+            Assert::AreEqual(0U, image->GetBackgroundColorArgb().GetArgb());
         }
 
         TEST_METHOD(InvalidFormatTest)
@@ -162,6 +168,18 @@ namespace AdaptiveCardsSharedModelUnitTest
             std::shared_ptr<Image> image = std::static_pointer_cast<Image>(elem);
             std::string backgroundColor = image->GetBackgroundColor();
             Assert::AreEqual(std::string("#00000000"), backgroundColor);
+            Assert::AreEqual(0U, image->GetBackgroundColorArgb().GetArgb());
+        }
+
+        TEST_METHOD(SetBackgroundColorTest)
+        {
+            Image image;
+            image.SetBackgroundColor("#A1B2C3");
+            Assert::AreEqual(0xFFA1B2C3U, image.GetBackgroundColorArgb().GetArgb());
+            image.SetBackgroundColor(std::string("#10A1B2C3"));
+            Assert::AreEqual(0x10A1B2C3U, image.GetBackgroundColorArgb().GetArgb());
+            image.SetBackgroundColor("");
+            Assert::AreEqual(0U, image.GetBackgroundColorArgb().GetArgb());
         }
 
     };
@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "Container.h"
+#include "JsonWriter.h"
+#include "ParseUtil.h"
+#include "TextBlock.h"
+#include <filesystem>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Serialize() writes without building any json; it has to come out just as the json SerializeToJsonValue builds
+    template <typename T>
+    void AssertSerializeMatchesJsonValue(const T& serializable, const wchar_t* message = nullptr)
+    {
+        Assert::AreEqual(ParseUtil::JsonToString(serializable.SerializeToJsonValue()), serializable.Serialize(), message);
+    }
+
+    TEST_CLASS(JsonWriterTest)
+    {
+    public:
+        TEST_METHOD(WritesValuesAsJsonToString)
+        {
+            Json::Value value = ParseUtil::GetJsonValueFromString(
+                R"({ "b": [ 1, -2, 3.5, true, null, "\"é😀\n" ], "a": { "": {}, "c": [] }, "A": 1e300 })");
+
+            std::string output;
+            JsonWriter writer(output);
+            writer.BeginArray();
+            writer.WriteValue(value);
+            writer.BeginObject();
+            writer.WriteMemberName("x");
+            writer.WriteValue(value["b"]);
+            writer.WriteMemberName("y");
+            writer.BeginArray();
+            writer.EndArray();
+            writer.EndObject();
+            writer.WriteValue(Json::Value());
+            writer.EndArray();
+
+            const std::string valueText = ParseUtil::JsonToString(value);
+            const std::string itemsText = ParseUtil::JsonToString(value["b"]);
+            Assert::AreEqual("[" + valueText.substr(0, valueText.size() - 1) + ",{\"x\":" +
+                                 itemsText.substr(0, itemsText.size() - 1) + ",\"y\":[]},null]"s,
+                             output);
+        }
+
+        TEST_METHOD(SamplesMatchSerializeToJsonValue)
+        {
+            const auto samplesDirectory = std::filesystem::path(__FILE__).parent_path() / ".." / ".." / ".." / ".." / ".." / "samples";
+
+            unsigned int sampleCount = 0;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(samplesDirectory))
+            {
+                if (entry.path().extension() != ".json")
+                {
+                    continue;
+                }
+
+                std::ifstream file(entry.path(), std::ios::binary);
+                const std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+                std::shared_ptr<ParseResult> parseResult;
+                try
+                {
+                    parseResult = AdaptiveCard::DeserializeFromString(json, "1.5");
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                    // host configs, templates and the like
+                    continue;
+                }
+
+                const auto card = parseResult->GetAdaptiveCard();
+                AssertSerializeMatchesJsonValue(*card, entry.path().wstring().c_str());
+                for (const auto& element : card->GetBody())
+                {
+                    AssertSerializeMatchesJsonValue(*element, entry.path().wstring().c_str());
+                }
+                for (const auto& action : card->GetActions())
+                {
+                    AssertSerializeMatchesJsonValue(*action, entry.path().wstring().c_str());
+                }
+                ++sampleCount;
+            }
+
+            // make sure the samples were found at all
+            Assert::IsTrue(sampleCount > 100);
+        }
+
+        TEST_METHOD(KnownPropertiesOverrideAdditionalProperties)
+        {
+            // names that sort around, and share prefixes with, the ones the element sets
+            const Json::Value additionalProperties = ParseUtil::GetJsonValueFromString(
+                R"({ "": 0, "Text": 1, "te": 2, "text": 3, "textx": 4, "type": 5, "typ": 6, "wrap": 7, "é": 8, "~": [ 9 ] })");
+
+            TextBlock textBlock;
+            textBlock.SetAdditionalProperties(additionalProperties);
+            textBlock.SetText("known");
+            textBlock.SetWrap(true);
+            AssertSerializeMatchesJsonValue(textBlock);
+            Assert::AreEqual(
+                R"({"":0,"Text":1,"te":2,"text":"known","textx":4,"typ":6,"type":"TextBlock","wrap":true,"~":[9],"\u00e9":8})"
+                "\n"s,
+                textBlock.Serialize());
+
+            // and the same again, one level down, and for a whole card
+            auto container = std::make_shared<Container>();
+            container->SetAdditionalProperties(additionalProperties);
+            container->GetItems().push_back(std::make_shared<TextBlock>(textBlock));
+            AssertSerializeMatchesJsonValue(*container);
+
+            AdaptiveCard card;
+            card.SetAdditionalProperties(additionalProperties);
+            card.GetBody().push_back(container);
+            AssertSerializeMatchesJsonValue(card);
+        }
+
+        TEST_METHOD(AdditionalPropertiesThatArentAnObject)
+        {
+            TextBlock textBlock;
+            textBlock.SetAdditionalProperties(Json::Value(Json::nullValue));
+            AssertSerializeMatchesJsonValue(textBlock);
+
+            // jsoncpp can't add members to these, and the writer has to fail just as it does
+            textBlock.SetAdditionalProperties(Json::Value("not an object"));
+            Assert::ExpectException<Json::LogicError>([&]() { textBlock.SerializeToJsonValue(); });
+            Assert::ExpectException<Json::LogicError>([&]() { textBlock.Serialize(); });
+        }
+
+        TEST_METHOD(ElementsThatOnlyOverrideSerializeToJsonValue)
+        {
+            // like the custom elements that platforms wrap, which say what they are only through SerializeToJsonValue
+            class CustomElement : public BaseCardElement
+            {
+            public:
+                Json::Value SerializeToJsonValue() const override
+                {
+                    Json::Value root(Json::objectValue);
+                    root["type"] = "Custom";
+                    root["payload"] = Json::Value(Json::arrayValue);
+                    root["payload"].append(42);
+                    return root;
+                }
+            };
+
+            auto container = std::make_shared<Container>();
+            container->GetItems().push_back(std::make_shared<CustomElement>());
+            AssertSerializeMatchesJsonValue(*container);
+            Assert::AreEqual(R"({"items":[{"payload":[42],"type":"Custom"}],"type":"Container"})"
+                             "\n"s,
+                             container->Serialize());
+        }
+    };
+}
@@ -0,0 +1,163 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "MarkDownCache.h"
+#include "MarkDownParser.h"
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // The cache is process wide; turn it on for one test and leave it off for the rest
+    struct ScopedMarkDownCache
+    {
+        explicit ScopedMarkDownCache(std::size_t byteBudget)
+        {
+            MarkDownCache::Configure(0);
+            MarkDownCache::ResetCounts();
+            MarkDownCache::Configure(byteBudget);
+        }
+        ~ScopedMarkDownCache()
+        {
+            MarkDownCache::Configure(0);
+            MarkDownCache::ResetCounts();
+        }
+    };
+
+    TEST_CLASS(MarkDownCacheTest)
+    {
+    public:
+        TEST_METHOD(CacheIsOffByDefault)
+        {
+            ScopedMarkDownCache scope(0);
+            MarkDownParser parser("*hello*");
+            Assert::AreEqual("<p><em>hello</em></p>"s, parser.TransformToHtml());
+            Assert::AreEqual<std::size_t>(0, MarkDownCache::GetSize());
+            Assert::AreEqual<std::uint64_t>(0, MarkDownCache::GetHitCount());
+            Assert::AreEqual<std::uint64_t>(0, MarkDownCache::GetMissCount());
+        }
+
+        TEST_METHOD(RepeatedTextIsServedFromCache)
+        {
+            ScopedMarkDownCache scope(64 * 1024);
+
+            MarkDownParser first("**Foo** &amp; bar");
+            const auto html = first.TransformToHtml();
+            Assert::AreEqual<std::uint64_t>(0, MarkDownCache::GetHitCount());
+            Assert::AreEqual<std::uint64_t>(1, MarkDownCache::GetMissCount());
+            Assert::AreEqual<std::size_t>(1, MarkDownCache::GetSize());
+
+            // the flags come back along with the html
+            MarkDownParser second("**Foo** &amp; bar");
+            Assert::AreEqual(html, second.TransformToHtml());
+            Assert::AreEqual(first.HasHtmlTags(), second.HasHtmlTags());
+            Assert::AreEqual(first.IsEscaped(), second.IsEscaped());
+            Assert::IsTrue(second.HasHtmlTags());
+            Assert::IsTrue(second.IsEscaped());
+            Assert::AreEqual<std::uint64_t>(1, MarkDownCache::GetHitCount());
+
+            MarkDownParser plain("plain");
+            Assert::AreEqual("<p>plain</p>"s, plain.TransformToHtml());
+            MarkDownParser plainAgain("plain");
+            Assert::AreEqual("<p>plain</p>"s, plainAgain.TransformToHtml());
+            Assert::IsFalse(plainAgain.HasHtmlTags());
+            Assert::IsFalse(plainAgain.IsEscaped());
+            Assert::AreEqual<std::uint64_t>(2, MarkDownCache::GetHitCount());
+            Assert::AreEqual<std::uint64_t>(2, MarkDownCache::GetMissCount());
+        }
+
+        TEST_METHOD(LeastRecentlyUsedTextIsEvicted)
+        {
+            ScopedMarkDownCache scope(64 * 1024);
+            MarkDownParser("first").TransformToHtml();
+            const auto entryBytes = MarkDownCache::GetByteSize();
+
+            // room for two entries of the same length
+            MarkDownCache::Configure(2 * entryBytes + 1);
+            MarkDownParser("secnd").TransformToHtml();
+
+            // touch the first text so that the second becomes the least recently used
+            MarkDownParser("first").TransformToHtml();
+            Assert::AreEqual<std::uint64_t>(1, MarkDownCache::GetHitCount());
+
+            MarkDownParser("third").TransformToHtml();
+            Assert::AreEqual<std::size_t>(2, MarkDownCache::GetSize());
+            Assert::IsTrue(MarkDownCache::GetByteSize() <= MarkDownCache::GetByteBudget());
+
+            MarkDownCache::ResetCounts();
+            MarkDownParser("first").TransformToHtml();
+            MarkDownParser("third").TransformToHtml();
+            MarkDownParser("secnd").TransformToHtml();
+            Assert::AreEqual<std::uint64_t>(2, MarkDownCache::GetHitCount());
+            Assert::AreEqual<std::uint64_t>(1, MarkDownCache::GetMissCount());
+        }
+
+        TEST_METHOD(TextLargerThanBudgetIsNotCached)
+        {
+            ScopedMarkDownCache scope(64);
+            MarkDownParser parser(std::string(100, 'a'));
+            Assert::AreEqual("<p>"s + std::string(100, 'a') + "</p>", parser.TransformToHtml());
+            Assert::AreEqual<std::size_t>(0, MarkDownCache::GetSize());
+            Assert::AreEqual<std::size_t>(0, MarkDownCache::GetByteSize());
+        }
+
+        TEST_METHOD(ConfigureShrinksAndClears)
+        {
+            ScopedMarkDownCache scope(64 * 1024);
+            MarkDownParser("one").TransformToHtml();
+            MarkDownParser("two").TransformToHtml();
+            Assert::AreEqual<std::size_t>(2, MarkDownCache::GetSize());
+
+            MarkDownCache::Configure(MarkDownCache::GetByteSize() - 1);
+            Assert::AreEqual<std::size_t>(1, MarkDownCache::GetSize());
+
+            MarkDownCache::Clear();
+            Assert::AreEqual<std::size_t>(0, MarkDownCache::GetSize());
+            Assert::AreEqual<std::size_t>(0, MarkDownCache::GetByteSize());
+
+            MarkDownParser("one").TransformToHtml();
+            MarkDownCache::Configure(0);
+            Assert::AreEqual<std::size_t>(0, MarkDownCache::GetSize());
+            MarkDownParser("one").TransformToHtml();
+            Assert::AreEqual<std::uint64_t>(0, MarkDownCache::GetHitCount());
+        }
+
+        TEST_METHOD(ConcurrentTransformsAgree)
+        {
+            ScopedMarkDownCache scope(4 * 1024);
+            const std::string texts[] = {"*a*", "**b**", "[c](d)", "- e", "1. f", "_g_ &lt;"};
+            std::string expected[std::size(texts)];
+            for (std::size_t i = 0; i < std::size(texts); ++i)
+            {
+                expected[i] = MarkDownParser(texts[i]).TransformToHtml();
+            }
+            MarkDownCache::Clear();
+
+            std::atomic<int> mismatches{0};
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 4; ++t)
+            {
+                threads.emplace_back([&, t]() {
+                    for (int i = 0; i < 500; ++i)
+                    {
+                        const auto which = (i + t) % std::size(texts);
+                        if (MarkDownParser(texts[which]).TransformToHtml() != expected[which])
+                        {
+                            ++mismatches;
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            Assert::AreEqual(0, mismatches.load());
+            Assert::IsTrue(MarkDownCache::GetHitCount() > 0);
+        }
+    };
+}
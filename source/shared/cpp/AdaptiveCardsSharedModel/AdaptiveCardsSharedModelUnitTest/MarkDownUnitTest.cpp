@@ -760,5 +760,38 @@ namespace AdaptiveCardsSharedModelUnitTest
             (void) parser3.TransformToHtml();
             Assert::AreEqual<bool>(true, parser3.IsEscaped());
         }
+
+        TEST_METHOD(LinkBasicValidationTest_UnclosedLinkDestinationTest)
+        {
+            MarkDownParser parser("[a](b");
+            Assert::AreEqual<std::string>("<p>[a](b</p>", parser.TransformToHtml());
+            Assert::AreEqual<bool>(false, parser.HasHtmlTags());
+
+            MarkDownParser parser2("[a](b(c)");
+            Assert::AreEqual<std::string>("<p>[a](b(c)</p>", parser2.TransformToHtml());
+        }
+
+        TEST_METHOD(EmphasisDelimiterTest_UnmatchedRightDelimiterAfterPunctuationTest)
+        {
+            MarkDownParser parser("**!*");
+            Assert::AreEqual<std::string>("<p>**!*</p>", parser.TransformToHtml());
+
+            MarkDownParser parser2("__!_");
+            Assert::AreEqual<std::string>("<p>__!_</p>", parser2.TransformToHtml());
+        }
+
+        TEST_METHOD(Rule11_12Test_TrailingEscapeAfterDelimiter)
+        {
+            MarkDownParser parser("a*\\");
+            Assert::AreEqual<std::string>("<p>a*\\</p>", parser.TransformToHtml());
+        }
+
+        TEST_METHOD(MarkDownBasicSanityTest_TransformToHtmlIsRepeatable)
+        {
+            MarkDownParser parser("*hello* [link](www.naver.com)");
+            const std::string html = parser.TransformToHtml();
+            Assert::AreEqual<std::string>("<p><em>hello</em> <a href=\"www.naver.com\">link</a></p>", html);
+            Assert::AreEqual<std::string>(html, parser.TransformToHtml());
+        }
     };
 }
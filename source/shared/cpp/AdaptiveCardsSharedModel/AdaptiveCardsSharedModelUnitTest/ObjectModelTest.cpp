@@ -690,7 +690,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto parseResult = AdaptiveCard::DeserializeFromString(testjson, "1.5");
             auto card = parseResult->GetAdaptiveCard();
             auto body = card->GetBody();
-            Assert::AreEqual(body.size(), 2ui64);
+            Assert::AreEqual(body.size(), 2ULL);
 
             auto plainInput = std::dynamic_pointer_cast<TextInput>(body.at(0));
             Assert::IsTrue(TextInputStyle::Text == plainInput->GetTextInputStyle());
@@ -722,7 +722,7 @@ namespace AdaptiveCardsSharedModelUnitTest
 
             // verify we emitted a warning and it's correct
             const auto warnings = parseResult->GetWarnings();
-            Assert::IsTrue(warnings.size() == 1ui64);
+            Assert::IsTrue(warnings.size() == 1ULL);
             const auto warning = warnings.at(0);
             Assert::IsTrue(WarningStatusCode::InvalidValue == warning->GetStatusCode());
             Assert::AreEqual("Input.Text ignores isMultiline when using password style"s, warning->GetReason());
@@ -730,7 +730,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             // verify the generated element still reports itself as supporting multiline
             const auto card = parseResult->GetAdaptiveCard();
             const auto body = card->GetBody();
-            Assert::AreEqual(body.size(), 1ui64);
+            Assert::AreEqual(body.size(), 1ULL);
             const auto theInput = std::dynamic_pointer_cast<TextInput>(body.at(0));
             Assert::IsTrue(TextInputStyle::Password == theInput->GetTextInputStyle());
             Assert::IsTrue(theInput->GetIsMultiline());
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // A bit of everything the parsers place in the arena: elements nested a few levels deep, inlines, facts, choices,
+    // toggle targets, fallback content, actions with a card of their own and warnings (for the empty FactSet). It has
+    // no "lang", whose check would depend on the locales the platform knows.
+    const std::string c_arenaCard = R"card({
+        "type": "AdaptiveCard",
+        "version": "1.5",
+        "body": [
+            { "type": "TextBlock", "id": "title", "text": "Arriving {{DATE(2017-10-27T22:23:00Z, SHORT)}}", "wrap": true },
+            {
+                "type": "Container",
+                "style": "emphasis",
+                "items": [
+                    {
+                        "type": "ColumnSet",
+                        "columns": [
+                            { "type": "Column", "width": "auto", "items": [ { "type": "Image", "url": "https://adaptivecards.io/content/cats/1.png" } ] },
+                            { "type": "Column", "width": "stretch", "items": [ { "type": "FactSet", "facts": [ { "title": "a", "value": "b" } ] } ] }
+                        ]
+                    },
+                    { "type": "RichTextBlock", "inlines": [ "plain", { "type": "TextRun", "text": "run", "weight": "bolder" } ] },
+                    { "type": "FactSet", "facts": [] }
+                ]
+            },
+            {
+                "type": "Input.ChoiceSet",
+                "id": "choice",
+                "choices": [ { "title": "one", "value": "1" }, { "title": "two", "value": "2" } ]
+            },
+            { "type": "Graph", "id": "graph", "fallback": { "type": "TextBlock", "id": "graph", "text": "no graph" } },
+            {
+                "type": "ActionSet",
+                "actions": [ { "type": "Action.ToggleVisibility", "title": "toggle", "targetElements": [ "title", { "elementId": "choice", "isVisible": false } ] } ]
+            }
+        ],
+        "actions": [
+            { "type": "Action.Submit", "title": "submit", "data": { "x": 1 } },
+            { "type": "Action.ShowCard", "title": "more", "card": { "type": "AdaptiveCard", "body": [ { "type": "TextBlock", "text": "inner" } ] } }
+        ]
+    })card";
+
+    TEST_CLASS(ParseArenaTest)
+    {
+    public:
+        TEST_METHOD(ArenaParseMatchesRegularParse)
+        {
+            const auto expected = AdaptiveCard::DeserializeFromString(c_arenaCard, "1.5");
+
+            std::weak_ptr<ParseArena> weakArena;
+            std::shared_ptr<BaseCardElement> survivor;
+            {
+                ParseContext context;
+                context.EnableArenaAllocation();
+                weakArena = context.GetArena();
+
+                const auto parseResult = AdaptiveCard::DeserializeFromString(c_arenaCard, "1.5", context);
+                Assert::IsTrue(context.GetArena()->GetReservedSize() > 0);
+
+                // the card and its warnings should come out the same whether or not they were placed in an arena
+                Assert::AreEqual(expected->GetAdaptiveCard()->Serialize(), parseResult->GetAdaptiveCard()->Serialize());
+                const auto expectedWarnings = expected->GetWarnings();
+                const auto warnings = parseResult->GetWarnings();
+                Assert::IsFalse(expectedWarnings.empty());
+                Assert::AreEqual(expectedWarnings.size(), warnings.size());
+                for (size_t i = 0; i < warnings.size(); ++i)
+                {
+                    Assert::IsTrue(expectedWarnings[i]->GetStatusCode() == warnings[i]->GetStatusCode());
+                    Assert::AreEqual(expectedWarnings[i]->GetReason(), warnings[i]->GetReason());
+                }
+
+                survivor = parseResult->GetAdaptiveCard()->GetBody().front();
+            }
+
+            // the arena has to outlive the context and parse result for as long as anything placed in it is alive
+            Assert::IsFalse(weakArena.expired());
+            Assert::AreEqual("title"s, survivor->GetId());
+            survivor.reset();
+            Assert::IsTrue(weakArena.expired());
+        }
+    };
+}
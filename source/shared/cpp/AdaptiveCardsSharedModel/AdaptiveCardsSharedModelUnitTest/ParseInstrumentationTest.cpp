@@ -0,0 +1,198 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseContext.h"
+#include "ParseInstrumentation.h"
+#include "ParseResult.h"
+#include "ParseTimingAggregator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::string c_instrumentedCard = R"card({
+        "type": "AdaptiveCard",
+        "version": "1.2",
+        "body": [
+            {
+                "type": "TextBlock",
+                "text": "first"
+            },
+            {
+                "type": "Container",
+                "items": [
+                    {
+                        "type": "TextBlock",
+                        "text": "nested"
+                    },
+                    {
+                        "type": "FactSet",
+                        "facts": []
+                    }
+                ]
+            },
+            {
+                "type": "Fancy",
+                "fallback": {
+                    "type": "TextBlock",
+                    "text": "fallback"
+                }
+            },
+            {
+                "type": "Image",
+                "url": "http://adaptivecards.io/content/cats/1.png",
+                "fallback": "drop"
+            }
+        ],
+        "actions": [
+            {
+                "type": "Action.Submit",
+                "title": "Submit"
+            },
+            {
+                "type": "Action.Fancy"
+            }
+        ]
+    })card";
+
+    // Writes each event down as a short string: +type and -type:warnings around parses, ?type for unknown types and
+    // !fallback for fallbacks
+    class RecordingInstrumentation : public ParseInstrumentation
+    {
+    public:
+        std::vector<std::string> events;
+
+        void OnParseBegin(ElementKind, const std::string& type) override { events.push_back("+" + type); }
+        void OnParseEnd(ElementKind, const std::string& type, std::size_t warningCount) override
+        {
+            events.push_back("-" + type + ":" + std::to_string(warningCount));
+        }
+        void OnFallback(FallbackType fallbackType) override
+        {
+            events.push_back(fallbackType == FallbackType::Drop ? "!Drop" : fallbackType == FallbackType::Content ? "!Content" : "!None");
+        }
+        void OnUnknownType(ElementKind, const std::string& type) override { events.push_back("?" + type); }
+    };
+
+    TEST_CLASS(ParseInstrumentationTest)
+    {
+    public:
+        TEST_METHOD(EventsFollowTheCardStructure)
+        {
+            auto instrumentation = std::make_shared<RecordingInstrumentation>();
+            ParseContext context;
+            context.SetInstrumentation(instrumentation);
+            AdaptiveCard::DeserializeFromString(c_instrumentedCard, "1.5", context);
+
+            const std::vector<std::string> expected{
+                "+TextBlock", "-TextBlock:0",
+                "+Container", "+TextBlock", "-TextBlock:0", "+FactSet", "-FactSet:1", "-Container:1",
+                "+Fancy", "?Fancy", "+TextBlock", "-TextBlock:0", "!Content", "-Fancy:0",
+                "+Image", "!Drop", "-Image:0",
+                "+Action.Submit", "-Action.Submit:0",
+                "+Action.Fancy", "?Action.Fancy", "-Action.Fancy:0"};
+            Assert::IsTrue(expected == instrumentation->events);
+        }
+
+        TEST_METHOD(EndIsReportedWhenParsingThrows)
+        {
+            auto instrumentation = std::make_shared<RecordingInstrumentation>();
+            ParseContext context;
+            context.SetInstrumentation(instrumentation);
+
+            Assert::ExpectException<AdaptiveCardParseException>([&]() {
+                AdaptiveCard::DeserializeFromString(
+                    R"({"type": "AdaptiveCard", "version": "1.2", "body": [{"type": "TextBlock", "text": "a", "fallback": "nope"}]})",
+                    "1.5",
+                    context);
+            });
+            Assert::IsTrue(std::vector<std::string>{"+TextBlock", "-TextBlock:0"} == instrumentation->events);
+        }
+
+        TEST_METHOD(NoEventsWithoutInstrumentation)
+        {
+            auto instrumentation = std::make_shared<RecordingInstrumentation>();
+            ParseContext context;
+            context.SetInstrumentation(instrumentation);
+            context.SetInstrumentation(nullptr);
+            AdaptiveCard::DeserializeFromString(c_instrumentedCard, "1.5", context);
+            Assert::IsTrue(instrumentation->events.empty());
+            Assert::IsNull(context.GetInstrumentation());
+        }
+
+        TEST_METHOD(AggregatorTotalsPerType)
+        {
+            auto aggregator = std::make_shared<ParseTimingAggregator>();
+            for (int i = 0; i < 3; ++i)
+            {
+                ParseContext context;
+                context.SetInstrumentation(aggregator);
+                AdaptiveCard::DeserializeFromString(c_instrumentedCard, "1.5", context);
+            }
+
+            const auto statistics = aggregator->GetStatistics();
+            Assert::AreEqual<std::size_t>(7, statistics.size());
+
+            const auto& textBlock = statistics.at("TextBlock");
+            Assert::AreEqual<std::uint64_t>(9, textBlock.parseCount);
+            Assert::AreEqual<std::uint64_t>(0, textBlock.warningCount);
+            Assert::IsTrue(textBlock.selfTime == textBlock.totalTime);
+
+            // the container's warnings belong to its FactSet, and its self time leaves out its children
+            const auto& container = statistics.at("Container");
+            Assert::AreEqual<std::uint64_t>(0, container.warningCount);
+            Assert::AreEqual<std::uint64_t>(3, statistics.at("FactSet").warningCount);
+            Assert::IsTrue(container.selfTime < container.totalTime);
+
+            const auto& fancy = statistics.at("Fancy");
+            Assert::AreEqual<std::uint64_t>(3, fancy.unknownCount);
+            Assert::AreEqual<std::uint64_t>(3, fancy.fallbackCount);
+            Assert::AreEqual<std::uint64_t>(3, statistics.at("Image").fallbackCount);
+            Assert::AreEqual<std::uint64_t>(3, statistics.at("Action.Fancy").unknownCount);
+            Assert::AreEqual<std::uint64_t>(0, statistics.at("Action.Submit").unknownCount);
+
+            for (const auto& [type, typeStatistics] : statistics)
+            {
+                const auto& histogram = typeStatistics.selfTimeHistogram;
+                Assert::AreEqual(typeStatistics.parseCount, std::accumulate(histogram.begin(), histogram.end(), std::uint64_t{0}));
+            }
+
+            const auto json = aggregator->SerializeToJsonValue();
+            Assert::AreEqual(9U, json["TextBlock"]["parseCount"].asUInt());
+            Assert::AreEqual(3U, json["FactSet"]["warningCount"].asUInt());
+            Assert::IsTrue(json["TextBlock"]["selfTimeHistogram"].isArray());
+
+            aggregator->Reset();
+            Assert::IsTrue(aggregator->GetStatistics().empty());
+        }
+
+        TEST_METHOD(AggregatorMergesParsesFromSeveralThreads)
+        {
+            auto aggregator = std::make_shared<ParseTimingAggregator>();
+            std::vector<std::thread> threads;
+            for (int i = 0; i < 4; ++i)
+            {
+                threads.emplace_back([&aggregator]() {
+                    for (int j = 0; j < 5; ++j)
+                    {
+                        ParseContext context;
+                        context.SetInstrumentation(aggregator);
+                        AdaptiveCard::DeserializeFromString(c_instrumentedCard, "1.5", context);
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            const auto statistics = aggregator->GetStatistics();
+            Assert::AreEqual<std::uint64_t>(60, statistics.at("TextBlock").parseCount);
+            Assert::AreEqual<std::uint64_t>(20, statistics.at("FactSet").warningCount);
+            Assert::AreEqual<std::uint64_t>(20, statistics.at("Fancy").unknownCount);
+            Assert::AreEqual<std::uint64_t>(20, statistics.at("Fancy").fallbackCount);
+        }
+    };
+}
@@ -49,7 +49,7 @@ namespace AdaptiveCardsSharedModelUnitTest
 
         static void s_AlwaysThrowsFn(const Json::Value&)
         {
-            throw std::exception("always thrown");
+            throw std::runtime_error("always thrown");
         }
 
         TEST_METHOD(GetJsonValueFromStringTests)
@@ -57,6 +57,49 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([]() { ParseUtil::GetJsonValueFromString("definitely not json"); });
             auto jsonValue = ParseUtil::GetJsonValueFromString("{ \"foo\": \"bar\" }");
             Assert::AreEqual(jsonValue["foo"].asCString(), "bar", false);
+
+            // comments are accepted, but not carried along in the parsed value
+            auto commentedValue = ParseUtil::GetJsonValueFromString("{ \"foo\": \"bar\" // trailing comment\n }");
+            Assert::AreEqual(commentedValue["foo"].asCString(), "bar", false);
+            Assert::IsFalse(commentedValue["foo"].hasComment(Json::commentAfterOnSameLine));
+        }
+
+        TEST_METHOD(JsonToStringTests)
+        {
+            // JsonToString writes JSON itself rather than going through Json::StreamWriter, but has to produce the
+            // exact same bytes that a compact, comment-free StreamWriter would
+            Json::StreamWriterBuilder builder;
+            builder["commentStyle"] = "None";
+            builder["indentation"] = "";
+            const auto expectedJson = [&builder](const Json::Value& value) {
+                std::ostringstream outStream;
+                std::unique_ptr<Json::StreamWriter>(builder.newStreamWriter())->write(value, &outStream);
+                outStream << std::endl;
+                return outStream.str();
+            };
+
+            Json::Value value = s_GetJsonObject(R"json({
+                "string": "plain",
+                "escapes": "quote \" backslash \\ tab \t newline \n control \u0001",
+                "unicode": "caf\u00e9 \u65e5\u672c \ud83d\ude00",
+                "unicodeOnly": "\u65e5\u672c",
+                "empty": "",
+                "numbers": [0, -1, 4294967296, -9223372036854775808, 18446744073709551615, 0.5, 2.0, 1e-7, 1.7976931348623157e308],
+                "literals": [true, false, null],
+                "nested": { "b": [], "a": {}, "c": [ { "z": 1, "y": [ "x" ] } ] }
+            })json");
+            value["embeddedNull"] = Json::Value(std::string("before\0after", 12));
+            value["invalidUtf8"] = Json::Value(std::string("\xC3\x28 \xE2\x82 \xF0\x28\x8C\x28"));
+
+            Assert::AreEqual(expectedJson(value), ParseUtil::JsonToString(value));
+            for (const auto& member : value)
+            {
+                Assert::AreEqual(expectedJson(member), ParseUtil::JsonToString(member));
+            }
+
+            std::string buffer{"prefix"};
+            ParseUtil::AppendJsonToString(value, buffer);
+            Assert::AreEqual("prefix"s + expectedJson(value), buffer);
         }
 
         TEST_METHOD(ThrowIfNotJsonObjectTests)
@@ -183,6 +226,20 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual(arrayRet[1].asCString(), "thing2");
         }
 
+        TEST_METHOD(GetArrayDoesNotCopyTests)
+        {
+            auto jsonObjWithAccentArray = s_GetJsonObjectWithAccent("[\"thing1\", \"thing2\"]"s);
+            const auto& arrayRet = ParseUtil::GetArray(jsonObjWithAccentArray, AdaptiveCardSchemaKey::Accent, true);
+            Assert::IsTrue(&arrayRet == &jsonObjWithAccentArray["accent"]);
+
+            const auto& extractRet = ParseUtil::ExtractJsonValue(jsonObjWithAccentArray, AdaptiveCardSchemaKey::Accent, true);
+            Assert::IsTrue(&extractRet == &arrayRet);
+
+            auto jsonObj = s_GetValidJsonObject();
+            const auto& missingRet = ParseUtil::GetArray(jsonObj, AdaptiveCardSchemaKey::Accent, false);
+            Assert::IsTrue(&missingRet == &Json::Value::nullSingleton());
+        }
+
         TEST_METHOD(GetBoolTests)
         {
             auto jsonObj = s_GetValidJsonObject();
@@ -256,6 +313,30 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual(actualString, "Valid"s);
         }
 
+        TEST_METHOD(ToLowercaseTests)
+        {
+            Assert::AreEqual("stretch"s, ParseUtil::ToLowercase("StReTcH"s));
+            Assert::AreEqual("50px"s, ParseUtil::ToLowercase("50PX"s));
+            Assert::AreEqual(""s, ParseUtil::ToLowercase(""s));
+            // only ASCII letters change, so UTF-8 passes through intact
+            Assert::AreEqual("\xC3\x89t\xC3\xA9"s, ParseUtil::ToLowercase("\xC3\x89T\xC3\xA9"s));
+        }
+
+        TEST_METHOD(GettersReadFromNullJsonTests)
+        {
+            // properties are read in place through ExtractJsonValue, which has to treat a null value like an empty
+            // object
+            const Json::Value nullJson;
+            Assert::AreEqual(""s, ParseUtil::GetString(nullJson, AdaptiveCardSchemaKey::Accent));
+            Assert::AreEqual(""s, ParseUtil::GetValueAsString(nullJson, AdaptiveCardSchemaKey::Accent));
+            Assert::IsFalse(ParseUtil::GetOptionalBool(nullJson, AdaptiveCardSchemaKey::Accent).has_value());
+            Assert::IsFalse(ParseUtil::GetOptionalInt(nullJson, AdaptiveCardSchemaKey::Accent).has_value());
+            Assert::IsFalse(ParseUtil::GetOptionalDouble(nullJson, AdaptiveCardSchemaKey::Accent).has_value());
+            Assert::AreEqual(7U, ParseUtil::GetUInt(nullJson, AdaptiveCardSchemaKey::Accent, 7));
+            Assert::IsTrue(TextWeight::Bolder == ParseUtil::GetEnumValue<TextWeight>(nullJson, AdaptiveCardSchemaKey::Accent, TextWeight::Bolder, TextWeightTryFromString));
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { ParseUtil::GetString(nullJson, AdaptiveCardSchemaKey::Accent, true); });
+        }
+
         TEST_METHOD(GetJsonStringTests)
         {
             auto jsonObj = s_GetValidJsonObject();
@@ -121,5 +121,87 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([&]() { elementParser.RemoveParser(CardElementTypeToString(CardElementType::Container)); });
             Assert::IsTrue((bool)elementParser.GetParser(CardElementTypeToString(CardElementType::Container)));
         }
+
+        TEST_METHOD(RegistrationsShareDefaultsUntilChanged)
+        {
+            class NullElementParser : public BaseCardElementParser
+            {
+            public:
+                std::shared_ptr<BaseCardElement> Deserialize(ParseContext&, const Json::Value&) override { return nullptr; }
+                std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext&, const std::string&) override { return nullptr; }
+            };
+
+            class NullActionParser : public ActionElementParser
+            {
+            public:
+                std::shared_ptr<BaseActionElement> Deserialize(ParseContext&, const Json::Value&) override { return nullptr; }
+                std::shared_ptr<BaseActionElement> DeserializeFromString(ParseContext&, const std::string&) override { return nullptr; }
+            };
+
+            const auto actualElementParser = [](const ElementParserRegistration& registration, const std::string& type) {
+                const auto parser = registration.GetParser(type);
+                return parser ? std::static_pointer_cast<BaseCardElementParserWrapper>(parser)->GetActualParser() : nullptr;
+            };
+            const auto actualActionParser = [](const ActionParserRegistration& registration, const std::string& type) {
+                const auto parser = registration.GetParser(type);
+                return parser ? std::static_pointer_cast<ActionElementParserWrapper>(parser)->GetActualParser() : nullptr;
+            };
+
+            const std::string textBlock = CardElementTypeToString(CardElementType::TextBlock);
+            const std::string submit = ActionTypeToString(ActionType::Submit);
+
+            // the built-in parsers are shared between registrations
+            ElementParserRegistration elementRegistration;
+            ActionParserRegistration actionRegistration;
+            Assert::IsTrue(actualElementParser(elementRegistration, textBlock) == actualElementParser(ElementParserRegistration{}, textBlock));
+            Assert::IsTrue(actualActionParser(actionRegistration, submit) == actualActionParser(ActionParserRegistration{}, submit));
+
+            // a custom parser only shows up in the registration it was added to
+            elementRegistration.AddParser("Custom", std::make_shared<NullElementParser>());
+            actionRegistration.AddParser("Action.Custom", std::make_shared<NullActionParser>());
+            Assert::IsNotNull(actualElementParser(elementRegistration, "Custom").get());
+            Assert::IsNotNull(actualActionParser(actionRegistration, "Action.Custom").get());
+            Assert::IsNull(actualElementParser(ElementParserRegistration{}, "Custom").get());
+            Assert::IsNull(actualActionParser(ActionParserRegistration{}, "Action.Custom").get());
+            Assert::IsTrue(actualElementParser(elementRegistration, textBlock) == actualElementParser(ElementParserRegistration{}, textBlock));
+
+            // and copies of a registration don't see each other's changes
+            ElementParserRegistration elementCopy = elementRegistration;
+            ActionParserRegistration actionCopy = actionRegistration;
+            elementCopy.RemoveParser("Custom");
+            actionCopy.AddParser("Action.Other", std::make_shared<NullActionParser>());
+            Assert::IsNull(actualElementParser(elementCopy, "Custom").get());
+            Assert::IsNotNull(actualElementParser(elementRegistration, "Custom").get());
+            Assert::IsNotNull(actualActionParser(actionCopy, "Action.Other").get());
+            Assert::IsNull(actualActionParser(actionRegistration, "Action.Other").get());
+        }
+
+        TEST_METHOD(KnownTypesIgnoreCase)
+        {
+            Assert::IsTrue(ElementParserRegistration::TryGetKnownElementType("TextBlock") == CardElementType::TextBlock);
+            Assert::IsTrue(ElementParserRegistration::TryGetKnownElementType("input.TEXT") == CardElementType::TextInput);
+            Assert::IsTrue(ElementParserRegistration::TryGetKnownElementType("Unknown") == CardElementType::Unknown);
+            Assert::IsFalse(ElementParserRegistration::TryGetKnownElementType("TextBlocks").has_value());
+            Assert::IsFalse(ElementParserRegistration::TryGetKnownElementType("").has_value());
+            Assert::IsTrue(ActionParserRegistration::TryGetKnownActionType("action.submit") == ActionType::Submit);
+            Assert::IsFalse(ActionParserRegistration::TryGetKnownActionType("Action.Fancy").has_value());
+
+            // the built-in parsers are the ones every registration starts out with
+            Assert::IsTrue(&ElementParserRegistration::GetKnownParser(CardElementType::Image) ==
+                           std::static_pointer_cast<BaseCardElementParserWrapper>(ElementParserRegistration{}.GetParser("Image"))->GetActualParser().get());
+            Assert::IsTrue(&ActionParserRegistration::GetKnownParser(ActionType::OpenUrl) ==
+                           std::static_pointer_cast<ActionElementParserWrapper>(ActionParserRegistration{}.GetParser("Action.OpenUrl"))->GetActualParser().get());
+
+            // which rules out overriding them under another case, too
+            class NullElementParser : public BaseCardElementParser
+            {
+            public:
+                std::shared_ptr<BaseCardElement> Deserialize(ParseContext&, const Json::Value&) override { return nullptr; }
+                std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext&, const std::string&) override { return nullptr; }
+            };
+            ElementParserRegistration registration;
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { registration.AddParser("textblock", std::make_shared<NullElementParser>()); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { registration.RemoveParser("IMAGE"); });
+        }
     };
 }
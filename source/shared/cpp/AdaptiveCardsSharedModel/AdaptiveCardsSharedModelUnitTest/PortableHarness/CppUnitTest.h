@@ -0,0 +1,270 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+// A stand-in for the parts of the Microsoft CppUnitTest framework that the shared model tests use, so that the same
+// test sources can be built and run with CMake on platforms other than Windows. Test methods register themselves when
+// the test binary starts; CppUnitTestRunner.cpp runs them.
+
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Microsoft
+{
+namespace VisualStudio
+{
+namespace CppUnitTestFramework
+{
+    // Thrown by a failed assertion; the runner reports the message and moves on to the next test
+    class AssertFailedException : public std::exception
+    {
+    public:
+        explicit AssertFailedException(std::string message) : m_message(std::move(message)) {}
+        const char* what() const noexcept override { return m_message.c_str(); }
+
+    private:
+        std::string m_message;
+    };
+
+    struct TestMethodInfo
+    {
+        const char* className;
+        const char* methodName;
+        void (*invoke)();
+    };
+
+    inline std::vector<TestMethodInfo>& GetRegisteredTestMethods()
+    {
+        static std::vector<TestMethodInfo> testMethods;
+        return testMethods;
+    }
+
+    struct TestMethodRegistration
+    {
+        TestMethodRegistration(const char* className, const char* methodName, void (*invoke)())
+        {
+            GetRegisteredTestMethods().push_back({className, methodName, invoke});
+        }
+    };
+
+    template <typename T>
+    class TestClass
+    {
+    protected:
+        using ThisTestClass = T;
+    };
+
+    namespace Details
+    {
+        // Messages are ASCII in practice; anything else is replaced rather than pulling in a converter
+        inline std::string ToNarrow(const wchar_t* message)
+        {
+            std::string narrow;
+            for (; message != nullptr && *message != L'\0'; ++message)
+            {
+                narrow.push_back((*message >= 0 && *message < 0x80) ? static_cast<char>(*message) : '?');
+            }
+            return narrow;
+        }
+
+        template <typename T, typename = void>
+        struct IsStreamable : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct IsStreamable<T, std::void_t<decltype(std::declval<std::ostream&>() << std::declval<const T&>())>>
+            : std::true_type
+        {
+        };
+
+        template <typename T>
+        std::string ToString(const T& value)
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                return value ? "true" : "false";
+            }
+            else if constexpr (std::is_enum_v<T>)
+            {
+                return std::to_string(static_cast<std::underlying_type_t<T>>(value));
+            }
+            else if constexpr (IsStreamable<T>::value)
+            {
+                std::ostringstream stream;
+                stream << value;
+                return stream.str();
+            }
+            else
+            {
+                return "<value>";
+            }
+        }
+
+        [[noreturn]] inline void Fail(const std::string& assertion, const wchar_t* message)
+        {
+            std::string description = assertion;
+            const auto narrowMessage = ToNarrow(message);
+            if (!narrowMessage.empty())
+            {
+                description.append(" - ").append(narrowMessage);
+            }
+            throw AssertFailedException(description);
+        }
+    } // namespace Details
+
+    class Assert
+    {
+    public:
+        template <typename T, typename U>
+        static void AreEqual(const T& expected, const U& actual, const wchar_t* message = nullptr)
+        {
+            if (!(expected == actual))
+            {
+                Details::Fail("Assert::AreEqual failed. Expected:<" + Details::ToString(expected) + "> Actual:<" +
+                                  Details::ToString(actual) + ">",
+                              message);
+            }
+        }
+
+        static void AreEqual(const char* expected, const char* actual, bool ignoreCase = false, const wchar_t* message = nullptr)
+        {
+            std::string expectedString(expected);
+            std::string actualString(actual);
+            if (ignoreCase)
+            {
+                for (auto* text : {&expectedString, &actualString})
+                {
+                    for (auto& c : *text)
+                    {
+                        c = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+                    }
+                }
+            }
+            AreEqual(expectedString, actualString, message);
+        }
+
+        static void AreEqual(const char* expected, const char* actual, const wchar_t* message)
+        {
+            AreEqual(expected, actual, false, message);
+        }
+
+        static void AreEqual(const wchar_t* expected, const wchar_t* actual, const wchar_t* message = nullptr)
+        {
+            AreEqual(Details::ToNarrow(expected), Details::ToNarrow(actual), message);
+        }
+
+        static void AreEqual(double expected, double actual, double tolerance, const wchar_t* message = nullptr)
+        {
+            if (std::fabs(expected - actual) > tolerance)
+            {
+                Details::Fail("Assert::AreEqual failed. Expected:<" + Details::ToString(expected) + "> Actual:<" +
+                                  Details::ToString(actual) + ">",
+                              message);
+            }
+        }
+
+        template <typename T, typename U>
+        static void AreNotEqual(const T& notExpected, const U& actual, const wchar_t* message = nullptr)
+        {
+            if (notExpected == actual)
+            {
+                Details::Fail("Assert::AreNotEqual failed. Value:<" + Details::ToString(actual) + ">", message);
+            }
+        }
+
+        static void IsTrue(bool condition, const wchar_t* message = nullptr)
+        {
+            if (!condition)
+            {
+                Details::Fail("Assert::IsTrue failed", message);
+            }
+        }
+
+        static void IsFalse(bool condition, const wchar_t* message = nullptr)
+        {
+            if (condition)
+            {
+                Details::Fail("Assert::IsFalse failed", message);
+            }
+        }
+
+        template <typename T>
+        static void IsNull(const T& pointer, const wchar_t* message = nullptr)
+        {
+            if (pointer != nullptr)
+            {
+                Details::Fail("Assert::IsNull failed", message);
+            }
+        }
+
+        template <typename T>
+        static void IsNotNull(const T& pointer, const wchar_t* message = nullptr)
+        {
+            if (pointer == nullptr)
+            {
+                Details::Fail("Assert::IsNotNull failed", message);
+            }
+        }
+
+        [[noreturn]] static void Fail(const wchar_t* message = nullptr) { Details::Fail("Assert::Fail", message); }
+
+        template <typename ExpectedException, typename Functor>
+        static void ExpectException(Functor functor, const wchar_t* message = nullptr)
+        {
+            try
+            {
+                functor();
+            }
+            catch (const ExpectedException&)
+            {
+                return;
+            }
+            catch (...)
+            {
+                Details::Fail("Assert::ExpectException failed. A different exception was thrown", message);
+            }
+            Details::Fail("Assert::ExpectException failed. No exception was thrown", message);
+        }
+    };
+
+    class Logger
+    {
+    public:
+        // Messages are kept with the running test and only printed if it fails
+        static void WriteMessage(const char* message) { GetMessages().append(message).append("\n"); }
+        static void WriteMessage(const wchar_t* message) { WriteMessage(Details::ToNarrow(message).c_str()); }
+
+        static std::string& GetMessages()
+        {
+            static std::string messages;
+            return messages;
+        }
+    };
+} // namespace CppUnitTestFramework
+} // namespace VisualStudio
+} // namespace Microsoft
+
+#define TEST_CLASS(className)                                                                                  \
+    class className;                                                                                           \
+    inline const char* GetTestClassName(const className*) { return #className; }                               \
+    class className : public ::Microsoft::VisualStudio::CppUnitTestFramework::TestClass<className>
+
+// The invoker is a template so that the call to the method is only looked up once the class is complete
+#define TEST_METHOD(methodName)                                                                                \
+    template <typename T>                                                                                      \
+    static void methodName##_Invoke()                                                                          \
+    {                                                                                                          \
+        T testClass;                                                                                           \
+        testClass.methodName();                                                                                \
+    }                                                                                                          \
+    static inline const ::Microsoft::VisualStudio::CppUnitTestFramework::TestMethodRegistration methodName##_Registration{ \
+        GetTestClassName(static_cast<const ThisTestClass*>(nullptr)), #methodName, &methodName##_Invoke<ThisTestClass>}; \
+    void methodName()
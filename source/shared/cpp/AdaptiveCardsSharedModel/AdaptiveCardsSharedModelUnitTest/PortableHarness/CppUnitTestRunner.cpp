@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <iostream>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+// Runs every registered test method, or just those whose "Class::Method" name starts with one of the arguments.
+// Arguments that start with '-' skip the methods whose names start with the rest of the argument instead. Pass --list
+// to print the names rather than run them. Returns non-zero if any test failed.
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> filters;
+    std::vector<std::string> exclusions;
+    bool listOnly = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument(argv[i]);
+        if (argument == "--list")
+        {
+            listOnly = true;
+        }
+        else if (argument.size() > 1 && argument[0] == '-')
+        {
+            exclusions.push_back(argument.substr(1));
+        }
+        else
+        {
+            filters.push_back(argument);
+        }
+    }
+
+    std::size_t ran = 0;
+    std::size_t failed = 0;
+    for (const auto& testMethod : GetRegisteredTestMethods())
+    {
+        const std::string name = std::string(testMethod.className) + "::" + testMethod.methodName;
+        const auto matches = [&name](const std::string& prefix) { return name.rfind(prefix, 0) == 0; };
+        if ((!filters.empty() && std::none_of(filters.begin(), filters.end(), matches)) ||
+            std::any_of(exclusions.begin(), exclusions.end(), matches))
+        {
+            continue;
+        }
+
+        if (listOnly)
+        {
+            std::cout << name << "\n";
+            continue;
+        }
+
+        ++ran;
+        Logger::GetMessages().clear();
+        std::string failure;
+        try
+        {
+            testMethod.invoke();
+        }
+        catch (const AssertFailedException& e)
+        {
+            failure = e.what();
+        }
+        catch (const std::exception& e)
+        {
+            failure = std::string("Unhandled exception: ") + e.what();
+        }
+        catch (...)
+        {
+            failure = "Unhandled exception of unknown type";
+        }
+
+        if (!failure.empty())
+        {
+            ++failed;
+            std::cout << "FAILED " << name << ": " << failure << "\n" << Logger::GetMessages();
+        }
+    }
+
+    if (!listOnly)
+    {
+        std::cout << ran << " tests, " << failed << " failed\n";
+    }
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,5 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+// Nothing from StrSafe.h is used by the tests; this keeps their includes working on other platforms
@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+// The little of the Win32 API the shared model tests use, for building them on other platforms
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+struct TIME_ZONE_INFORMATION
+{
+    long Bias; // minutes to add to local standard time to get UTC
+};
+
+inline unsigned long GetTimeZoneInformation(TIME_ZONE_INFORMATION* timeZoneInformation)
+{
+    tzset();
+    timeZoneInformation->Bias = timezone / 60;
+    return 0;
+}
+
+// and of the C runtime's
+inline int _dupenv_s(char** buffer, size_t* length, const char* name)
+{
+    const char* value = getenv(name);
+    *buffer = value ? strdup(value) : nullptr;
+    *length = value ? strlen(value) + 1 : 0;
+    return 0;
+}
+
+// an empty value removes the variable
+inline int _putenv_s(const char* name, const char* value)
+{
+    return (*value == '\0') ? unsetenv(name) : setenv(name, value, 1);
+}
@@ -54,6 +54,14 @@ namespace AdaptiveCardsSharedModelUnitTest
                 Assert::AreEqual(40U, version.GetRevision());
             }
 
+            {
+                SemanticVersion version("0.2147483647.007");
+                Assert::AreEqual(0U, version.GetMajor());
+                Assert::AreEqual(2147483647U, version.GetMinor());
+                Assert::AreEqual(7U, version.GetBuild());
+                Assert::AreEqual(0U, version.GetRevision());
+            }
+
         }
 
         TEST_METHOD(NegativeTest)
@@ -71,6 +79,11 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("0xF"); });
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("F"); });
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.c"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.2.3.4.5"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1..2"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version(".1"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("+1"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.2147483648"); });
         }
 
         TEST_METHOD(CompareTest)
@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "Container.h"
+#include "ParseContext.h"
+#include "ParseUtil.h"
+#include "TextBlock.h"
+#include <filesystem>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Everything a parse comes to -- the card, as it serializes, and its warnings, or the error it failed with
+    std::string DescribeParse(const std::function<std::shared_ptr<ParseResult>()>& parse)
+    {
+        try
+        {
+            const auto parseResult = parse();
+            std::string description = parseResult->GetAdaptiveCard()->Serialize();
+            for (const auto& warning : parseResult->GetWarnings())
+            {
+                description += "\nwarning " + std::to_string(static_cast<int>(warning->GetStatusCode())) + ": " + warning->GetReason();
+            }
+            return description;
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            return "error " + std::to_string(static_cast<int>(e.GetStatusCode())) + ": " + e.GetReason();
+        }
+        catch (const std::exception& e)
+        {
+            return std::string("exception: ") + e.what();
+        }
+    }
+
+    void AssertStreamingParseMatches(const std::string& json, std::shared_ptr<ElementParserRegistration> elementRegistration = nullptr, const wchar_t* message = nullptr)
+    {
+        const std::string expected = DescribeParse([&]() {
+            ParseContext context(elementRegistration, nullptr);
+            return AdaptiveCard::DeserializeFromString(json, "1.5", context);
+        });
+        const std::string actual = DescribeParse([&]() {
+            ParseContext context(elementRegistration, nullptr);
+            return AdaptiveCard::DeserializeFromStringStreaming(json, "1.5", context);
+        });
+        Assert::AreEqual(expected, actual, message);
+    }
+
+    TEST_CLASS(StreamingParseTest)
+    {
+    public:
+        TEST_METHOD(SamplesMatchParseFromJsonValue)
+        {
+            const auto samplesDirectory = std::filesystem::path(__FILE__).parent_path() / ".." / ".." / ".." / ".." / ".." / "samples";
+
+            unsigned int sampleCount = 0;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(samplesDirectory))
+            {
+                if (entry.path().extension() != ".json")
+                {
+                    continue;
+                }
+
+                std::ifstream file(entry.path(), std::ios::binary);
+                const std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+                AssertStreamingParseMatches(json, nullptr, entry.path().wstring().c_str());
+                ++sampleCount;
+            }
+
+            // make sure the samples were found at all
+            Assert::IsTrue(sampleCount > 100);
+        }
+
+        TEST_METHOD(JsonQuirksMatchParseFromJsonValue)
+        {
+            const std::vector<std::string> cards{
+                // comments anywhere jsoncpp allows them, and a comment standing in for a comma
+                R"({ /* c */ "type": "AdaptiveCard", // c
+                    "version": "1.5", "body": [ /* c */ { "type": "TextBlock", "text": "a" } /* c */, { "type": "TextBlock", "text": "b" /* c */ } ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock" /* c */ "ignored" "text": "a" } ] })",
+                // the last of repeated members wins, including collections
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "a" } ], "body": [ { "type": "TextBlock", "text": "b" } ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "a" } ], "body": [] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [], "body": [ { "type": "TextBlock", "text": "b" } ] })",
+                // escapes in names and values
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "\"a\" \ud83d\ude00 \/" } ] })",
+                // an empty member name makes jsoncpp take a trailing comma
+                R"({ "type": "AdaptiveCard", "version": "1.5", "": 1, })",
+                // columns that leave out their implied type, get it wrong, or get it right
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "ColumnSet", "columns": [ { "items": [ { "type": "TextBlock", "text": "a" } ] }, { "type": "Column", "items": [] } ] } ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "ColumnSet", "columns": [ { "type": "Container", "items": [ { "type": "TextBlock", "text": "a" } ] } ] } ] })",
+                // tables, action sets, and collections where the schema has no use for them
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "Table", "columns": [ { "width": 1 } ], "rows": [ { "type": "TableRow", "cells": [ { "type": "TableCell", "items": [ { "type": "TextBlock", "text": "a" } ] } ] } ] } ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "ActionSet", "actions": [ { "type": "Action.Submit", "title": "a" } ] } ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "a", "items": [ { "type": "TextBlock", "text": "b" } ] } ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "Unknown", "items": [ { "type": "TextBlock", "text": "b" } ] } ] })",
+                // values that aren't what they should be
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ 1 ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": { "type": "TextBlock", "text": "a" } })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "Container", "items": "a" } ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "a", "id": "a" }, { "type": "TextBlock", "text": "b", "id": "a" } ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "size": -, "text": 1.5e3 } ] })",
+                // json that isn't a card, or isn't json
+                R"([ { "type": "AdaptiveCard" } ])",
+                R"("AdaptiveCard")",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "a" }, ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "a\q" } ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "\ud83d" } ] })",
+                R"({ "type": "AdaptiveCard", "version": "1.5" )",
+                R"({ "type": "AdaptiveCard", "version": "1.5" } trailing text)",
+                "",
+                std::string(1001, '[') + std::string(1001, ']'),
+            };
+
+            for (const auto& card : cards)
+            {
+                AssertStreamingParseMatches(card, nullptr, std::wstring(card.begin(), card.end()).c_str());
+            }
+        }
+
+        TEST_METHOD(CustomElementsGetTheirWholeJson)
+        {
+            // reads what it's given of its "items" as json, which only works if they haven't been left out of it
+            class ItemCountingParser : public BaseCardElementParser
+            {
+            public:
+                std::shared_ptr<BaseCardElement> Deserialize(ParseContext& /*context*/, const Json::Value& value) override
+                {
+                    auto textBlock = std::make_shared<TextBlock>();
+                    textBlock->SetText(std::to_string(value["items"].size()));
+                    return textBlock;
+                }
+                std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& value) override
+                {
+                    return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
+                }
+            };
+
+            auto elementRegistration = std::make_shared<ElementParserRegistration>();
+            elementRegistration->AddParser("ItemCounter", std::make_shared<ItemCountingParser>());
+
+            const std::string card = R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "Container", "items": [
+                { "type": "ItemCounter", "items": [ { "type": "TextBlock", "text": "a" }, { "type": "TextBlock", "text": "b" } ] } ] } ] })";
+            AssertStreamingParseMatches(card, elementRegistration);
+
+            ParseContext context(elementRegistration, nullptr);
+            const auto parseResult = AdaptiveCard::DeserializeFromStringStreaming(card, "1.5", context);
+            const auto container = std::static_pointer_cast<Container>(parseResult->GetAdaptiveCard()->GetBody().front());
+            Assert::AreEqual(std::string("2"), std::static_pointer_cast<TextBlock>(container->GetItems().front())->GetText());
+        }
+    };
+}
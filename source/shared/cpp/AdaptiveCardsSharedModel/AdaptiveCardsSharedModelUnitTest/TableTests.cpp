@@ -51,7 +51,7 @@ namespace AdaptiveCardsSharedModelUnitTest
 
             // ensure we get expected items
             auto items = tableCell->GetItems();
-            Assert::AreEqual(2ui64, items.size(), L"This TableCell should have 2 items");
+            Assert::AreEqual(2ULL, items.size(), L"This TableCell should have 2 items");
             for (const auto& item : items)
             {
                 Assert::AreEqual("TextBlock"s, item->GetElementTypeString(), L"Each item in this cell should be a TextBlock");
@@ -126,7 +126,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::IsTrue(additionalProperties.isNull(), L"This TableRow shouldn't have any additionalProperties");
 
             // ensure we get expected items
-            Assert::AreEqual(2ui64, tableRow->GetCells().size(), L"This TableRow should have 2 cells");
+            Assert::AreEqual(2ULL, tableRow->GetCells().size(), L"This TableRow should have 2 cells");
             Assert::IsTrue(ContainerStyle::Accent == tableRow->GetStyle());
             Assert::IsTrue(HorizontalAlignment::Center == tableRow->GetHorizontalCellContentAlignment());
             Assert::IsTrue(VerticalContentAlignment::Bottom == tableRow->GetVerticalCellContentAlignment());
@@ -367,7 +367,7 @@ namespace AdaptiveCardsSharedModelUnitTest
 
             // ensure we get expected items
             const auto& columns = table->GetColumns();
-            Assert::AreEqual(3ui64, columns.size());
+            Assert::AreEqual(3ULL, columns.size());
             Assert::IsTrue(columns[0]->GetWidth().has_value() && !columns[0]->GetPixelWidth().has_value());
             Assert::IsTrue(columns[0]->GetWidth().value() == 1);
             Assert::IsFalse(columns[0]->GetPixelWidth().has_value());
@@ -379,7 +379,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::IsFalse(columns[2]->GetPixelWidth().has_value());
 
             const auto& rows = table->GetRows();
-            Assert::AreEqual(3ui64, rows.size());
+            Assert::AreEqual(3ULL, rows.size());
             for (const auto& row : rows)
             {
                 const auto& cells = row->GetCells();
@@ -502,7 +502,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto result = AdaptiveCard::DeserializeFromString(tableCard, "1.5");
             auto card = result->GetAdaptiveCard();
             auto body = card->GetBody();
-            Assert::AreEqual(1ui64, body.size());
+            Assert::AreEqual(1ULL, body.size());
             auto bodyElem = body.at(0);
             Assert::AreEqual("Table"s, bodyElem->GetElementTypeString());
 
@@ -539,7 +539,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto result = AdaptiveCard::DeserializeFromString(tableCard, "1.5");
             auto card = result->GetAdaptiveCard();
             auto body = card->GetBody();
-            Assert::AreEqual(1ui64, body.size());
+            Assert::AreEqual(1ULL, body.size());
             auto bodyElem = body.at(0);
             Assert::AreEqual("TableRow"s, bodyElem->GetElementTypeString(),
                 L"An orphaned TableRow should deserialize with its type string intact");
@@ -577,7 +577,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto result = AdaptiveCard::DeserializeFromString(tableCard, "1.5");
             auto card = result->GetAdaptiveCard();
             auto body = card->GetBody();
-            Assert::AreEqual(1ui64, body.size());
+            Assert::AreEqual(1ULL, body.size());
             auto bodyElem = body.at(0);
             Assert::AreEqual("TableCell"s, bodyElem->GetElementTypeString(),
                 L"An orphaned TableCell should deserialize with its type string intact");
@@ -626,7 +626,7 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto card = result->GetAdaptiveCard();
 
             auto body = card->GetBody();
-            Assert::AreEqual(1ui64, body.size());
+            Assert::AreEqual(1ULL, body.size());
 
             auto bodyElem = body.at(0);
             Assert::AreEqual(CardElementTypeToString(CardElementType::Table),
@@ -636,10 +636,10 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto table = std::static_pointer_cast<Table>(bodyElem);
 
             auto columns = table->GetColumns();
-            Assert::AreEqual(1ui64, columns.size(), L"should be only one column");
+            Assert::AreEqual(1ULL, columns.size(), L"should be only one column");
 
             auto rows = table->GetRows();
-            Assert::AreEqual(1ui64, rows.size(), L"should be only one row");
+            Assert::AreEqual(1ULL, rows.size(), L"should be only one row");
 
             auto row = rows.at(0);
             Assert::AreEqual(CardElementTypeToString(CardElementType::TableRow),
@@ -647,7 +647,7 @@ namespace AdaptiveCardsSharedModelUnitTest
                 L"should be a real TableRow");
 
             auto cells = row->GetCells();
-            Assert::AreEqual(1ui64, cells.size(), L"should be only one cell");
+            Assert::AreEqual(1ULL, cells.size(), L"should be only one cell");
 
             auto cell = cells.at(0);
             Assert::AreEqual(CardElementTypeToString(CardElementType::TableCell),
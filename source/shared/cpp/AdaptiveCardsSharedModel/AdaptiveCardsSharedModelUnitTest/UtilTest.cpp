@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "DateTimePreparser.h"
+#include "Util.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Expected results for the hand-written scanners below. These are the answers the regular expressions they
+    // replaced gave for the same inputs.
+    struct DimensionCase
+    {
+        const char* input;
+        std::optional<int> expected;
+        const char* warningPrefix; // nullptr if no warning is expected
+    };
+
+    const DimensionCase c_dimensionCases[] = {
+        {"", std::nullopt, nullptr},
+        {"auto", std::nullopt, nullptr},
+        {"stretch", std::nullopt, nullptr},
+        {"50", std::nullopt, nullptr},
+        {"1px", 1, nullptr},
+        {"50px", 50, nullptr},
+        {"1024px", 1024, nullptr},
+        {"1.5px", 1, nullptr},
+        {"99.999px", 99, nullptr},
+        {"2147483647px", 2147483647, nullptr},
+        {"2147483648px", std::nullopt, "out of range: "},
+        {"99999999999999999999.5px", std::nullopt, "out of range: "},
+        {"0px", std::nullopt, "expected input argument"},
+        {"01px", std::nullopt, "expected input argument"},
+        {"-1px", std::nullopt, "expected input argument"},
+        {".5px", std::nullopt, "expected input argument"},
+        {"1.px", std::nullopt, "expected input argument"},
+        {"1.5.5px", std::nullopt, "expected input argument"},
+        {"1 px", std::nullopt, "expected input argument"},
+        {"1PX", std::nullopt, "expected input argument"},
+        {"1pxpx", std::nullopt, "expected input argument"},
+        {"1em", std::nullopt, "expected input argument"},
+        {"px1", std::nullopt, nullptr},
+        {"50px ", std::nullopt, "expected input argument"},
+    };
+
+    TEST_CLASS(UtilTest)
+    {
+    public:
+        TEST_METHOD(ParseSizeForPixelSizeTests)
+        {
+            for (const auto& testCase : c_dimensionCases)
+            {
+                std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+                const auto actual = ParseSizeForPixelSize(testCase.input, &warnings);
+                const auto message = L"Unexpected result parsing \"" + std::wstring(testCase.input, testCase.input + strlen(testCase.input)) + L"\"";
+
+                Assert::IsTrue(testCase.expected == actual, message.c_str());
+                if (testCase.warningPrefix)
+                {
+                    Assert::AreEqual<size_t>(1, warnings.size(), message.c_str());
+                    Assert::IsTrue(WarningStatusCode::InvalidDimensionSpecified == warnings[0]->GetStatusCode());
+                    const auto& reason = warnings[0]->GetReason();
+                    Assert::IsTrue(reason.rfind(testCase.warningPrefix, 0) == 0, message.c_str());
+                    Assert::IsTrue(reason.size() >= strlen(testCase.input), message.c_str());
+                    Assert::AreEqual(std::string(testCase.input), reason.substr(reason.size() - strlen(testCase.input)));
+                }
+                else
+                {
+                    Assert::IsTrue(warnings.empty(), message.c_str());
+                }
+
+                // callers that don't want warnings pass nullptr
+                Assert::IsTrue(testCase.expected == ParseSizeForPixelSize(testCase.input, nullptr), message.c_str());
+            }
+        }
+
+        TEST_METHOD(ValidateColorTests)
+        {
+            const std::pair<const char*, const char*> cases[] = {
+                {"", ""},
+                {"#FF00aa", "#FFFF00aa"},
+                {"#80FF00aa", "#80FF00aa"},
+                {"#abcdef", "#FFabcdef"},
+                {"#GG00aa", "#00000000"},
+                {"FF00aa", "#00000000"},
+                {"#FF00a", "#00000000"},
+                {"#FF00aa0", "#00000000"},
+                {"#FF00aa000", "#00000000"},
+                {"red", "#00000000"},
+            };
+
+            for (const auto& testCase : cases)
+            {
+                std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+                Assert::AreEqual(std::string(testCase.second), ValidateColor(testCase.first, warnings));
+                const bool expectWarning = (std::string(testCase.second) == "#00000000");
+                Assert::AreEqual<size_t>(expectWarning ? 1 : 0, warnings.size());
+                if (expectWarning)
+                {
+                    Assert::IsTrue(WarningStatusCode::InvalidColorFormat == warnings[0]->GetStatusCode());
+                }
+            }
+        }
+
+        TEST_METHOD(TryParseSimpleTimeTests)
+        {
+            const std::pair<const char*, bool> cases[] = {
+                {"00:00", true},
+                {"09:05", true},
+                {"23:59", true},
+                {"24:60", true}, // IsValidTime allows the end of the day
+                {"25:00", false},
+                {"12:61", false},
+                {"9:05", false},
+                {"09:5", false},
+                {"0905", false},
+                {"09-05", false},
+                {"09:05 ", false},
+                {" 09:05", false},
+                {"ab:cd", false},
+                {"", false},
+            };
+
+            for (const auto& testCase : cases)
+            {
+                unsigned int hours = 99, minutes = 99;
+                Assert::AreEqual(testCase.second, DateTimePreparser::TryParseSimpleTime(testCase.first, hours, minutes));
+                if (testCase.second)
+                {
+                    Assert::AreEqual(std::stoul(std::string(testCase.first, 2)), static_cast<unsigned long>(hours));
+                    Assert::AreEqual(std::stoul(std::string(testCase.first + 3, 2)), static_cast<unsigned long>(minutes));
+                }
+                else
+                {
+                    Assert::AreEqual(99U, hours);
+                    Assert::AreEqual(99U, minutes);
+                }
+            }
+        }
+
+        TEST_METHOD(TryParseSimpleDateTests)
+        {
+            const std::pair<const char*, bool> cases[] = {
+                {"2021-01-31", true},
+                {"2020-02-29", true},
+                {"2000-02-29", true},
+                {"1900-02-29", false},
+                {"2019-02-29", false},
+                {"2021-04-31", false},
+                {"2021-13-01", false},
+                {"2021-12-32", false},
+                {"0000-00-00", true}, // IsValidDate only checks upper bounds
+                {"21-01-01", false},
+                {"2021-1-01", false},
+                {"2021/01/01", false},
+                {"2021-01-01T", false},
+                {"2021-0a-01", false},
+                {"", false},
+            };
+
+            for (const auto& testCase : cases)
+            {
+                unsigned int year = 0, month = 0, day = 0;
+                Assert::AreEqual(testCase.second, DateTimePreparser::TryParseSimpleDate(testCase.first, year, month, day));
+                if (testCase.second)
+                {
+                    Assert::AreEqual(std::stoul(std::string(testCase.first, 4)), static_cast<unsigned long>(year));
+                    Assert::AreEqual(std::stoul(std::string(testCase.first + 5, 2)), static_cast<unsigned long>(month));
+                    Assert::AreEqual(std::stoul(std::string(testCase.first + 8, 2)), static_cast<unsigned long>(day));
+                }
+            }
+        }
+
+        TEST_METHOD(DecodeHtmlEntitiesTests)
+        {
+            const std::pair<const char*, const char*> cases[] = {
+                {"", ""},
+                {"no entities here", "no entities here"},
+                {"&amp;&quot;&lt;&gt;&nbsp;", "&\"<>\xC2\xA0"},
+                {"Foo &amp; Bar", "Foo & Bar"},
+                {"&lt;b&gt;bold&lt;/b&gt;", "<b>bold</b>"},
+                {"&amp;nbsp;", "&nbsp;"}, // decoded text isn't decoded again
+                {"&amp;amp;", "&amp;"},
+                {"&&lt;", "&<"},
+                {"&", "&"},
+                {"&amp", "&amp"},
+                {"& amp;", "& amp;"},
+                {"&AMP;", "&AMP;"},
+                {"&copy;", "&copy;"},
+                {"trailing &", "trailing &"},
+                {"&nbsp", "&nbsp"},
+                {"a&nbsp;&nbsp;b", "a\xC2\xA0\xC2\xA0" "b"},
+                // text that hasn't moved yet, after an ampersand that isn't an entity, and text that has
+                {"&not one, then &amp; one", "&not one, then & one"},
+            };
+
+            for (const auto& testCase : cases)
+            {
+                std::string inPlace = testCase.first;
+                DecodeHtmlEntitiesInPlace(inPlace);
+                Assert::AreEqual(std::string(testCase.second), inPlace);
+
+                std::string appended = "prefix";
+                AppendDecodedHtmlEntities(testCase.first, appended);
+                Assert::AreEqual("prefix"s + testCase.second, appended);
+            }
+        }
+    };
+}
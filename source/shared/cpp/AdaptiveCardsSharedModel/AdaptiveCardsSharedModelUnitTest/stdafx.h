@@ -2,11 +2,15 @@
 // Licensed under the MIT License.
 #pragma once
 
+#ifdef _MSC_VER
 #include "targetver.h"
+#endif
 
-// Headers for CppUnitTest
+// Headers for CppUnitTest; other platforms get PortableHarness/CppUnitTest.h instead
 #include "CppUnitTest.h"
+#ifdef _MSC_VER
 #include <CodeCoverage\CodeCoverage.h>
+#endif
 #include "Enums.h"
 #include "json/json.h"
 
@@ -7,6 +7,7 @@
 #include "BaseElement.h"
 #include "ExecuteAction.h"
 #include "OpenUrlAction.h"
+#include "ParseInstrumentation.h"
 #include "ShowCardAction.h"
 #include "SubmitAction.h"
 #include "ToggleVisibilityAction.h"
@@ -14,6 +15,17 @@
 
 namespace AdaptiveCards
 {
+namespace
+{
+    constexpr std::array<ActionType, 6> c_knownActionTypes{
+        ActionType::Execute,
+        ActionType::OpenUrl,
+        ActionType::ShowCard,
+        ActionType::Submit,
+        ActionType::ToggleVisibility,
+        ActionType::UnknownAction};
+} // namespace
+
 ActionElementParserWrapper::ActionElementParserWrapper(std::shared_ptr<ActionElementParser> parserToWrap) :
     m_parser{parserToWrap}
 {
@@ -21,10 +33,18 @@ ActionElementParserWrapper::ActionElementParserWrapper(std::shared_ptr<ActionEle
 
 std::shared_ptr<BaseActionElement> ActionElementParserWrapper::Deserialize(ParseContext& context, const Json::Value& value)
 {
-    const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
+    return DeserializeWithParser(*m_parser, context, value);
+}
+
+std::shared_ptr<BaseActionElement> ActionElementParserWrapper::DeserializeWithParser(
+    ActionElementParser& parser, ParseContext& context, const Json::Value& value)
+{
+#ifndef ADAPTIVECARDS_DISABLE_PARSE_INSTRUMENTATION
+    const ParseInstrumentationScope instrumentationScope(context, ParseInstrumentation::ElementKind::Action, value);
+#endif
     const AdaptiveCards::InternalId internalId = AdaptiveCards::InternalId::Next();
-    context.PushElement(idProperty, internalId);
-    std::shared_ptr<BaseActionElement> element = m_parser->Deserialize(context, value);
+    context.PushElement(ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id), internalId);
+    std::shared_ptr<BaseActionElement> element = parser.Deserialize(context, value);
     context.PopElement();
 
     return element;
@@ -35,32 +55,72 @@ std::shared_ptr<BaseActionElement> ActionElementParserWrapper::DeserializeFromSt
     return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
 }
 
-ActionParserRegistration::ActionParserRegistration()
+ActionParserRegistration::ActionParserRegistration() : m_cardElementParsers{GetDefaultParsers()}
+{
+}
+
+const std::shared_ptr<ActionParserRegistration::ParserMap>& ActionParserRegistration::GetDefaultParsers()
+{
+    // never modified in place, as this reference keeps it shared; see GetWritableParsers
+    static const std::shared_ptr<ParserMap> defaultParsers = std::make_shared<ParserMap>(ParserMap{
+        {ActionTypeToString(ActionType::Execute), std::make_shared<ExecuteActionParser>()},
+        {ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>()},
+        {ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>()},
+        {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
+        {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
+        {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}});
+    return defaultParsers;
+}
+
+std::optional<ActionType> ActionParserRegistration::TryGetKnownActionType(std::string_view actionType)
 {
-    m_knownElements.insert({
-        ActionTypeToString(ActionType::Execute),
-        ActionTypeToString(ActionType::OpenUrl),
-        ActionTypeToString(ActionType::ShowCard),
-        ActionTypeToString(ActionType::Submit),
-        ActionTypeToString(ActionType::ToggleVisibility),
-        ActionTypeToString(ActionType::UnknownAction),
-    });
-
-    m_cardElementParsers.insert(
-        {{ActionTypeToString(ActionType::Execute), std::make_shared<ExecuteActionParser>()},
-         {ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>()},
-         {ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>()},
-         {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
-         {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
-         {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}});
+    static const auto knownActionNames = []() {
+        std::array<std::string_view, c_knownActionTypes.size()> names;
+        std::transform(c_knownActionTypes.begin(), c_knownActionTypes.end(), names.begin(), [](ActionType type) {
+            return std::string_view(ActionTypeToString(type));
+        });
+        return names;
+    }();
+
+    for (std::size_t i = 0; i < knownActionNames.size(); ++i)
+    {
+        if (knownActionNames[i].size() == actionType.size() && CaseInsensitiveEqualTo{}(knownActionNames[i], actionType))
+        {
+            return c_knownActionTypes[i];
+        }
+    }
+    return std::nullopt;
+}
+
+ActionElementParser& ActionParserRegistration::GetKnownParser(ActionType actionType)
+{
+    static const auto knownParsers = []() {
+        std::array<ActionElementParser*, static_cast<std::size_t>(ActionType::Overflow) + 1> parsers{};
+        for (const auto type : c_knownActionTypes)
+        {
+            parsers[static_cast<std::size_t>(type)] = GetDefaultParsers()->at(ActionTypeToString(type)).get();
+        }
+        return parsers;
+    }();
+
+    return *knownParsers[static_cast<std::size_t>(actionType)];
+}
+
+ActionParserRegistration::ParserMap& ActionParserRegistration::GetWritableParsers()
+{
+    if (m_cardElementParsers.use_count() > 1)
+    {
+        m_cardElementParsers = std::make_shared<ParserMap>(*m_cardElementParsers);
+    }
+    return *m_cardElementParsers;
 }
 
 void ActionParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<ActionElementParser> parser)
 {
     // make sure caller isn't attempting to overwrite a known element's parser
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (!TryGetKnownActionType(elementType))
     {
-        ActionParserRegistration::m_cardElementParsers[elementType] = parser;
+        GetWritableParsers()[elementType] = parser;
     }
     else
     {
@@ -72,9 +132,9 @@ void ActionParserRegistration::AddParser(std::string const& elementType, std::sh
 void ActionParserRegistration::RemoveParser(std::string const& elementType)
 {
     // make sure caller isn't attempting to remove a known element's parser
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (!TryGetKnownActionType(elementType))
     {
-        ActionParserRegistration::m_cardElementParsers.erase(elementType);
+        GetWritableParsers().erase(elementType);
     }
     else
     {
@@ -85,8 +145,8 @@ void ActionParserRegistration::RemoveParser(std::string const& elementType)
 
 std::shared_ptr<ActionElementParser> ActionParserRegistration::GetParser(std::string const& elementType) const
 {
-    auto parser = m_cardElementParsers.find(elementType);
-    if (parser != ActionParserRegistration::m_cardElementParsers.end())
+    auto parser = m_cardElementParsers->find(elementType);
+    if (parser != m_cardElementParsers->end())
     {
         // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
         // collision detection. We *could* do this within the implementation of parsers themselves, but that would
@@ -31,6 +31,10 @@ public:
 
     std::shared_ptr<BaseActionElement> Deserialize(ParseContext& context, const Json::Value& value) override;
     std::shared_ptr<BaseActionElement> DeserializeFromString(ParseContext& context, const std::string& value) override;
+
+    // Does what Deserialize does for the given parser, without a wrapper having to be made for it
+    static std::shared_ptr<BaseActionElement> DeserializeWithParser(ActionElementParser& parser, ParseContext& context, const Json::Value& value);
+
     std::shared_ptr<ActionElementParser> GetActualParser() const
     {
         return m_parser;
@@ -40,6 +44,8 @@ private:
     std::shared_ptr<ActionElementParser> m_parser;
 };
 
+// Shares the built-in action parsers with every other registration until AddParser or RemoveParser is first called
+// on it; see ElementParserRegistration.
 class ActionParserRegistration
 {
 public:
@@ -49,8 +55,17 @@ public:
     void RemoveParser(std::string const& elementType);
     std::shared_ptr<AdaptiveCards::ActionElementParser> GetParser(std::string const& elementType) const;
 
+    // Built-in action types, looked up without a registration; see ElementParserRegistration::TryGetKnownElementType
+    static std::optional<ActionType> TryGetKnownActionType(std::string_view actionType);
+    static ActionElementParser& GetKnownParser(ActionType actionType);
+
 private:
-    std::unordered_set<std::string> m_knownElements;
-    std::unordered_map<std::string, std::shared_ptr<AdaptiveCards::ActionElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_cardElementParsers;
+    using ParserMap =
+        std::unordered_map<std::string, std::shared_ptr<AdaptiveCards::ActionElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo>;
+
+    static const std::shared_ptr<ParserMap>& GetDefaultParsers();
+    ParserMap& GetWritableParsers();
+
+    std::shared_ptr<ParserMap> m_cardElementParsers;
 };
 } // namespace AdaptiveCards
@@ -29,19 +29,16 @@ const std::vector<std::shared_ptr<BaseActionElement>>& ActionSet::GetActions() c
     return m_actions;
 }
 
-Json::Value ActionSet::SerializeToJsonValue() const
+void ActionSet::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseCardElement::SerializeToJsonValue();
+    BaseCardElement::SerializeProperties(root);
 
-    const std::string& actionsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions);
-    root[actionsPropertyName] = Json::Value(Json::arrayValue);
-
-    for (const auto& actionElement : m_actions)
-    {
-        root[actionsPropertyName].append(actionElement->SerializeToJsonValue());
-    }
+    root.SetArray(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions), m_actions);
+}
 
-    return root;
+void ActionSet::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::shared_ptr<BaseCardElement> ActionSetParser::Deserialize(ParseContext& context, const Json::Value& value)
@@ -64,5 +61,6 @@ std::shared_ptr<BaseCardElement> ActionSetParser::DeserializeFromString(ParseCon
 
 void ActionSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions));
+    static const auto knownProperties = ExtendKnownProperties({AdaptiveCardSchemaKey::Actions});
+    m_knownProperties = &knownProperties;
 }
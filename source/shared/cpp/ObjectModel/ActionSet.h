@@ -17,11 +17,13 @@ public:
     ActionSet();
     ActionSet(std::vector<std::shared_ptr<BaseActionElement>>& actions);
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::vector<std::shared_ptr<BaseActionElement>>& GetActions();
     const std::vector<std::shared_ptr<BaseActionElement>>& GetActions() const;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
+
 private:
     void PopulateKnownPropertiesSet();
     std::vector<std::shared_ptr<AdaptiveCards::BaseActionElement>> m_actions;
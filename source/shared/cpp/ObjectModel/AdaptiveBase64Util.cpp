@@ -49,7 +49,23 @@ const unsigned char c_base64DecodeTable[] = {
     0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
     0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, // Printable characters:  96 - 111 (@ to o)
     0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30,
-    0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF // Printable characters: 112 - 127 (p to DEL)
+    0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // Printable characters: 112 - 127 (p to DEL)
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // Everything else:      128 - 255
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
 };
 } // namespace
 
@@ -66,7 +82,7 @@ size_t AdaptiveBase64Util::DecodedLength(const char* in, size_t in_length)
     return ((6 * in_length) / 8) - numEq;
 }
 
-size_t AdaptiveBase64Util::DecodedLength(const std::string& in)
+size_t AdaptiveBase64Util::DecodedLength(std::string_view in)
 {
     size_t numEq{};
     size_t n{in.size()};
@@ -76,7 +92,8 @@ size_t AdaptiveBase64Util::DecodedLength(const std::string& in)
         ++numEq;
     }
 
-    return ((6 * n) / 8) - numEq;
+    // all padding (e.g. "==") decodes to nothing
+    return std::max((6 * n) / 8, numEq) - numEq;
 }
 
 size_t AdaptiveBase64Util::EncodedLength(size_t length)
@@ -97,14 +114,6 @@ void AdaptiveBase64Util::StripPadding(std::string* in)
     }
 }
 
-void AdaptiveBase64Util::a3_to_a4(unsigned char* a4, unsigned char* a3)
-{
-    a4[0] = (a3[0] & 0xfc) >> 2;
-    a4[1] = ((a3[0] & 0x03) << 4) + ((a3[1] & 0xf0) >> 4);
-    a4[2] = ((a3[1] & 0x0f) << 2) + ((a3[2] & 0xc0) >> 6);
-    a4[3] = (a3[2] & 0x3f);
-}
-
 void AdaptiveBase64Util::a4_to_a3(unsigned char* a3, unsigned char* a4)
 {
     a3[0] = (a4[0] << 2) + ((a4[1] & 0x30) >> 4);
@@ -114,65 +123,51 @@ void AdaptiveBase64Util::a4_to_a3(unsigned char* a3, unsigned char* a4)
 
 unsigned char AdaptiveBase64Util::b64_lookup(unsigned char c)
 {
-    if (c < std::extent<decltype(c_base64DecodeTable)>::value)
-    {
-        return c_base64DecodeTable[c];
-    }
-
-    return 0xFF;
+    // the table covers every unsigned char
+    static_assert(std::extent<decltype(c_base64DecodeTable)>::value == 256, "base64 decode table must cover every char");
+    return c_base64DecodeTable[c];
 }
 
 bool AdaptiveBase64Util::Encode(const std::vector<char>& in, std::string* out)
 {
     out->resize(EncodedLength(in));
-
-    size_t input_len{in.size()};
-    auto input = in.begin();
-
-    int i{};
-    size_t enc_len{};
-    unsigned char a3[3];
-    unsigned char a4[4];
-    while (input_len--)
+    if (in.empty())
     {
-        a3[i++] = *(input++);
-        if (i == 3)
-        {
-            a3_to_a4(a4, a3);
+        return true;
+    }
 
-            for (i = 0; i < 4; ++i)
-            {
-                (*out)[enc_len++] = c_base64EncodeTable[a4[i]];
-            }
+    const unsigned char* input = reinterpret_cast<const unsigned char*>(in.data());
+    const unsigned char* const inputEnd = input + in.size();
+    char* output = &(*out)[0];
 
-            i = 0;
-        }
+    // whole groups of three bytes
+    for (; inputEnd - input >= 3; input += 3, output += 4)
+    {
+        const unsigned int group = (input[0] << 16) | (input[1] << 8) | input[2];
+        output[0] = c_base64EncodeTable[group >> 18];
+        output[1] = c_base64EncodeTable[(group >> 12) & 0x3F];
+        output[2] = c_base64EncodeTable[(group >> 6) & 0x3F];
+        output[3] = c_base64EncodeTable[group & 0x3F];
     }
 
-    if (i)
+    // one or two bytes left over are padded with '='
+    if (input != inputEnd)
     {
-        for (int j{i}; j < 3; ++j)
-        {
-            a3[j] = '\0';
-        }
-
-        a3_to_a4(a4, a3);
-
-        for (int j{}; j < i + 1; ++j)
-        {
-            (*out)[enc_len++] = c_base64EncodeTable[a4[j]];
-        }
-
-        while ((i++ < 3))
-        {
-            (*out)[enc_len++] = '=';
-        }
+        const bool hasSecondByte = (inputEnd - input) == 2;
+        const unsigned int group = (input[0] << 16) | (hasSecondByte ? (input[1] << 8) : 0);
+        output[0] = c_base64EncodeTable[group >> 18];
+        output[1] = c_base64EncodeTable[(group >> 12) & 0x3F];
+        output[2] = hasSecondByte ? c_base64EncodeTable[(group >> 6) & 0x3F] : '=';
+        output[3] = '=';
+        output += 4;
     }
 
-    return (enc_len == out->size());
+    return (output == out->data() + out->size());
 }
 
-bool AdaptiveBase64Util::Decode(const std::string& in, std::vector<char>* out)
+// The lenient decoder used for text that DecodeTo rejects. It stops at the first '=' and maps anything that isn't a base64
+// char to garbage rather than failing.
+bool AdaptiveBase64Util::Decode(std::string_view in, std::vector<char>* out)
 {
     size_t input_len{in.size()};
     auto input = in.begin();
@@ -200,7 +195,8 @@ bool AdaptiveBase64Util::Decode(const std::string& in, std::vector<char>* out)
 
             a4_to_a3(a3, a4);
 
-            for (i = 0; i < 3; ++i)
+            // text with '=' in the middle can decode to more than DecodedLength accounted for
+            for (i = 0; i < 3 && dec_len < out->size(); ++i)
             {
                 (*out)[dec_len++] = a3[i];
             }
@@ -223,7 +219,7 @@ bool AdaptiveBase64Util::Decode(const std::string& in, std::vector<char>* out)
 
         a4_to_a3(a3, a4);
 
-        for (int j{}; j < i - 1; ++j)
+        for (int j{}; j < i - 1 && dec_len < out->size(); ++j)
         {
             (*out)[dec_len++] = a3[j];
         }
@@ -232,13 +228,89 @@ bool AdaptiveBase64Util::Decode(const std::string& in, std::vector<char>* out)
     return (dec_len == out->size());
 }
 
-std::vector<char> AdaptiveBase64Util::Decode(const std::string& encodedBase64)
+std::vector<char> AdaptiveBase64Util::Decode(std::string_view encodedBase64)
 {
-    std::vector<char> decodedString;
-    Decode(encodedBase64, &decodedString);
+    std::vector<char> decodedString(GetMaxDecodedLength(encodedBase64));
+    if (const auto decodedLength = DecodeTo(encodedBase64, decodedString.data()))
+    {
+        decodedString.resize(*decodedLength);
+    }
+    else
+    {
+        Decode(encodedBase64, &decodedString);
+    }
     return decodedString;
 }
 
+size_t AdaptiveBase64Util::GetMaxDecodedLength(std::string_view encodedBase64)
+{
+    return (encodedBase64.size() + 3) / 4 * 3;
+}
+
+std::optional<size_t> AdaptiveBase64Util::DecodeTo(std::string_view encodedBase64, char* out)
+{
+    size_t length = encodedBase64.size();
+    size_t padding = 0;
+    if (length % 4 == 0)
+    {
+        while (padding < 2 && padding < length && encodedBase64[length - padding - 1] == '=')
+        {
+            ++padding;
+        }
+        length -= padding;
+    }
+
+    // a lone char at the end doesn't make a byte, and padding has to fill the last group up to exactly four chars
+    if ((length % 4 == 1) || (padding && (length % 4) + padding != 4))
+    {
+        return std::nullopt;
+    }
+
+    const unsigned char* input = reinterpret_cast<const unsigned char*>(encodedBase64.data());
+    const unsigned char* const inputEnd = input + length;
+    unsigned char* output = reinterpret_cast<unsigned char*>(out);
+
+    // whole groups of four chars; invalid chars have the high bit set in the table, so one test per group catches them
+    for (; inputEnd - input >= 4; input += 4, output += 3)
+    {
+        const unsigned int a = b64_lookup(input[0]);
+        const unsigned int b = b64_lookup(input[1]);
+        const unsigned int c = b64_lookup(input[2]);
+        const unsigned int d = b64_lookup(input[3]);
+        if ((a | b | c | d) & 0x80)
+        {
+            return std::nullopt;
+        }
+
+        const unsigned int group = (a << 18) | (b << 12) | (c << 6) | d;
+        output[0] = static_cast<unsigned char>(group >> 16);
+        output[1] = static_cast<unsigned char>(group >> 8);
+        output[2] = static_cast<unsigned char>(group);
+    }
+
+    // two or three chars left over make one or two bytes
+    if (input != inputEnd)
+    {
+        const bool hasThirdChar = (inputEnd - input) == 3;
+        const unsigned int a = b64_lookup(input[0]);
+        const unsigned int b = b64_lookup(input[1]);
+        const unsigned int c = hasThirdChar ? b64_lookup(input[2]) : 0;
+        if ((a | b | c) & 0x80)
+        {
+            return std::nullopt;
+        }
+
+        const unsigned int group = (a << 18) | (b << 12) | (c << 6);
+        *output++ = static_cast<unsigned char>(group >> 16);
+        if (hasThirdChar)
+        {
+            *output++ = static_cast<unsigned char>(group >> 8);
+        }
+    }
+
+    return static_cast<size_t>(output - reinterpret_cast<unsigned char*>(out));
+}
+
 std::string AdaptiveBase64Util::Encode(const std::vector<char>& decodedBase64)
 {
     std::string encodedString;
@@ -249,6 +321,11 @@ std::string AdaptiveBase64Util::Encode(const std::vector<char>& decodedBase64)
 // Format for DataURI is data:[<MediaType>][;base64],data with MediaType and base64 being optional and data is composed of [A-Z a-z 0-9 + /] characters
 std::string AdaptiveBase64Util::ExtractDataFromUri(const std::string& dataUri)
 {
-    size_t comaPosition = dataUri.find_last_of(",");
+    return std::string(GetDataFromUri(dataUri));
+}
+
+std::string_view AdaptiveBase64Util::GetDataFromUri(std::string_view dataUri)
+{
+    size_t comaPosition = dataUri.find_last_of(',');
     return dataUri.substr(comaPosition + 1);
 }
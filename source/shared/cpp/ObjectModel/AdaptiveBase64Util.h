@@ -14,20 +14,32 @@ class AdaptiveBase64Util
 {
 private:
     static size_t DecodedLength(const char* in, size_t in_length);
-    static size_t DecodedLength(const std::string& in);
+    static size_t DecodedLength(std::string_view in);
     static inline size_t EncodedLength(size_t length);
     static inline size_t EncodedLength(const std::vector<char>& in);
     static inline void StripPadding(std::string* in);
-    static inline void a3_to_a4(unsigned char* a4, unsigned char* a3);
     static inline void a4_to_a3(unsigned char* a3, unsigned char* a4);
     static inline unsigned char b64_lookup(unsigned char c);
     static bool Encode(const std::vector<char>& in, std::string* out);
-    static bool Decode(const std::string& in, std::vector<char>* out);
 
 public:
-    static std::vector<char> Decode(const std::string& encodedBase64);
+    // The lenient decoder Decode falls back on for text that DecodeTo rejects, one char at a time: it stops at the
+    // first '=' and decodes anything that isn't base64 to garbage rather than failing. Resizes out to fit.
+    static bool Decode(std::string_view in, std::vector<char>* out);
+
+    static std::vector<char> Decode(std::string_view encodedBase64);
     static std::string Encode(const std::vector<char>& decodedBase64);
 
     static std::string ExtractDataFromUri(const std::string& dataUri);
+
+    // The base64 part of a data URI, without copying it
+    static std::string_view GetDataFromUri(std::string_view dataUri);
+
+    // The number of bytes DecodeTo may write for the given base64 text
+    static size_t GetMaxDecodedLength(std::string_view encodedBase64);
+
+    // Decodes base64 text into out, which must have room for GetMaxDecodedLength bytes, and returns the number of bytes
+    // written. Returns std::nullopt if the text isn't base64 (padding is optional, whitespace isn't allowed).
+    static std::optional<size_t> DecodeTo(std::string_view encodedBase64, char* out);
 };
 } // namespace AdaptiveCards
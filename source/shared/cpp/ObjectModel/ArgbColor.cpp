@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ArgbColor.h"
+
+namespace AdaptiveCards
+{
+namespace
+{
+    // the value of each hex digit, and 0xFF for every other byte
+    constexpr std::array<std::uint8_t, 256> c_hexDigitValues = []() {
+        std::array<std::uint8_t, 256> values{};
+        for (auto& value : values)
+        {
+            value = 0xFF;
+        }
+        for (int i = 0; i < 10; ++i)
+        {
+            values['0' + i] = static_cast<std::uint8_t>(i);
+        }
+        for (int i = 0; i < 6; ++i)
+        {
+            values['a' + i] = values['A' + i] = static_cast<std::uint8_t>(10 + i);
+        }
+        return values;
+    }();
+} // namespace
+
+std::optional<ArgbColor> ArgbColor::TryParse(std::string_view color)
+{
+    if ((color.size() != 7 && color.size() != 9) || color[0] != '#')
+    {
+        return std::nullopt;
+    }
+
+    std::uint32_t argb = 0;
+    std::uint8_t invalid = 0;
+    for (size_t i = 1; i < color.size(); ++i)
+    {
+        const std::uint8_t digit = c_hexDigitValues[static_cast<unsigned char>(color[i])];
+        invalid |= digit;
+        argb = (argb << 4) | (digit & 0xF);
+    }
+
+    // any byte that isn't a hex digit sets the high bits
+    if (invalid > 0xF)
+    {
+        return std::nullopt;
+    }
+    return ArgbColor((color.size() == 7) ? (argb | 0xFF000000) : argb);
+}
+
+ArgbColor ArgbColor::FromString(std::string_view color)
+{
+    return TryParse(color).value_or(ArgbColor{});
+}
+
+std::string ArgbColor::ToString() const
+{
+    static constexpr char c_hexDigits[] = "0123456789ABCDEF";
+
+    std::string color(9, '#');
+    for (size_t i = 8; i > 0; --i)
+    {
+        color[i] = c_hexDigits[(_argb >> ((8 - i) * 4)) & 0xF];
+    }
+    return color;
+}
+} // namespace AdaptiveCards
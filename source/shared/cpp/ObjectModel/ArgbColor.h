@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// A color packed into 32 bits as 0xAARRGGBB, so that renderers can use a color without parsing hex themselves. The
+// object model keeps colors as the strings they were written as: Image decodes its background color whenever it's set,
+// HostConfig's Get*ColorArgb decode theirs on every call, and ResolvedHostConfig decodes each one once when it's built.
+// A default constructed ArgbColor is transparent black.
+class ArgbColor
+{
+public:
+    constexpr ArgbColor() = default;
+    constexpr explicit ArgbColor(std::uint32_t argb) : _argb(argb) {}
+
+    // Decodes #RRGGBB or #AARRGGBB (hex digits in either case), with #RRGGBB taken as opaque
+    static std::optional<ArgbColor> TryParse(std::string_view color);
+    // TryParse, with anything it can't decode (including an empty string) read as transparent black
+    static ArgbColor FromString(std::string_view color);
+
+    constexpr std::uint32_t GetArgb() const { return _argb; }
+    constexpr std::uint8_t GetAlpha() const { return static_cast<std::uint8_t>(_argb >> 24); }
+    constexpr std::uint8_t GetRed() const { return static_cast<std::uint8_t>(_argb >> 16); }
+    constexpr std::uint8_t GetGreen() const { return static_cast<std::uint8_t>(_argb >> 8); }
+    constexpr std::uint8_t GetBlue() const { return static_cast<std::uint8_t>(_argb); }
+
+    // #AARRGGBB, with upper case hex digits
+    std::string ToString() const;
+
+private:
+    std::uint32_t _argb = 0;
+};
+
+constexpr bool operator==(ArgbColor lhs, ArgbColor rhs)
+{
+    return lhs.GetArgb() == rhs.GetArgb();
+}
+
+constexpr bool operator!=(ArgbColor lhs, ArgbColor rhs)
+{
+    return !(lhs == rhs);
+}
+} // namespace AdaptiveCards
@@ -115,7 +115,7 @@ Json::Value Authentication::SerializeToJsonValue() const
 
 std::shared_ptr<Authentication> Authentication::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<Authentication> authentication = std::make_shared<Authentication>();
+    std::shared_ptr<Authentication> authentication = context.MakeShared<Authentication>();
 
     authentication->SetText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Text));
     authentication->SetConnectionName(ParseUtil::GetString(json, AdaptiveCardSchemaKey::ConnectionName));
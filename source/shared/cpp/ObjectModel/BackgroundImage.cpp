@@ -12,6 +12,11 @@ std::string BackgroundImage::GetUrl() const
     return m_url;
 }
 
+void BackgroundImage::SetUrl(std::string&& value)
+{
+    m_url = std::move(value);
+}
+
 void BackgroundImage::SetUrl(const std::string& value)
 {
     m_url = value;
@@ -118,13 +123,13 @@ std::shared_ptr<BackgroundImage> BackgroundImage::Deserialize(const Json::Value&
     image->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
 
     image->SetFillMode(ParseUtil::GetEnumValue<ImageFillMode>(
-        json, AdaptiveCardSchemaKey::FillMode, ImageFillMode::Cover, ImageFillModeFromString));
+        json, AdaptiveCardSchemaKey::FillMode, ImageFillMode::Cover, ImageFillModeTryFromString));
 
     image->SetHorizontalAlignment(ParseUtil::GetEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignment::Left, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignment::Left, HorizontalAlignmentTryFromString));
 
     image->SetVerticalAlignment(ParseUtil::GetEnumValue<VerticalAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalAlignment, VerticalAlignment::Top, VerticalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::VerticalAlignment, VerticalAlignment::Top, VerticalAlignmentTryFromString));
 
     return image;
 }
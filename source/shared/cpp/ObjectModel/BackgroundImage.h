@@ -23,6 +23,7 @@ public:
     }
 
     std::string GetUrl() const;
+    void SetUrl(std::string&& value);
     void SetUrl(const std::string& value);
     ImageFillMode GetFillMode() const;
     void SetFillMode(const ImageFillMode& value);
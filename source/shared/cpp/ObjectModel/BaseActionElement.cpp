@@ -101,9 +101,9 @@ Mode BaseActionElement::GetMode() const
     return m_mode;
 }
 
-Json::Value BaseActionElement::SerializeToJsonValue() const
+void BaseActionElement::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseElement::SerializeToJsonValue();
+    BaseElement::SerializeProperties(root);
 
     if (!m_iconUrl.empty())
     {
@@ -133,19 +133,18 @@ Json::Value BaseActionElement::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsEnabled)] = m_isEnabled;
     }
-
-    return root;
 }
 
 void BaseActionElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Mode),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Tooltip),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsEnabled)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::IconUrl,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Title,
+         AdaptiveCardSchemaKey::Mode,
+         AdaptiveCardSchemaKey::Tooltip,
+         AdaptiveCardSchemaKey::IsEnabled});
+    m_knownProperties = &knownProperties;
 }
 
 void BaseActionElement::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -171,7 +170,7 @@ std::shared_ptr<BaseActionElement> BaseActionElement::DeserializeBasePropertiesF
 
 std::shared_ptr<BaseActionElement> BaseActionElement::DeserializeBaseProperties(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<BaseActionElement> baseActionElement = std::make_shared<BaseActionElement>();
+    std::shared_ptr<BaseActionElement> baseActionElement = context.MakeShared<BaseActionElement>();
     DeserializeBaseProperties(context, json, baseActionElement);
     return baseActionElement;
 }
@@ -184,7 +183,7 @@ void BaseActionElement::DeserializeBaseProperties(ParseContext& context, const J
     element->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title));
     element->SetIconUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::IconUrl));
     element->SetStyle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Style, defaultStyle, false));
-    element->SetMode(ParseUtil::GetEnumValue<Mode>(json, AdaptiveCardSchemaKey::Mode, Mode::Primary, ModeFromString));
+    element->SetMode(ParseUtil::GetEnumValue<Mode>(json, AdaptiveCardSchemaKey::Mode, Mode::Primary, ModeTryFromString));
     element->SetTooltip(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Tooltip));
     element->SetIsEnabled(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsEnabled, true));
 }
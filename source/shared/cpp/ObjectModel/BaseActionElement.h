@@ -52,7 +52,6 @@ public:
     void SetIsEnabled(const bool isEnabled);
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceUris) override;
-    Json::Value SerializeToJsonValue() const override;
 
     template <typename T>
     static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& json);
@@ -62,6 +61,9 @@ public:
 
     static void ParseJsonObject(AdaptiveCards::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element);
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     void PopulateKnownPropertiesSet();
     static void DeserializeBaseProperties(ParseContext& context, const Json::Value& json, std::shared_ptr<BaseActionElement>& element);
@@ -82,12 +84,12 @@ private:
 template <typename T>
 std::shared_ptr<T> BaseActionElement::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<T> cardElement = std::make_shared<T>();
+    std::shared_ptr<T> cardElement = context.MakeShared<T>();
     std::shared_ptr<BaseActionElement> baseActionElement = std::static_pointer_cast<BaseActionElement>(cardElement);
     DeserializeBaseProperties(context, json, baseActionElement);
 
     // Walk all properties and put any unknown ones in the additional properties json
-    HandleUnknownProperties(json, baseActionElement->m_knownProperties, baseActionElement->m_additionalProperties);
+    HandleUnknownProperties(json, *baseActionElement->m_knownProperties, baseActionElement->m_additionalProperties);
 
     return cardElement;
 }
@@ -27,12 +27,13 @@ BaseCardElement::BaseCardElement(CardElementType type) :
 
 void BaseCardElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Separator),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::IsVisible,
+         AdaptiveCardSchemaKey::MinHeight,
+         AdaptiveCardSchemaKey::Separator,
+         AdaptiveCardSchemaKey::Spacing});
+    m_knownProperties = &knownProperties;
 }
 
 bool BaseCardElement::GetSeparator() const
@@ -80,9 +81,9 @@ CardElementType BaseCardElement::GetElementType() const
     return m_type;
 }
 
-Json::Value BaseCardElement::SerializeToJsonValue() const
+void BaseCardElement::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseElement::SerializeToJsonValue();
+    BaseElement::SerializeProperties(root);
 
     if (m_height != HeightType::Auto)
     {
@@ -103,8 +104,6 @@ Json::Value BaseCardElement::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible)] = false;
     }
-
-    return root;
 }
 
 Json::Value BaseCardElement::SerializeSelectAction(const std::shared_ptr<BaseActionElement>& selectAction)
@@ -118,22 +117,32 @@ Json::Value BaseCardElement::SerializeSelectAction(const std::shared_ptr<BaseAct
 
 void BaseCardElement::ParseJsonObject(AdaptiveCards::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element)
 {
-    const std::string typeString = ParseUtil::GetTypeAsString(json);
-    std::shared_ptr<BaseCardElementParser> parser = context.elementParserRegistration->GetParser(typeString);
-
-    if (parser == nullptr)
+    // Built-in types, which are most of what we see, go straight to their parsers. Only custom types are looked up in
+    // the context's registration.
+    std::shared_ptr<BaseCardElement> parsedElement;
+    if (const auto knownType = ElementParserRegistration::TryGetKnownElementType(ParseUtil::GetTypeAsStringView(json)))
+    {
+        parsedElement = BaseCardElementParserWrapper::DeserializeWithParser(
+            ElementParserRegistration::GetKnownParser(*knownType), context, json);
+    }
+    else if (const auto parser = context.elementParserRegistration->GetParser(ParseUtil::GetTypeAsString(json)))
+    {
+        parsedElement = parser->Deserialize(context, json);
+    }
+    else
     {
-        parser = context.elementParserRegistration->GetParser("Unknown");
+        parsedElement = BaseCardElementParserWrapper::DeserializeWithParser(
+            ElementParserRegistration::GetKnownParser(CardElementType::Unknown), context, json);
     }
 
-    auto parsedElement = parser->Deserialize(context, json);
     if (parsedElement != nullptr)
     {
         element = std::move(parsedElement);
         return;
     }
 
-    throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + typeString);
+    throw AdaptiveCardParseException(
+        ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + ParseUtil::GetTypeAsString(json));
 }
 
 std::shared_ptr<BaseCardElement> BaseCardElement::DeserializeBasePropertiesFromString(ParseContext& context, const std::string& jsonString)
@@ -143,7 +152,7 @@ std::shared_ptr<BaseCardElement> BaseCardElement::DeserializeBasePropertiesFromS
 
 std::shared_ptr<BaseCardElement> BaseCardElement::DeserializeBaseProperties(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<BaseCardElement> baseCardElement = std::make_shared<BaseCardElement>();
+    std::shared_ptr<BaseCardElement> baseCardElement = context.MakeShared<BaseCardElement>();
     DeserializeBaseProperties(context, json, baseCardElement);
     return baseCardElement;
 }
@@ -154,8 +163,8 @@ void BaseCardElement::DeserializeBaseProperties(ParseContext& context, const Jso
 
     element->DeserializeBase<BaseCardElement>(context, json);
     element->SetCanFallbackToAncestor(context.GetCanFallbackToAncestor());
-    element->SetHeight(ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeFromString));
+    element->SetHeight(ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeTryFromString));
     element->SetIsVisible(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsVisible, true));
     element->SetSeparator(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Separator, false));
-    element->SetSpacing(ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, Spacing::Default, SpacingFromString));
+    element->SetSpacing(ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, Spacing::Default, SpacingTryFromString));
 }
@@ -26,8 +26,6 @@ public:
     BaseCardElement& operator=(BaseCardElement&&) = default;
     ~BaseCardElement() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     virtual bool GetSeparator() const;
     virtual void SetSeparator(bool value);
 
@@ -51,6 +49,7 @@ public:
     static void ParseJsonObject(AdaptiveCards::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element);
 
 protected:
+    void SerializeProperties(JsonMembers& root) const override;
     static Json::Value SerializeSelectAction(const std::shared_ptr<BaseActionElement>& selectAction);
 
 private:
@@ -67,12 +66,12 @@ private:
 template <typename T>
 std::shared_ptr<T> BaseCardElement::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<T> cardElement = std::make_shared<T>();
+    std::shared_ptr<T> cardElement = context.MakeShared<T>();
     std::shared_ptr<BaseCardElement> baseCardElement = std::static_pointer_cast<BaseCardElement>(cardElement);
     DeserializeBaseProperties(context, json, baseCardElement);
 
     // Walk all properties and put any unknown ones in the additional properties json
-    HandleUnknownProperties(json, baseCardElement->m_knownProperties, baseCardElement->m_additionalProperties);
+    HandleUnknownProperties(json, *baseCardElement->m_knownProperties, baseCardElement->m_additionalProperties);
 
     return cardElement;
 }
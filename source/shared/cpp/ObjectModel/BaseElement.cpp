@@ -3,12 +3,14 @@
 #include "pch.h"
 
 #include "BaseElement.h"
+#include "ParseInstrumentation.h"
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
 
 namespace AdaptiveCards
 {
-unsigned int InternalId::s_currentInternalId = 1;
+std::atomic<unsigned int> InternalId::s_lastAllocatedInternalId{1};
+thread_local unsigned int InternalId::s_currentInternalId = 1;
 
 InternalId InternalId::Current()
 {
@@ -18,14 +20,15 @@ InternalId InternalId::Current()
 
 InternalId InternalId::Next()
 {
-    s_currentInternalId++;
+    unsigned int nextId = ++s_lastAllocatedInternalId;
 
     // handle overflow case
-    if (s_currentInternalId == InternalId::Invalid)
+    if (nextId == InternalId::Invalid)
     {
-        s_currentInternalId++;
+        nextId = ++s_lastAllocatedInternalId;
     }
 
+    s_currentInternalId = nextId;
     return Current();
 }
 
@@ -39,7 +42,28 @@ InternalId::InternalId(const unsigned int id) : m_internalId{id}
 
 std::string BaseElement::Serialize() const
 {
-    return ParseUtil::JsonToString(SerializeToJsonValue());
+    std::string output;
+    JsonWriter writer(output);
+    Serialize(writer);
+    output.push_back('\n');
+    return output;
+}
+
+void BaseElement::Serialize(JsonWriter& writer) const
+{
+    WriteJson(writer);
+}
+
+void BaseElement::WriteJson(JsonWriter& writer) const
+{
+    writer.WriteValue(SerializeToJsonValue());
+}
+
+void BaseElement::WriteProperties(JsonWriter& writer) const
+{
+    JsonMembers root(m_additionalProperties);
+    SerializeProperties(root);
+    root.Write(writer);
 }
 
 const std::string& BaseElement::GetId() const
@@ -72,11 +96,24 @@ void BaseElement::SetElementTypeString(const std::string& value)
 
 void BaseElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const std::unordered_set<std::string> knownProperties{
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)};
+    m_knownProperties = &knownProperties;
+}
+
+// Returns the currently installed known properties plus the given keys. Derived types call this once, from the
+// function-local static in their PopulateKnownPropertiesSet, to build the table shared by all of their instances.
+std::unordered_set<std::string> BaseElement::ExtendKnownProperties(std::initializer_list<AdaptiveCardSchemaKey> keys) const
+{
+    std::unordered_set<std::string> knownProperties{*m_knownProperties};
+    for (const auto key : keys)
+    {
+        knownProperties.insert(AdaptiveCardSchemaKeyToString(key));
+    }
+    return knownProperties;
 }
 
 const Json::Value& BaseElement::GetAdditionalProperties() const
@@ -134,9 +171,13 @@ const std::unordered_map<std::string, AdaptiveCards::SemanticVersion>& BaseEleme
 
 Json::Value BaseElement::SerializeToJsonValue() const
 {
-    Json::Value root = GetAdditionalProperties(); // Create a copy of the additional properties by assigning the
-                                                  // return value to a value, rather than reference, type
+    JsonMembers root(m_additionalProperties);
+    SerializeProperties(root);
+    return root.ToJsonValue();
+}
 
+void BaseElement::SerializeProperties(JsonMembers& root) const
+{
     // Important -- we're explicitly getting the type as a string here because that's where we store the type that
     // was specified by the card author.
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = GetElementTypeString();
@@ -153,7 +194,7 @@ Json::Value BaseElement::SerializeToJsonValue() const
     }
     else if (m_fallbackType == FallbackType::Content)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback)] = m_fallbackContent->SerializeToJsonValue();
+        root.SetObject(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback), *m_fallbackContent);
     }
 
     // Handle requires
@@ -167,8 +208,6 @@ Json::Value BaseElement::SerializeToJsonValue() const
 
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires)] = jsonRequires;
     }
-
-    return root;
 }
 
 // Base implementation for elements that have no resource information
@@ -177,9 +216,22 @@ void BaseElement::GetResourceInformation(std::vector<RemoteResourceInformation>&
     return;
 }
 
+void BaseElement::ReportFallback(ParseContext& context, FallbackType fallbackType)
+{
+#ifndef ADAPTIVECARDS_DISABLE_PARSE_INSTRUMENTATION
+    if (auto instrumentation = context.GetInstrumentation())
+    {
+        instrumentation->OnFallback(fallbackType);
+    }
+#else
+    (void)context;
+    (void)fallbackType;
+#endif
+}
+
 void BaseElement::ParseRequires(ParseContext& /*context*/, const Json::Value& json)
 {
-    const auto requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
+    const auto& requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
     if (!requiresValue.isNull())
     {
         if (requiresValue.isObject())
@@ -5,6 +5,7 @@
 #include "pch.h"
 #include "json/json.h"
 #include "InternalId.h"
+#include "JsonWriter.h"
 #include "ParseContext.h"
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
@@ -54,6 +55,8 @@ public:
 
     virtual std::string Serialize() const;
     virtual Json::Value SerializeToJsonValue() const;
+    // Writes out the json that SerializeToJsonValue returns, without building it
+    void Serialize(JsonWriter& writer) const;
     const Json::Value& GetAdditionalProperties() const;
     void SetAdditionalProperties(Json::Value&& additionalProperties);
     void SetAdditionalProperties(const Json::Value& additionalProperties);
@@ -102,14 +105,30 @@ protected:
         m_canFallbackToAncestor = value;
     }
 
+    std::unordered_set<std::string> ExtendKnownProperties(std::initializer_list<AdaptiveCardSchemaKey> keys) const;
+
+    // Sets this element's properties over its additional properties in root. Each type adds its own to those of the
+    // type it derives from, and both SerializeToJsonValue and Serialize(JsonWriter&) are built on it.
+    virtual void SerializeProperties(JsonMembers& root) const;
+
+    // How Serialize(JsonWriter&) writes this element: by default, whatever SerializeToJsonValue returns, since types
+    // from outside this library may override just that. The types here that have nothing more to say than
+    // SerializeProperties does override this with a call to WriteProperties.
+    virtual void WriteJson(JsonWriter& writer) const;
+    void WriteProperties(JsonWriter& writer) const;
+
     std::string m_typeString;
-    std::unordered_set<std::string> m_knownProperties;
+    // Known properties are tracked per element type rather than per instance. Each type's constructor calls its
+    // PopulateKnownPropertiesSet, which builds the type's set once (extending the set installed by the base class
+    // constructor) and points this member at it.
+    const std::unordered_set<std::string>* m_knownProperties;
     Json::Value m_additionalProperties;
 
 private:
     template <typename T>
     void ParseFallback(ParseContext& context, const Json::Value& json);
     void ParseRequires(ParseContext& context, const Json::Value& json);
+    static void ReportFallback(ParseContext& context, FallbackType fallbackType);
     void PopulateKnownPropertiesSet();
 
     std::unordered_map<std::string, AdaptiveCards::SemanticVersion> m_requires;
@@ -135,7 +154,7 @@ void BaseElement::DeserializeBase(ParseContext& context, const Json::Value& json
 template <typename T>
 void BaseElement::ParseFallback(ParseContext& context, const Json::Value& json)
 {
-    const auto fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
+    const auto& fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
     if (!fallbackValue.empty())
     {
         // Two possible valid json values for fallback -- either the string "drop", or a valid Adaptive Card
@@ -146,6 +165,7 @@ void BaseElement::ParseFallback(ParseContext& context, const Json::Value& json)
             if (fallbackStringValue == "drop")
             {
                 m_fallbackType = FallbackType::Drop;
+                ReportFallback(context, m_fallbackType);
                 return;
             }
             throw AdaptiveCardParseException(
@@ -165,6 +185,7 @@ void BaseElement::ParseFallback(ParseContext& context, const Json::Value& json)
             {
                 m_fallbackType = FallbackType::Content;
                 m_fallbackContent = fallbackElement;
+                ReportFallback(context, m_fallbackType);
                 return;
             }
             throw AdaptiveCardParseException(
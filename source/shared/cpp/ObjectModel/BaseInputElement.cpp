@@ -27,9 +27,9 @@ std::string BaseInputElement::GetLabel() const
     return m_label;
 }
 
-void BaseInputElement::SetLabel(const std::string label)
+void BaseInputElement::SetLabel(std::string label)
 {
-    m_label = label;
+    m_label = std::move(label);
 }
 
 bool BaseInputElement::GetIsRequired() const
@@ -47,14 +47,14 @@ std::string BaseInputElement::GetErrorMessage() const
     return m_errorMessage;
 }
 
-void BaseInputElement::SetErrorMessage(const std::string errorMessage)
+void BaseInputElement::SetErrorMessage(std::string errorMessage)
 {
-    m_errorMessage = errorMessage;
+    m_errorMessage = std::move(errorMessage);
 }
 
-Json::Value BaseInputElement::SerializeToJsonValue() const
+void BaseInputElement::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseCardElement::SerializeToJsonValue();
+    BaseCardElement::SerializeProperties(root);
 
     if (m_isRequired)
     {
@@ -70,16 +70,20 @@ Json::Value BaseInputElement::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Label)] = m_label;
     }
+}
 
-    return root;
+void BaseInputElement::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 void BaseInputElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsRequired),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ErrorMessage),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Label)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::IsRequired,
+         AdaptiveCardSchemaKey::ErrorMessage,
+         AdaptiveCardSchemaKey::Label});
+    m_knownProperties = &knownProperties;
 }
 
 std::shared_ptr<BaseInputElement> BaseInputElement::DeserializeBasePropertiesFromString(ParseContext& context, const std::string& jsonString)
@@ -20,18 +20,20 @@ public:
     static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& json);
 
     std::string GetLabel() const;
-    void SetLabel(const std::string label);
+    void SetLabel(std::string label);
 
     bool GetIsRequired() const;
     void SetIsRequired(const bool isRequired);
 
     std::string GetErrorMessage() const;
-    void SetErrorMessage(const std::string errorMessage);
+    void SetErrorMessage(std::string errorMessage);
 
     static std::shared_ptr<BaseInputElement> DeserializeBasePropertiesFromString(ParseContext& context, const std::string& jsonString);
     static std::shared_ptr<BaseInputElement> DeserializeBaseProperties(ParseContext& context, const Json::Value& json);
 
-    Json::Value SerializeToJsonValue() const override;
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
 
 private:
     void PopulateKnownPropertiesSet();
@@ -21,6 +21,11 @@ std::string CaptionSource::GetLabel() const
     return m_label;
 }
 
+void CaptionSource::SetLabel(std::string&& value)
+{
+    m_label = std::move(value);
+}
+
 void CaptionSource::SetLabel(const std::string& value)
 {
     m_label = value;
@@ -13,6 +13,7 @@ public:
     Json::Value SerializeToJsonValue() const override;
 
     std::string GetLabel() const;
+    void SetLabel(std::string&& value);
     void SetLabel(const std::string& value);
 
 private:
@@ -0,0 +1,152 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CardCache.h"
+#include "AdaptiveCardParseWarning.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+
+namespace AdaptiveCards
+{
+CachedParseResult::CachedParseResult(std::shared_ptr<ParseResult> parseResult) : m_parseResult(std::move(parseResult))
+{
+}
+
+std::shared_ptr<const AdaptiveCard> CachedParseResult::GetAdaptiveCard() const
+{
+    return m_parseResult->GetAdaptiveCard();
+}
+
+std::vector<std::shared_ptr<const AdaptiveCardParseWarning>> CachedParseResult::GetWarnings() const
+{
+    const auto warnings = m_parseResult->GetWarnings();
+    return {warnings.begin(), warnings.end()};
+}
+
+CardCache::CardCache(std::size_t capacity) :
+    m_capacity(capacity), m_lock{}, m_entries{}, m_index{}, m_hitCount(0), m_missCount(0)
+{
+}
+
+std::shared_ptr<const CachedParseResult> CardCache::DeserializeFromString(
+    const std::string& jsonString,
+    const std::string& rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementRegistration,
+    std::shared_ptr<ActionParserRegistration> actionRegistration)
+{
+    const auto hash = ComputeHash(jsonString, rendererVersion, elementRegistration.get(), actionRegistration.get());
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        const auto entry = Find(hash, jsonString, rendererVersion, elementRegistration.get(), actionRegistration.get());
+        if (entry != m_entries.end())
+        {
+            m_entries.splice(m_entries.begin(), m_entries, entry);
+            ++m_hitCount;
+            return entry->result;
+        }
+    }
+    ++m_missCount;
+
+    // parse without holding the lock so that a slow card doesn't hold up lookups of the ones we already have
+    ParseContext context(elementRegistration, actionRegistration);
+    const auto result =
+        std::make_shared<const CachedParseResult>(AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, context));
+    if (m_capacity == 0)
+    {
+        return result;
+    }
+
+    std::lock_guard<std::mutex> lock(m_lock);
+
+    // another thread may have parsed the same card in the meantime -- hand out its result so that everyone shares one
+    const auto entry = Find(hash, jsonString, rendererVersion, elementRegistration.get(), actionRegistration.get());
+    if (entry != m_entries.end())
+    {
+        m_entries.splice(m_entries.begin(), m_entries, entry);
+        return entry->result;
+    }
+
+    m_entries.push_front(Entry{hash, jsonString, rendererVersion, std::move(elementRegistration), std::move(actionRegistration), result});
+    m_index.emplace(hash, m_entries.begin());
+
+    while (m_entries.size() > m_capacity)
+    {
+        const auto& leastRecentlyUsed = m_entries.back();
+        const auto range = m_index.equal_range(leastRecentlyUsed.hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (&*it->second == &leastRecentlyUsed)
+            {
+                m_index.erase(it);
+                break;
+            }
+        }
+        m_entries.pop_back();
+    }
+
+    return result;
+}
+
+void CardCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_index.clear();
+    m_entries.clear();
+}
+
+std::size_t CardCache::GetCapacity() const
+{
+    return m_capacity;
+}
+
+std::size_t CardCache::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_entries.size();
+}
+
+std::uint64_t CardCache::GetHitCount() const
+{
+    return m_hitCount;
+}
+
+std::uint64_t CardCache::GetMissCount() const
+{
+    return m_missCount;
+}
+
+std::size_t CardCache::ComputeHash(
+    const std::string& jsonString,
+    const std::string& rendererVersion,
+    const ElementParserRegistration* elementRegistration,
+    const ActionParserRegistration* actionRegistration)
+{
+    std::size_t hash = std::hash<std::string>{}(jsonString);
+    const auto combine = [&hash](std::size_t value) { hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2); };
+    combine(std::hash<std::string>{}(rendererVersion));
+    combine(std::hash<const void*>{}(elementRegistration));
+    combine(std::hash<const void*>{}(actionRegistration));
+    return hash;
+}
+
+// Must be called with m_lock held. Entries are compared in full, so a hash collision can't return the wrong card.
+CardCache::EntryList::iterator CardCache::Find(
+    std::size_t hash,
+    const std::string& jsonString,
+    const std::string& rendererVersion,
+    const ElementParserRegistration* elementRegistration,
+    const ActionParserRegistration* actionRegistration)
+{
+    const auto range = m_index.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const auto& entry = *it->second;
+        if (entry.elementRegistration.get() == elementRegistration && entry.actionRegistration.get() == actionRegistration &&
+            entry.rendererVersion == rendererVersion && entry.jsonString == jsonString)
+        {
+            return it->second;
+        }
+    }
+    return m_entries.end();
+}
+} // namespace AdaptiveCards
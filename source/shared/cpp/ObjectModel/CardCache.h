@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseResult.h"
+#include "ElementParserRegistration.h"
+#include "ActionParserRegistration.h"
+
+namespace AdaptiveCards
+{
+class AdaptiveCard;
+class AdaptiveCardParseWarning;
+
+// A read-only view of a ParseResult held by a CardCache. Like any const AdaptiveCard, the card only hands out its
+// elements and actions as they are, so those must be left alone too.
+class CachedParseResult
+{
+public:
+    explicit CachedParseResult(std::shared_ptr<ParseResult> parseResult);
+
+    std::shared_ptr<const AdaptiveCard> GetAdaptiveCard() const;
+    std::vector<std::shared_ptr<const AdaptiveCardParseWarning>> GetWarnings() const;
+
+private:
+    std::shared_ptr<ParseResult> m_parseResult;
+};
+
+// An optional layer in front of AdaptiveCard::DeserializeFromString for hosts that parse the same cards over and over.
+// Results are keyed by the card JSON, the renderer version and the parser registrations used, and the least recently
+// used result is evicted once the cache holds capacity entries.
+//
+// Cached results are shared by every caller that asks for the same card, so they're handed out as CachedParseResults,
+// which only give out a const card and const warnings. Registrations are matched by identity; don't modify one that's
+// been used with the cache without calling Clear. A CardCache may be used from any number of threads at once.
+class CardCache
+{
+public:
+    static constexpr std::size_t DefaultCapacity = 256;
+
+    explicit CardCache(std::size_t capacity = DefaultCapacity);
+    CardCache(const CardCache&) = delete;
+    CardCache& operator=(const CardCache&) = delete;
+
+    // Returns the cached result for this card if there is one, otherwise parses it and caches the result. Parse
+    // failures aren't cached; the exception is thrown to the caller just as DeserializeFromString would throw it.
+    std::shared_ptr<const CachedParseResult> DeserializeFromString(
+        const std::string& jsonString,
+        const std::string& rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionRegistration = nullptr);
+
+    void Clear();
+
+    std::size_t GetCapacity() const;
+    std::size_t GetSize() const;
+
+    // Number of DeserializeFromString calls that were (or weren't) answered from the cache
+    std::uint64_t GetHitCount() const;
+    std::uint64_t GetMissCount() const;
+
+private:
+    struct Entry
+    {
+        std::size_t hash;
+        std::string jsonString;
+        std::string rendererVersion;
+        // holding on to the registrations keeps their addresses from being reused by registrations we haven't seen
+        std::shared_ptr<ElementParserRegistration> elementRegistration;
+        std::shared_ptr<ActionParserRegistration> actionRegistration;
+        std::shared_ptr<const CachedParseResult> result;
+    };
+    using EntryList = std::list<Entry>;
+
+    static std::size_t ComputeHash(
+        const std::string& jsonString,
+        const std::string& rendererVersion,
+        const ElementParserRegistration* elementRegistration,
+        const ActionParserRegistration* actionRegistration);
+
+    EntryList::iterator Find(
+        std::size_t hash,
+        const std::string& jsonString,
+        const std::string& rendererVersion,
+        const ElementParserRegistration* elementRegistration,
+        const ActionParserRegistration* actionRegistration);
+
+    const std::size_t m_capacity;
+    mutable std::mutex m_lock;
+    EntryList m_entries; // most recently used first
+    std::unordered_multimap<std::size_t, EntryList::iterator> m_index;
+    std::atomic<std::uint64_t> m_hitCount;
+    std::atomic<std::uint64_t> m_missCount;
+};
+} // namespace AdaptiveCards
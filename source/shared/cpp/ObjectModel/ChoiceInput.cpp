@@ -11,9 +11,9 @@ ChoiceInput::ChoiceInput()
 {
 }
 
-std::shared_ptr<ChoiceInput> ChoiceInput::Deserialize(ParseContext& /*context*/, const Json::Value& json)
+std::shared_ptr<ChoiceInput> ChoiceInput::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    auto choice = std::make_shared<ChoiceInput>();
+    auto choice = context.MakeShared<ChoiceInput>();
 
     choice->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title, true));
     choice->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, true));
@@ -46,6 +46,11 @@ std::string ChoiceInput::GetTitle() const
     return m_title;
 }
 
+void ChoiceInput::SetTitle(std::string&& value)
+{
+    m_title = std::move(value);
+}
+
 void ChoiceInput::SetTitle(const std::string& title)
 {
     m_title = title;
@@ -56,6 +61,11 @@ std::string ChoiceInput::GetValue() const
     return m_value;
 }
 
+void ChoiceInput::SetValue(std::string&& value)
+{
+    m_value = std::move(value);
+}
+
 void ChoiceInput::SetValue(const std::string& value)
 {
     m_value = value;
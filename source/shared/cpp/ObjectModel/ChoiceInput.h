@@ -16,9 +16,11 @@ public:
     Json::Value SerializeToJsonValue();
 
     std::string GetTitle() const;
+    void SetTitle(std::string&& value);
     void SetTitle(const std::string& value);
 
     std::string GetValue() const;
+    void SetValue(std::string&& value);
     void SetValue(const std::string& value);
 
     static std::shared_ptr<ChoiceInput> Deserialize(ParseContext&, const Json::Value& root);
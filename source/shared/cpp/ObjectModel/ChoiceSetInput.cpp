@@ -25,9 +25,9 @@ std::vector<std::shared_ptr<ChoiceInput>>& ChoiceSetInput::GetChoices()
     return m_choices;
 }
 
-Json::Value ChoiceSetInput::SerializeToJsonValue() const
+void ChoiceSetInput::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseInputElement::SerializeToJsonValue();
+    BaseInputElement::SerializeProperties(root);
 
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = ChoiceSetStyleToString(m_choiceSetStyle);
 
@@ -55,8 +55,6 @@ Json::Value ChoiceSetInput::SerializeToJsonValue() const
             root[propertyName].append(choice->SerializeToJsonValue());
         }
     }
-
-    return root;
 }
 
 bool ChoiceSetInput::GetIsMultiSelect() const
@@ -84,6 +82,11 @@ std::string ChoiceSetInput::GetValue() const
     return m_value;
 }
 
+void ChoiceSetInput::SetValue(std::string&& value)
+{
+    m_value = std::move(value);
+}
+
 void ChoiceSetInput::SetValue(std::string const& value)
 {
     m_value = value;
@@ -104,6 +107,11 @@ std::string ChoiceSetInput::GetPlaceholder() const
     return m_placeholder;
 }
 
+void ChoiceSetInput::SetPlaceholder(std::string&& value)
+{
+    m_placeholder = std::move(value);
+}
+
 void ChoiceSetInput::SetPlaceholder(const std::string& value)
 {
     m_placeholder = value;
@@ -116,7 +124,7 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::Deserialize(ParseContext&
     auto choiceSet = BaseInputElement::Deserialize<ChoiceSetInput>(context, json);
 
     choiceSet->SetChoiceSetStyle(ParseUtil::GetEnumValue<ChoiceSetStyle>(
-        json, AdaptiveCardSchemaKey::Style, ChoiceSetStyle::Compact, ChoiceSetStyleFromString));
+        json, AdaptiveCardSchemaKey::Style, ChoiceSetStyle::Compact, ChoiceSetStyleTryFromString));
     choiceSet->SetIsMultiSelect(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsMultiSelect, false));
     choiceSet->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, false));
     choiceSet->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false, false));
@@ -129,7 +137,7 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::Deserialize(ParseContext&
 
     if (choiceSet->GetIsMultiSelect() && choiceSet->GetChoiceSetStyle() == ChoiceSetStyle::Filtered)
     {
-        context.warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+        context.warnings.emplace_back(context.MakeShared<AdaptiveCardParseWarning>(
             WarningStatusCode::InvalidValue, "Input.ChoiceSet does not support filtering with multiselect"));
     }
 
@@ -143,11 +151,12 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::DeserializeFromString(Par
 
 void ChoiceSetInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Choices),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiSelect),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Choices,
+         AdaptiveCardSchemaKey::IsMultiSelect,
+         AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Wrap});
+    m_knownProperties = &knownProperties;
 }
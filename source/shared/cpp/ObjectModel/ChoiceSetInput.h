@@ -21,8 +21,6 @@ public:
     ChoiceSetInput& operator=(ChoiceSetInput&&) = default;
     ~ChoiceSetInput() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     bool GetIsMultiSelect() const;
     void SetIsMultiSelect(const bool isMultiSelect);
 
@@ -33,14 +31,19 @@ public:
     const std::vector<std::shared_ptr<ChoiceInput>>& GetChoices() const;
 
     std::string GetValue() const;
+    void SetValue(std::string&& value);
     void SetValue(const std::string& value);
 
     bool GetWrap() const;
     void SetWrap(bool value);
 
     std::string GetPlaceholder() const;
+    void SetPlaceholder(std::string&& value);
     void SetPlaceholder(const std::string& value);
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
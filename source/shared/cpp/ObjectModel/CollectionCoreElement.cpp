@@ -9,3 +9,8 @@ using namespace AdaptiveCards;
 CollectionCoreElement::CollectionCoreElement(CardElementType type) : BaseCardElement(type)
 {
 }
+
+void CollectionCoreElement::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
+}
@@ -24,6 +24,9 @@ public:
 
     template <typename T>
     static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& value);
+
+protected:
+    void WriteJson(JsonWriter& writer) const override;
 };
 
 template <typename T>
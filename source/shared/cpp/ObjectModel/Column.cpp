@@ -64,44 +64,33 @@ void Column::SetRtl(const std::optional<bool>& value)
     m_rtl = value;
 }
 
-std::string Column::Serialize() const
+void Column::SerializeProperties(JsonMembers& root) const
 {
-    return ParseUtil::JsonToString(SerializeToJsonValue());
-}
-
-Json::Value Column::SerializeToJsonValue() const
-{
-    Json::Value root = StyledCollectionElement::SerializeToJsonValue();
+    StyledCollectionElement::SerializeProperties(root);
 
     if (!m_width.empty())
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width)] = m_width;
     }
 
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items);
-    root[propertyName] = Json::Value(Json::arrayValue);
-    for (const auto& cardElement : m_items)
-    {
-        root[propertyName].append(cardElement->SerializeToJsonValue());
-    }
+    root.SetArray(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items), m_items);
 
     if (m_rtl.has_value())
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl)] = m_rtl.value_or("");
     }
-
-    return root;
 }
 
 void Column::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Items,
+         AdaptiveCardSchemaKey::Rtl,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Width,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::VerticalContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 void Column::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -142,7 +131,7 @@ std::shared_ptr<BaseCardElement> ColumnParser::Deserialize(ParseContext& context
 
         if (!isFallbackColumn)
         {
-            context.warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+            context.warnings.emplace_back(context.MakeShared<AdaptiveCardParseWarning>(
                 WarningStatusCode::UnknownElementType, "Column Fallback must be a Column. Fallback content dropped."));
 
             column->SetFallbackContent(nullptr);
@@ -157,7 +146,7 @@ std::shared_ptr<BaseCardElement> ColumnParser::Deserialize(ParseContext& context
         columnWidth = ParseUtil::GetValueAsString(value, AdaptiveCardSchemaKey::Size);
     }
 
-    column->SetWidth(ParseUtil::ToLowercase(columnWidth), &context.warnings);
+    column->SetWidth(columnWidth, &context.warnings);
 
     column->SetRtl(ParseUtil::GetOptionalBool(value, AdaptiveCardSchemaKey::Rtl));
 
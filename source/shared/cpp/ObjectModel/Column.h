@@ -17,9 +17,6 @@ class Column : public StyledCollectionElement
 public:
     Column();
 
-    std::string Serialize() const override;
-    Json::Value SerializeToJsonValue() const override;
-
     void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
 
     std::string GetWidth() const;
@@ -38,6 +35,9 @@ public:
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     void PopulateKnownPropertiesSet();
     std::string m_width;
@@ -25,18 +25,11 @@ std::vector<std::shared_ptr<Column>>& ColumnSet::GetColumns()
     return m_columns;
 }
 
-Json::Value ColumnSet::SerializeToJsonValue() const
+void ColumnSet::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = StyledCollectionElement::SerializeToJsonValue();
+    StyledCollectionElement::SerializeProperties(root);
 
-    std::string const& propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns);
-    root[propertyName] = Json::Value(Json::arrayValue);
-    for (const auto& column : m_columns)
-    {
-        root[propertyName].append(column->SerializeToJsonValue());
-    }
-
-    return root;
+    root.SetArray(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns), m_columns);
 }
 
 void ColumnSet::DeserializeChildren(ParseContext& context, const Json::Value& value)
@@ -52,11 +45,12 @@ void ColumnSet::DeserializeChildren(ParseContext& context, const Json::Value& va
 
 void ColumnSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Bleed,
+         AdaptiveCardSchemaKey::Columns,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Style});
+    m_knownProperties = &knownProperties;
 }
 
 void ColumnSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -21,7 +21,6 @@ public:
     ColumnSet& operator=(ColumnSet&&) = default;
     ~ColumnSet() = default;
 
-    Json::Value SerializeToJsonValue() const override;
     void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
 
     std::vector<std::shared_ptr<Column>>& GetColumns();
@@ -29,6 +28,9 @@ public:
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
@@ -41,22 +41,15 @@ void Container::SetRtl(const std::optional<bool>& value)
     m_rtl = value;
 }
 
-Json::Value Container::SerializeToJsonValue() const
+void Container::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = StyledCollectionElement::SerializeToJsonValue();
-    std::string const& itemsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items);
-    root[itemsPropertyName] = Json::Value(Json::arrayValue);
-    for (const auto& cardElement : m_items)
-    {
-        root[itemsPropertyName].append(cardElement->SerializeToJsonValue());
-    }
+    StyledCollectionElement::SerializeProperties(root);
+    root.SetArray(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items), m_items);
 
     if (m_rtl.has_value())
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl)] = m_rtl.value_or("");
     }
-
-    return root;
 }
 
 std::shared_ptr<BaseCardElement> ContainerParser::Deserialize(ParseContext& context, const Json::Value& value)
@@ -89,13 +82,14 @@ std::shared_ptr<BaseCardElement> ContainerParser::DeserializeFromString(ParseCon
 
 void Container::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Bleed,
+         AdaptiveCardSchemaKey::Rtl,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::VerticalContentAlignment,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Items});
+    m_knownProperties = &knownProperties;
 }
 
 void Container::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
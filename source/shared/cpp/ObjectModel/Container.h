@@ -22,7 +22,6 @@ public:
     Container& operator=(Container&&) = default;
     ~Container() = default;
 
-    Json::Value SerializeToJsonValue() const override;
     void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
 
     std::vector<std::shared_ptr<BaseCardElement>>& GetItems();
@@ -33,6 +32,9 @@ public:
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
@@ -27,6 +27,11 @@ std::string ContentSource::GetMimeType() const
     return m_mimeType;
 }
 
+void ContentSource::SetMimeType(std::string&& value)
+{
+    m_mimeType = std::move(value);
+}
+
 void ContentSource::SetMimeType(const std::string& value)
 {
     m_mimeType = value;
@@ -37,6 +42,11 @@ std::string ContentSource::GetUrl() const
     return m_url;
 }
 
+void ContentSource::SetUrl(std::string&& value)
+{
+    m_url = std::move(value);
+}
+
 void ContentSource::SetUrl(const std::string& value)
 {
     m_url = value;
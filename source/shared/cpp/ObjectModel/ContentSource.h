@@ -16,9 +16,11 @@ public:
     static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& root);
 
     std::string GetMimeType() const;
+    void SetMimeType(std::string&& value);
     void SetMimeType(const std::string& value);
 
     std::string GetUrl() const;
+    void SetUrl(std::string&& value);
     void SetUrl(const std::string& value);
 
     virtual void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo);
@@ -29,9 +31,9 @@ private:
 };
 
 template <typename T>
-std::shared_ptr<T> ContentSource::Deserialize(ParseContext&, const Json::Value& json)
+std::shared_ptr<T> ContentSource::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<T> base = std::make_shared<T>();
+    std::shared_ptr<T> base = context.MakeShared<T>();
     std::shared_ptr<ContentSource> contentSource = std::static_pointer_cast<ContentSource>(base);
 
     contentSource->SetMimeType(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MimeType, false));
@@ -12,9 +12,9 @@ DateInput::DateInput() : BaseInputElement(CardElementType::DateInput)
     PopulateKnownPropertiesSet();
 }
 
-Json::Value DateInput::SerializeToJsonValue() const
+void DateInput::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseInputElement::SerializeToJsonValue();
+    BaseInputElement::SerializeProperties(root);
 
     if (!m_max.empty())
     {
@@ -35,8 +35,6 @@ Json::Value DateInput::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = m_value;
     }
-
-    return root;
 }
 
 std::string DateInput::GetMax() const
@@ -44,6 +42,11 @@ std::string DateInput::GetMax() const
     return m_max;
 }
 
+void DateInput::SetMax(std::string&& value)
+{
+    m_max = std::move(value);
+}
+
 void DateInput::SetMax(const std::string& value)
 {
     m_max = value;
@@ -54,6 +57,11 @@ std::string DateInput::GetMin() const
     return m_min;
 }
 
+void DateInput::SetMin(std::string&& value)
+{
+    m_min = std::move(value);
+}
+
 void DateInput::SetMin(const std::string& value)
 {
     m_min = value;
@@ -64,6 +72,11 @@ std::string DateInput::GetPlaceholder() const
     return m_placeholder;
 }
 
+void DateInput::SetPlaceholder(std::string&& value)
+{
+    m_placeholder = std::move(value);
+}
+
 void DateInput::SetPlaceholder(const std::string& value)
 {
     m_placeholder = value;
@@ -74,6 +87,11 @@ std::string DateInput::GetValue() const
     return m_value;
 }
 
+void DateInput::SetValue(std::string&& value)
+{
+    m_value = std::move(value);
+}
+
 void DateInput::SetValue(const std::string& value)
 {
     m_value = value;
@@ -100,9 +118,10 @@ std::shared_ptr<BaseCardElement> DateInputParser::DeserializeFromString(ParseCon
 
 void DateInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Min,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Placeholder});
+    m_knownProperties = &knownProperties;
 }
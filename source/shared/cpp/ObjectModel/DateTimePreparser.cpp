@@ -13,10 +13,394 @@
 #include "BaseCardElement.h"
 #include "ElementParserRegistration.h"
 #include "DateTimePreparser.h"
+#include <array>
 #include <iomanip>
 
 using namespace AdaptiveCards;
 
+namespace
+{
+    // Reads exactly count ASCII digits starting at offset. The caller is responsible for making sure they're in range.
+    bool ScanDigits(std::string_view string, size_t offset, size_t count, unsigned int& value)
+    {
+        value = 0;
+        for (size_t i = offset; i < offset + count; ++i)
+        {
+            if (string[i] < '0' || string[i] > '9')
+            {
+                return false;
+            }
+            value = value * 10 + static_cast<unsigned int>(string[i] - '0');
+        }
+        return true;
+    }
+
+    bool ScanLiteral(std::string_view string, size_t& offset, std::string_view literal)
+    {
+        if (string.compare(offset, literal.size(), literal) == 0)
+        {
+            offset += literal.size();
+            return true;
+        }
+        return false;
+    }
+
+    // The pieces of {{DATE(YYYY-MM-DDThh:mm:ssZ)}} or {{TIME(...)}}, where the zone is Z or +hh:mm/-hh:mm and may be
+    // followed by ", SHORT", ", LONG" or ", COMPACT" (the space is optional)
+    struct DateTimeMatch
+    {
+        size_t length;
+        bool isDate;
+        unsigned int year, month, day, hours, minutes, seconds;
+        char zoneSign; // 'Z', '+' or '-'
+        unsigned int zoneHours, zoneMinutes;
+        char style; // 'S', 'L', 'C' or 0 if none was given
+    };
+
+    bool TryMatchDateTime(std::string_view text, size_t offset, DateTimeMatch& match)
+    {
+        const size_t start = offset;
+        if (!ScanLiteral(text, offset, "{{"))
+        {
+            return false;
+        }
+
+        if (ScanLiteral(text, offset, "DATE("))
+        {
+            match.isDate = true;
+        }
+        else if (ScanLiteral(text, offset, "TIME("))
+        {
+            match.isDate = false;
+        }
+        else
+        {
+            return false;
+        }
+
+        // YYYY-MM-DDThh:mm:ss and at least one more char for the zone
+        if (text.size() - offset < 20 || !ScanDigits(text, offset, 4, match.year) || text[offset + 4] != '-' ||
+            !ScanDigits(text, offset + 5, 2, match.month) || text[offset + 7] != '-' ||
+            !ScanDigits(text, offset + 8, 2, match.day) || text[offset + 10] != 'T' ||
+            !ScanDigits(text, offset + 11, 2, match.hours) || text[offset + 13] != ':' ||
+            !ScanDigits(text, offset + 14, 2, match.minutes) || text[offset + 16] != ':' ||
+            !ScanDigits(text, offset + 17, 2, match.seconds))
+        {
+            return false;
+        }
+        offset += 19;
+
+        match.zoneSign = text[offset];
+        match.zoneHours = 0;
+        match.zoneMinutes = 0;
+        if (match.zoneSign == 'Z')
+        {
+            ++offset;
+        }
+        else if (match.zoneSign == '+' || match.zoneSign == '-')
+        {
+            if (text.size() - offset < 6 || !ScanDigits(text, offset + 1, 2, match.zoneHours) || text[offset + 3] != ':' ||
+                !ScanDigits(text, offset + 4, 2, match.zoneMinutes))
+            {
+                return false;
+            }
+            offset += 6;
+        }
+        else
+        {
+            return false;
+        }
+
+        match.style = 0;
+        if (ScanLiteral(text, offset, ","))
+        {
+            ScanLiteral(text, offset, " ");
+            if (ScanLiteral(text, offset, "SHORT"))
+            {
+                match.style = 'S';
+            }
+            else if (ScanLiteral(text, offset, "LONG"))
+            {
+                match.style = 'L';
+            }
+            else if (ScanLiteral(text, offset, "COMPACT"))
+            {
+                match.style = 'C';
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        if (!ScanLiteral(text, offset, ")}}"))
+        {
+            return false;
+        }
+
+        match.length = offset - start;
+        return true;
+    }
+
+    // Days since 1970-01-01 of a date in the proleptic Gregorian calendar; month is 1-12
+    long long DaysFromCivil(long long year, unsigned int month, unsigned int day)
+    {
+        year -= (month <= 2) ? 1 : 0;
+        const long long era = (year >= 0 ? year : year - 399) / 400;
+        const long long yearOfEra = year - era * 400;
+        const long long dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        const long long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        return era * 146097 + dayOfEra - 719468;
+    }
+
+    // Seconds since the epoch of a broken down time read as UTC. Out of range fields carry over the way mktime
+    // normalizes them (month 0 is December of the year before, day 0 the last day of the month before, and so on).
+    long long SecondsFromCivil(long long year, long long month, long long day, long long hours, long long minutes, long long seconds)
+    {
+        // month is 0-11 here
+        year += (month >= 0 ? month : month - 11) / 12;
+        month = ((month % 12) + 12) % 12;
+        const long long days = DaysFromCivil(year, static_cast<unsigned int>(month + 1), 1) + day - 1;
+        return ((days * 24 + hours) * 60 + minutes) * 60 + seconds;
+    }
+
+    void CivilFromSeconds(long long time, struct tm& result)
+    {
+        long long days = (time >= 0 ? time : time - 86399) / 86400;
+        const long long secondsOfDay = time - days * 86400;
+        result.tm_hour = static_cast<int>(secondsOfDay / 3600);
+        result.tm_min = static_cast<int>(secondsOfDay / 60 % 60);
+        result.tm_sec = static_cast<int>(secondsOfDay % 60);
+        result.tm_wday = static_cast<int>(((days % 7) + 11) % 7); // 1970-01-01 was a Thursday
+
+        days += 719468;
+        const long long era = (days >= 0 ? days : days - 146096) / 146097;
+        const long long dayOfEra = days - era * 146097;
+        const long long yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+        const long long dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+        const long long shiftedMonth = (5 * dayOfYear + 2) / 153; // March is 0
+        const long long month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+        const long long year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+
+        result.tm_mday = static_cast<int>(dayOfYear - (153 * shiftedMonth + 2) / 5 + 1);
+        result.tm_mon = static_cast<int>(month - 1);
+        result.tm_year = static_cast<int>(year - 1900);
+        result.tm_yday = static_cast<int>(SecondsFromCivil(year, month - 1, result.tm_mday, 0, 0, 0) / 86400 -
+                                          DaysFromCivil(year, 1, 1));
+    }
+
+    struct LocalTimeOffset
+    {
+        long long offset; // seconds east of UTC
+        bool isDst;
+        bool isValid; // false if the platform can't convert the time
+    };
+
+    LocalTimeOffset ComputeLocalTimeOffset(long long time)
+    {
+        const time_t utc = static_cast<time_t>(time);
+        struct tm local
+        {
+        };
+        if (LOCALTIME(&local, &utc))
+        {
+            return {0, false, false};
+        }
+        const long long localTime =
+            SecondsFromCivil(local.tm_year + 1900LL, local.tm_mon, local.tm_mday, local.tm_hour, local.tm_min, local.tm_sec);
+        return {localTime - time, local.tm_isdst > 0, true};
+    }
+
+    // Bumped whenever the local time zone is seen to change, or by DateTimePreparser::ResetTimeZoneCache, to
+    // invalidate every thread's cache
+    std::atomic<unsigned int> s_timeZoneGeneration{0};
+
+    // The local time zone as tzset describes it. Two zones that agree on all of this convert (almost) every date the
+    // same way.
+    struct TimeZoneKey
+    {
+        long offset; // seconds west of UTC
+        int hasDaylightSavingTime;
+        std::string standardName;
+        std::string daylightName;
+
+        bool operator!=(const TimeZoneKey& other) const
+        {
+            return offset != other.offset || hasDaylightSavingTime != other.hasDaylightSavingTime ||
+                   standardName != other.standardName || daylightName != other.daylightName;
+        }
+    };
+
+    TimeZoneKey ReadTimeZone()
+    {
+        TimeZoneKey zone{};
+#ifdef _MSC_VER
+        _tzset();
+        _get_timezone(&zone.offset);
+        _get_daylight(&zone.hasDaylightSavingTime);
+        for (int index = 0; index < 2; ++index)
+        {
+            char name[64]{};
+            size_t length = 0;
+            _get_tzname(&length, name, sizeof(name), index);
+            (index == 0 ? zone.standardName : zone.daylightName) = name;
+        }
+#else
+        tzset();
+        zone.offset = timezone;
+        zone.hasDaylightSavingTime = daylight;
+        zone.standardName = tzname[0];
+        zone.daylightName = tzname[1];
+#endif
+        return zone;
+    }
+
+    // Has the C runtime read the local time zone again (localtime_r doesn't always, and localtime_s only does so
+    // once), and returns the generation of cached offsets that goes with it, starting a new one if the zone has
+    // changed since it was last looked at
+    unsigned int CheckTimeZone()
+    {
+        static std::mutex s_mutex;
+        static TimeZoneKey s_lastZone{};
+
+        auto zone = ReadTimeZone();
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (zone != s_lastZone)
+        {
+            s_lastZone = std::move(zone);
+            ++s_timeZoneGeneration;
+        }
+        return s_timeZoneGeneration.load(std::memory_order_relaxed);
+    }
+
+    // Local time zone offsets, remembered per quarter hour. Converting a date then is plain arithmetic instead of a
+    // trip through mktime, strftime and localtime, which take a process wide lock on the time zone. Each thread has
+    // its own cache so that looking an offset up doesn't need a lock either.
+    class LocalTimeOffsetCache
+    {
+    public:
+        LocalTimeOffset Get(long long time)
+        {
+            const unsigned int generation = s_timeZoneGeneration.load(std::memory_order_relaxed);
+            const long long slotIndex = (time >= 0 ? time : time - (SlotLength - 1)) / SlotLength;
+            Slot& slot = m_slots[static_cast<size_t>(slotIndex) % SlotCount];
+            if (!slot.isFilled || slot.index != slotIndex || slot.generation != generation)
+            {
+                // an offset only applies to the whole slot if nothing changes within it; zones change their offset
+                // at most a few times a year, so checking both ends is enough
+                const auto first = ComputeLocalTimeOffset(slotIndex * SlotLength);
+                const auto last = ComputeLocalTimeOffset(slotIndex * SlotLength + SlotLength - 1);
+                slot.index = slotIndex;
+                slot.generation = generation;
+                slot.isFilled = true;
+                slot.isUniform =
+                    first.isValid && last.isValid && first.offset == last.offset && first.isDst == last.isDst;
+                slot.offset = first;
+            }
+            return slot.isUniform ? slot.offset : ComputeLocalTimeOffset(time);
+        }
+
+    private:
+        static constexpr long long SlotLength = 15 * 60;
+        static constexpr size_t SlotCount = 64;
+
+        struct Slot
+        {
+            long long index;
+            unsigned int generation;
+            bool isFilled;
+            bool isUniform;
+            LocalTimeOffset offset;
+        };
+        std::array<Slot, SlotCount> m_slots{};
+    };
+
+    LocalTimeOffset GetLocalTimeOffset(long long time)
+    {
+        static thread_local LocalTimeOffsetCache cache;
+        return cache.Get(time);
+    }
+
+    // The offset mktime reads a wall clock time with when it's told the time isn't daylight saving time: the offset
+    // in effect at that time, or if that's daylight saving time, the one at the nearest time that isn't.
+    std::optional<long long> GetStandardTimeOffset(long long wallTime)
+    {
+        // find the time whose local time is wallTime
+        long long time = wallTime;
+        LocalTimeOffset offset{};
+        for (int i = 0; i < 4; ++i)
+        {
+            offset = GetLocalTimeOffset(time);
+            if (!offset.isValid)
+            {
+                return std::nullopt;
+            }
+            if (time == wallTime - offset.offset)
+            {
+                break;
+            }
+            time = wallTime - offset.offset;
+        }
+
+        if (offset.isDst)
+        {
+#if defined(__GLIBC__)
+            // same search (and same steps) as glibc's mktime
+            constexpr long long stride = 601200;
+            constexpr long long searchBound = 536454000 / 2 + stride;
+            for (long long delta = stride; delta < searchBound; delta += stride)
+            {
+                for (const long long direction : {-1, 1})
+                {
+                    const auto nearby = GetLocalTimeOffset(time + delta * direction);
+                    if (nearby.isValid && !nearby.isDst)
+                    {
+                        return nearby.offset;
+                    }
+                }
+            }
+#else
+            // other C runtimes each settle this their own way, so let this one's mktime do it
+            struct tm wallClock
+            {
+            };
+            CivilFromSeconds(wallTime, wallClock);
+            wallClock.tm_isdst = 0;
+            const time_t standardTime = mktime(&wallClock);
+            if (standardTime == -1)
+            {
+                return std::nullopt;
+            }
+            return wallTime - static_cast<long long>(standardTime);
+#endif
+        }
+        return offset.offset;
+    }
+
+    // %I:%M %p
+    std::string FormatTime(const struct tm& time)
+    {
+        if (time.tm_hour < 0 || time.tm_hour > 23)
+        {
+            std::ostringstream parsedTime;
+            parsedTime << std::put_time(&time, "%I:%M %p");
+            return parsedTime.str();
+        }
+
+        const int hours = (time.tm_hour % 12 == 0) ? 12 : time.tm_hour % 12;
+        std::string formatted = "00:00 AM";
+        formatted[0] = static_cast<char>('0' + hours / 10);
+        formatted[1] = static_cast<char>('0' + hours % 10);
+        formatted[3] = static_cast<char>('0' + time.tm_min / 10);
+        formatted[4] = static_cast<char>('0' + time.tm_min % 10);
+        if (time.tm_hour >= 12)
+        {
+            formatted[6] = 'P';
+        }
+        return formatted;
+    }
+} // namespace
+
 DateTimePreparser::DateTimePreparser() : m_hasDateTokens(false)
 {
 }
@@ -26,7 +410,7 @@ DateTimePreparser::DateTimePreparser(std::string const& in) : m_hasDateTokens(fa
     ParseDateTime(in);
 }
 
-std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparser::GetTextTokens() const
+const std::vector<std::shared_ptr<DateTimePreparsedToken>>& DateTimePreparser::GetTextTokens() const
 {
     return m_textTokenCollection;
 }
@@ -36,17 +420,17 @@ bool DateTimePreparser::HasDateTokens() const
     return m_hasDateTokens;
 }
 
-void DateTimePreparser::AddTextToken(const std::string& text, DateTimePreparsedTokenFormat format)
+void DateTimePreparser::AddTextToken(std::string_view text, DateTimePreparsedTokenFormat format)
 {
     if (!text.empty())
     {
-        m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(text, format));
+        m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(std::string(text), format));
     }
 }
 
-void DateTimePreparser::AddDateToken(const std::string& text, struct tm& date, DateTimePreparsedTokenFormat format)
+void DateTimePreparser::AddDateToken(std::string_view text, struct tm& date, DateTimePreparsedTokenFormat format)
 {
-    m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(text, date, format));
+    m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(std::string(text), date, format));
     m_hasDateTokens = true;
 }
 
@@ -88,209 +472,130 @@ bool DateTimePreparser::IsValidTime(const int hours, const int minutes, const in
     return (hours <= 24 && minutes <= 60 && seconds <= 60);
 }
 
-bool DateTimePreparser::IsValidTimeAndDate(const struct tm& parsedTm, const int hours, const int minutes)
+void DateTimePreparser::ResetTimeZoneCache()
 {
-    return IsValidDate(parsedTm.tm_year, parsedTm.tm_mon, parsedTm.tm_mday) &&
-           IsValidTime(parsedTm.tm_hour, parsedTm.tm_min, parsedTm.tm_sec) && IsValidTime(hours, minutes, 0);
-}
-
-constexpr time_t IntToTimeT(int timeToConvert)
-{
-#pragma warning(push)
-#pragma warning(disable : 26472)
-    // disable warning about using static_cast since we need to hard cast up.
-    return static_cast<time_t>(timeToConvert);
-#pragma warning(pop)
+    ++s_timeZoneGeneration;
 }
 
 void DateTimePreparser::ParseDateTime(const std::string& in)
 {
-    if (in.find("{{") != std::string::npos)
+    const std::string_view text(in);
+    size_t textStart = 0;
+    size_t searchStart = 0;
+    DateTimeMatch match{};
+    bool isTimeZoneChecked = false;
+    for (size_t matchStart = text.find("{{"); matchStart != std::string_view::npos; matchStart = text.find("{{", searchStart))
     {
-        static const std::regex pattern(
-            "\\{\\{((DATE)|(TIME))\\((\\d{4})-{1}(\\d{2})-{1}(\\d{2})T(\\d{2}):{1}(\\d{2}):{1}(\\d{2})(Z|(([+-])(\\d{2}"
-            "):{1}(\\d{2})))((((, ?SHORT)|(, ?LONG))|(, ?COMPACT))|)\\)\\}\\}");
-        std::smatch matches;
-        std::string text = in;
-        enum MatchIndex
-        {
-            IsDate = 2,
-            Year = 4,
-            Month,
-            Day,
-            Hour,
-            Min,
-            Sec,
-            TimeZone = 12,
-            TZHr,
-            TZMn,
-            Format,
-            Style,
-        };
-        std::vector<int> indexer = {Year, Month, Day, Hour, Min, Sec, TZHr, TZMn};
-
-        while (std::regex_search(text, matches, pattern))
+        if (!TryMatchDateTime(text, matchStart, match))
         {
-            int formatStyle{};
-            // Date is matched
-            const bool isDate = matches[IsDate].matched;
-            int hours{}, minutes{};
-            struct tm parsedTm
-            {
-            };
-            std::vector<int*> addrs = {
-                &parsedTm.tm_year, &parsedTm.tm_mon, &parsedTm.tm_mday, &parsedTm.tm_hour, &parsedTm.tm_min, &parsedTm.tm_sec, &hours, &minutes};
+            searchStart = matchStart + 1;
+            continue;
+        }
 
-            if (matches[Style].matched)
-            {
-                // match for long/short/compact
-                bool formatHasSpace = matches[Format].str().at(1) == ' ';
-                const int formatStartIndex = formatHasSpace ? 2 : 1;
-                formatStyle = matches[Format].str().at(formatStartIndex);
-            }
+        AddTextToken(text.substr(textStart, matchStart - textStart), DateTimePreparsedTokenFormat::RegularString);
+        textStart = searchStart = matchStart + match.length;
+        const std::string_view matchText = text.substr(matchStart, match.length);
 
-            AddTextToken(matches.prefix().str(), DateTimePreparsedTokenFormat::RegularString);
+        // times don't take a style
+        if (!match.isDate && match.style)
+        {
+            AddTextToken(matchText, DateTimePreparsedTokenFormat::RegularString);
+            continue;
+        }
 
-            if (!isDate && formatStyle)
-            {
-                AddTextToken(matches[0].str(), DateTimePreparsedTokenFormat::RegularString);
-                text = matches.suffix().str();
-                continue;
-            }
+        if (!IsValidDate(match.year, match.month, match.day) || !IsValidTime(match.hours, match.minutes, match.seconds) ||
+            !IsValidTime(match.zoneHours, match.zoneMinutes, 0))
+        {
+            AddTextToken(matchText, DateTimePreparsedTokenFormat::RegularString);
+            continue;
+        }
 
-            for (unsigned int idx = 0; idx < indexer.size(); idx++)
-            {
-                if (matches[indexer.at(idx)].matched)
-                {
-                    // get indexes for time attributes to index into corresponding matches
-                    // and convert it to string
-                    *(addrs.at(idx)) = stoi(matches[indexer.at(idx)]);
-                }
-            }
+        if (!isTimeZoneChecked)
+        {
+            CheckTimeZone();
+            isTimeZoneChecked = true;
+        }
 
-            // check for date and time validation
-            if (IsValidTimeAndDate(parsedTm, hours, minutes))
-            {
-                time_t offset{};
-                // maches offset sign,
-                // Z == UTC,
-                // + == time added from UTC
-                // - == time subtracted from UTC
-                if (matches[TimeZone].matched)
-                {
-                    // converts to seconds
-                    hours *= 3600;
-                    minutes *= 60;
-                    offset = IntToTimeT(hours) + IntToTimeT(minutes);
-
-                    wchar_t zone = matches[TimeZone].str().at(0);
-                    // time zone offset calculation
-                    if (zone == '+')
-                    {
-                        offset *= -1;
-                    }
-                }
+        // The local time to show is the given time moved to UTC and then to the local zone. The arithmetic below
+        // arrives at the same answer as the mktime/strftime("%z")/localtime sequence this used to be, including
+        // that sequence's treatment of daylight saving time, but reads the zone offsets from a cache.
+        const long long wallTime = SecondsFromCivil(match.year, match.month - 1LL, match.day, match.hours, match.minutes, match.seconds);
+        const auto standardOffset = GetStandardTimeOffset(wallTime);
+        if (!standardOffset.has_value())
+        {
+            AddTextToken(matchText, DateTimePreparsedTokenFormat::RegularString);
+            continue;
+        }
+        const long long localTime = wallTime - *standardOffset;
 
-                // measured from year 1900
-                parsedTm.tm_year -= 1900;
-                parsedTm.tm_mon -= 1;
+        // %z only has minutes
+        const long long localOffset = GetLocalTimeOffset(localTime).offset;
+        const long long localOffsetMinutes = (localOffset < 0 ? -((-localOffset) / 60) : localOffset / 60) * 60;
 
-                time_t utc{};
-                // converts to ticks in UTC
-                utc = mktime(&parsedTm);
-                if (utc == -1)
-                {
-                    AddTextToken(matches[0], DateTimePreparsedTokenFormat::RegularString);
-                }
+        long long zoneOffset = (match.zoneHours * 3600LL) + (match.zoneMinutes * 60LL);
+        if (match.zoneSign == '+')
+        {
+            zoneOffset *= -1;
+        }
 
-// Disable "array to pointer decay" check for tzOffsetBuff since we can't change strftime's signature
-#pragma warning(push)
-#pragma warning(disable : 26485)
-                char tzOffsetBuff[6]{};
-                // gets local time zone offset
-                strftime(tzOffsetBuff, 6, "%z", &parsedTm);
-                std::string localTimeZoneOffsetStr(tzOffsetBuff);
-                const time_t nTzOffset = IntToTimeT(std::stoi(localTimeZoneOffsetStr));
-                offset += ((nTzOffset / 100) * 3600 + (nTzOffset % 100) * 60);
-                // add offset to utc
-                utc += offset;
-                struct tm result
-                {
-                };
-#pragma warning(pop)
+        const long long utc = localTime + localOffsetMinutes + zoneOffset;
+        const auto resultOffset = GetLocalTimeOffset(utc);
+        if (!resultOffset.isValid)
+        {
+            continue;
+        }
 
-                // converts to local time from utc
-                if (!LOCALTIME(&result, &utc))
-                {
-                    // localtime() set dst, put_time adjusts time accordingly which is not what we want since
-                    // we have already taken cared of it in our calculation
-                    if (result.tm_isdst == 1)
-                    {
-                        result.tm_hour -= 1;
-                    }
+        struct tm result
+        {
+        };
+        CivilFromSeconds(utc + resultOffset.offset, result);
+        result.tm_isdst = resultOffset.isDst ? 1 : 0;
 
-                    if (isDate)
-                    {
-                        switch (formatStyle)
-                        {
-                        // SHORT Style
-                        case 'S':
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateShort);
-                            break;
-                        // LONG Style
-                        case 'L':
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateLong);
-                            break;
-                        // COMPACT or DEFAULT Style
-                        case 'C':
-                        default:
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateCompact);
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        std::ostringstream parsedTime;
-                        parsedTime << std::put_time(&result, "%I:%M %p");
-                        AddTextToken(parsedTime.str(), DateTimePreparsedTokenFormat::RegularString);
-                    }
-                }
-            }
-            else
+        // localtime sets dst, put_time adjusts time accordingly which is not what we want since we have already taken
+        // care of it in our calculation
+        if (result.tm_isdst == 1)
+        {
+            result.tm_hour -= 1;
+        }
+
+        if (match.isDate)
+        {
+            switch (match.style)
             {
-                AddTextToken(matches[0].str(), DateTimePreparsedTokenFormat::RegularString);
+            // SHORT Style
+            case 'S':
+                AddDateToken(matchText, result, DateTimePreparsedTokenFormat::DateShort);
+                break;
+            // LONG Style
+            case 'L':
+                AddDateToken(matchText, result, DateTimePreparsedTokenFormat::DateLong);
+                break;
+            // COMPACT or DEFAULT Style
+            case 'C':
+            default:
+                AddDateToken(matchText, result, DateTimePreparsedTokenFormat::DateCompact);
+                break;
             }
-
-            text = matches.suffix().str();
         }
-
-        AddTextToken(text, DateTimePreparsedTokenFormat::RegularString);
-    }
-    else
-    {
-        AddTextToken(in, DateTimePreparsedTokenFormat::RegularString);
+        else
+        {
+            AddTextToken(FormatTime(result), DateTimePreparsedTokenFormat::RegularString);
+        }
     }
+
+    AddTextToken(text.substr(textStart), DateTimePreparsedTokenFormat::RegularString);
 }
 
 // Parses a time of the form HH:MM
 bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes)
 {
-    std::smatch subMatches;
-    static const std::regex timeMatch(R"regex(^(\d{2}):(\d{2})$)regex");
-    if (std::regex_match(string, subMatches, timeMatch))
+    unsigned int parsedHours{}, parsedMinutes{};
+    if (string.size() == 5 && ScanDigits(string, 0, 2, parsedHours) && string[2] == ':' &&
+        ScanDigits(string, 3, 2, parsedMinutes) && IsValidTime(parsedHours, parsedMinutes, 0))
     {
-        if (subMatches[1].matched && subMatches[2].matched)
-        {
-            unsigned int parsedHours = std::stoul(subMatches[1]);
-            unsigned int parsedMinutes = std::stoul(subMatches[2]);
-
-            if (IsValidTime(parsedHours, parsedMinutes, 0))
-            {
-                hours = parsedHours;
-                minutes = parsedMinutes;
-                return true;
-            }
-        }
+        hours = parsedHours;
+        minutes = parsedMinutes;
+        return true;
     }
     return false;
 }
@@ -298,24 +603,62 @@ bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned i
 // Parses a date of the form YYYY-MM-DD
 bool DateTimePreparser::TryParseSimpleDate(const std::string& string, unsigned int& year, unsigned int& month, unsigned int& day)
 {
-    std::smatch subMatches;
-    static const std::regex dateMatch(R"regex(^(\d{4})-(\d{2})-(\d{2})$)regex");
-    if (std::regex_match(string, subMatches, dateMatch))
+    unsigned int parsedYear{}, parsedMonth{}, parsedDay{};
+    if (string.size() == 10 && ScanDigits(string, 0, 4, parsedYear) && string[4] == '-' &&
+        ScanDigits(string, 5, 2, parsedMonth) && string[7] == '-' && ScanDigits(string, 8, 2, parsedDay) &&
+        IsValidDate(parsedYear, parsedMonth, parsedDay))
     {
-        if (subMatches[1].matched && subMatches[2].matched && subMatches[3].matched)
-        {
-            unsigned int parsedYear = std::stoul(subMatches[1]);
-            unsigned int parsedMonth = std::stoul(subMatches[2]);
-            unsigned int parsedDay = std::stoul(subMatches[3]);
+        year = parsedYear;
+        month = parsedMonth;
+        day = parsedDay;
+        return true;
+    }
+    return false;
+}
 
-            if (IsValidDate(parsedYear, parsedMonth, parsedDay))
-            {
-                year = parsedYear;
-                month = parsedMonth;
-                day = parsedDay;
-                return true;
-            }
+struct MemoizedDateTimePreparser::Entry
+{
+    unsigned int generation;
+    DateTimePreparser preparser;
+    // an entry made for an earlier time zone; someone may still hold a reference to its preparser
+    std::shared_ptr<const Entry> previous;
+};
+
+MemoizedDateTimePreparser::MemoizedDateTimePreparser(const MemoizedDateTimePreparser& other) :
+    m_entry(std::atomic_load(&other.m_entry))
+{
+}
+
+MemoizedDateTimePreparser& MemoizedDateTimePreparser::operator=(const MemoizedDateTimePreparser& other)
+{
+    std::atomic_store(&m_entry, std::atomic_load(&other.m_entry));
+    return *this;
+}
+
+const DateTimePreparser& MemoizedDateTimePreparser::Get(const std::string& text) const
+{
+    auto entry = std::atomic_load(&m_entry);
+    // text without dates reads the same in any time zone
+    if (entry && !entry->preparser.HasDateTokens())
+    {
+        return entry->preparser;
+    }
+
+    const unsigned int generation = CheckTimeZone();
+    while (!entry || entry->generation != generation)
+    {
+        auto fresh = std::make_shared<const Entry>(Entry{generation, DateTimePreparser(text), entry});
+
+        // another thread may have got there first, in which case its entry is as good as ours
+        if (std::atomic_compare_exchange_strong(&m_entry, &entry, fresh))
+        {
+            entry = std::move(fresh);
         }
     }
-    return false;
+    return entry->preparser;
+}
+
+void MemoizedDateTimePreparser::Reset()
+{
+    std::atomic_store(&m_entry, std::shared_ptr<const Entry>());
 }
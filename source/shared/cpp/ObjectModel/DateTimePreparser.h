@@ -12,21 +12,43 @@ class DateTimePreparser
 public:
     DateTimePreparser();
     DateTimePreparser(const std::string& in);
-    std::vector<std::shared_ptr<DateTimePreparsedToken>> GetTextTokens() const;
+    const std::vector<std::shared_ptr<DateTimePreparsedToken>>& GetTextTokens() const;
     bool HasDateTokens() const;
     static bool TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes);
     static bool TryParseSimpleDate(const std::string& string, unsigned int& year, unsigned int& month, unsigned int& day);
 
+    // Local time zone offsets are cached per thread, and dropped whenever the C runtime's time zone (re-read with
+    // tzset as dates are converted) turns out to have changed. This drops them regardless.
+    static void ResetTimeZoneCache();
+
 private:
-    void AddTextToken(const std::string& text, DateTimePreparsedTokenFormat format);
-    void AddDateToken(const std::string& text, struct tm& date, DateTimePreparsedTokenFormat format);
+    void AddTextToken(std::string_view text, DateTimePreparsedTokenFormat format);
+    void AddDateToken(std::string_view text, struct tm& date, DateTimePreparsedTokenFormat format);
     std::string Concatenate() const;
     void ParseDateTime(const std::string& in);
     static inline bool IsValidDate(const int year, const int month, const int day);
     static inline bool IsValidTime(const int hours, const int minutes, const int seconds);
-    static inline bool IsValidTimeAndDate(const struct tm& parsedTm, const int hours, const int minutes);
 
     std::vector<std::shared_ptr<DateTimePreparsedToken>> m_textTokenCollection;
     bool m_hasDateTokens;
 };
+
+// The DateTimePreparser of an element's text, made the first time it's asked for and kept until Reset is called
+// (i.e. the text changes) or, if the text has dates in it, the time zone changes or its cache is reset. Get may be
+// called from several threads at once; the reference it returns stays valid until Reset.
+class MemoizedDateTimePreparser
+{
+public:
+    MemoizedDateTimePreparser() = default;
+    MemoizedDateTimePreparser(const MemoizedDateTimePreparser& other);
+    MemoizedDateTimePreparser& operator=(const MemoizedDateTimePreparser& other);
+    ~MemoizedDateTimePreparser() = default;
+
+    const DateTimePreparser& Get(const std::string& text) const;
+    void Reset();
+
+private:
+    struct Entry;
+    mutable std::shared_ptr<const Entry> m_entry;
+};
 } // namespace AdaptiveCards
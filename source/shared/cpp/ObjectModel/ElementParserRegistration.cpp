@@ -11,6 +11,7 @@
 #include "FactSet.h"
 #include "Image.h"
 #include "ImageSet.h"
+#include "ParseInstrumentation.h"
 #include "Media.h"
 #include "NumberInput.h"
 #include "RichTextBlock.h"
@@ -23,6 +24,29 @@
 
 namespace AdaptiveCards
 {
+namespace
+{
+    constexpr std::array<CardElementType, 18> c_knownElementTypes{
+        CardElementType::ActionSet,
+        CardElementType::ChoiceSetInput,
+        CardElementType::Column,
+        CardElementType::ColumnSet,
+        CardElementType::Container,
+        CardElementType::DateInput,
+        CardElementType::FactSet,
+        CardElementType::Image,
+        CardElementType::ImageSet,
+        CardElementType::Media,
+        CardElementType::NumberInput,
+        CardElementType::RichTextBlock,
+        CardElementType::Table,
+        CardElementType::TextBlock,
+        CardElementType::TextInput,
+        CardElementType::TimeInput,
+        CardElementType::ToggleInput,
+        CardElementType::Unknown};
+} // namespace
+
 BaseCardElementParserWrapper::BaseCardElementParserWrapper(std::shared_ptr<BaseCardElementParser> parserToWrap) :
     m_parser{parserToWrap}
 {
@@ -30,11 +54,19 @@ BaseCardElementParserWrapper::BaseCardElementParserWrapper(std::shared_ptr<BaseC
 
 std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::Deserialize(ParseContext& context, const Json::Value& value)
 {
-    const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
+    return DeserializeWithParser(*m_parser, context, value);
+}
+
+std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::DeserializeWithParser(
+    BaseCardElementParser& parser, ParseContext& context, const Json::Value& value)
+{
+#ifndef ADAPTIVECARDS_DISABLE_PARSE_INSTRUMENTATION
+    const ParseInstrumentationScope instrumentationScope(context, ParseInstrumentation::ElementKind::CardElement, value);
+#endif
     const InternalId internalId = InternalId::Next();
 
-    context.PushElement(idProperty, internalId);
-    std::shared_ptr<BaseCardElement> element = m_parser->Deserialize(context, value);
+    context.PushElement(ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id), internalId);
+    std::shared_ptr<BaseCardElement> element = parser.Deserialize(context, value);
     context.PopElement();
 
     return element;
@@ -45,54 +77,87 @@ std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::DeserializeFromSt
     return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
 }
 
-ElementParserRegistration::ElementParserRegistration()
+ElementParserRegistration::ElementParserRegistration() : m_cardElementParsers{GetDefaultParsers()}
+{
+}
+
+const std::shared_ptr<ElementParserRegistration::ParserMap>& ElementParserRegistration::GetDefaultParsers()
+{
+    // The built-in parsers keep no state of their own, so one instance of each can serve every thread. Holding a
+    // reference here keeps the map shared, so GetWritableParsers never changes it in place.
+    static const std::shared_ptr<ParserMap> defaultParsers = std::make_shared<ParserMap>(ParserMap{
+        {CardElementTypeToString(CardElementType::ActionSet), std::make_shared<ActionSetParser>()},
+        {CardElementTypeToString(CardElementType::ChoiceSetInput), std::make_shared<ChoiceSetInputParser>()},
+        {CardElementTypeToString(CardElementType::Column), std::make_shared<ColumnParser>()},
+        {CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>()},
+        {CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>()},
+        {CardElementTypeToString(CardElementType::DateInput), std::make_shared<DateInputParser>()},
+        {CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>()},
+        {CardElementTypeToString(CardElementType::Image), std::make_shared<ImageParser>()},
+        {CardElementTypeToString(CardElementType::ImageSet), std::make_shared<ImageSetParser>()},
+        {CardElementTypeToString(CardElementType::Media), std::make_shared<MediaParser>()},
+        {CardElementTypeToString(CardElementType::NumberInput), std::make_shared<NumberInputParser>()},
+        {CardElementTypeToString(CardElementType::RichTextBlock), std::make_shared<RichTextBlockParser>()},
+        {CardElementTypeToString(CardElementType::Table), std::make_shared<TableParser>()},
+        {CardElementTypeToString(CardElementType::TextBlock), std::make_shared<TextBlockParser>()},
+        {CardElementTypeToString(CardElementType::TextInput), std::make_shared<TextInputParser>()},
+        {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
+        {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
+        {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}});
+    return defaultParsers;
+}
+
+std::optional<CardElementType> ElementParserRegistration::TryGetKnownElementType(std::string_view elementType)
 {
-    m_knownElements.insert(
-        {CardElementTypeToString(CardElementType::ActionSet),
-         CardElementTypeToString(CardElementType::ChoiceSetInput),
-         CardElementTypeToString(CardElementType::Column),
-         CardElementTypeToString(CardElementType::ColumnSet),
-         CardElementTypeToString(CardElementType::Container),
-         CardElementTypeToString(CardElementType::DateInput),
-         CardElementTypeToString(CardElementType::FactSet),
-         CardElementTypeToString(CardElementType::Image),
-         CardElementTypeToString(CardElementType::ImageSet),
-         CardElementTypeToString(CardElementType::Media),
-         CardElementTypeToString(CardElementType::NumberInput),
-         CardElementTypeToString(CardElementType::RichTextBlock),
-         CardElementTypeToString(CardElementType::Table),
-         CardElementTypeToString(CardElementType::TextBlock),
-         CardElementTypeToString(CardElementType::TextInput),
-         CardElementTypeToString(CardElementType::TimeInput),
-         CardElementTypeToString(CardElementType::ToggleInput),
-         CardElementTypeToString(CardElementType::Unknown)});
-
-    m_cardElementParsers.insert(
-        {{CardElementTypeToString(CardElementType::ActionSet), std::make_shared<ActionSetParser>()},
-         {CardElementTypeToString(CardElementType::ChoiceSetInput), std::make_shared<ChoiceSetInputParser>()},
-         {CardElementTypeToString(CardElementType::Column), std::make_shared<ColumnParser>()},
-         {CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>()},
-         {CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>()},
-         {CardElementTypeToString(CardElementType::DateInput), std::make_shared<DateInputParser>()},
-         {CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>()},
-         {CardElementTypeToString(CardElementType::Image), std::make_shared<ImageParser>()},
-         {CardElementTypeToString(CardElementType::ImageSet), std::make_shared<ImageSetParser>()},
-         {CardElementTypeToString(CardElementType::Media), std::make_shared<MediaParser>()},
-         {CardElementTypeToString(CardElementType::NumberInput), std::make_shared<NumberInputParser>()},
-         {CardElementTypeToString(CardElementType::RichTextBlock), std::make_shared<RichTextBlockParser>()},
-         {CardElementTypeToString(CardElementType::Table), std::make_shared<TableParser>()},
-         {CardElementTypeToString(CardElementType::TextBlock), std::make_shared<TextBlockParser>()},
-         {CardElementTypeToString(CardElementType::TextInput), std::make_shared<TextInputParser>()},
-         {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
-         {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
-         {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}});
+    static const auto knownElementNames = []() {
+        std::array<std::string_view, c_knownElementTypes.size()> names;
+        std::transform(c_knownElementTypes.begin(), c_knownElementTypes.end(), names.begin(), [](CardElementType type) {
+            return std::string_view(CardElementTypeToString(type));
+        });
+        return names;
+    }();
+
+    for (std::size_t i = 0; i < knownElementNames.size(); ++i)
+    {
+        if (knownElementNames[i].size() == elementType.size() && CaseInsensitiveEqualTo{}(knownElementNames[i], elementType))
+        {
+            return c_knownElementTypes[i];
+        }
+    }
+    return std::nullopt;
+}
+
+BaseCardElementParser& ElementParserRegistration::GetKnownParser(CardElementType elementType)
+{
+    // indexed by CardElementType; the default parsers outlive every use of these pointers
+    static const auto knownParsers = []() {
+        std::array<BaseCardElementParser*, static_cast<std::size_t>(CardElementType::Unknown) + 1> parsers{};
+        for (const auto type : c_knownElementTypes)
+        {
+            parsers[static_cast<std::size_t>(type)] = GetDefaultParsers()->at(CardElementTypeToString(type)).get();
+        }
+        return parsers;
+    }();
+
+    return *knownParsers[static_cast<std::size_t>(elementType)];
+}
+
+ElementParserRegistration::ParserMap& ElementParserRegistration::GetWritableParsers()
+{
+    // copy the map the first time it changes while it's still shared, whether with the defaults or with a copy of
+    // this registration
+    if (m_cardElementParsers.use_count() > 1)
+    {
+        m_cardElementParsers = std::make_shared<ParserMap>(*m_cardElementParsers);
+    }
+    return *m_cardElementParsers;
 }
 
 void ElementParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<BaseCardElementParser> parser)
 {
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (!TryGetKnownElementType(elementType))
     {
-        ElementParserRegistration::m_cardElementParsers[elementType] = parser;
+        GetWritableParsers()[elementType] = parser;
     }
     else
     {
@@ -103,9 +168,9 @@ void ElementParserRegistration::AddParser(std::string const& elementType, std::s
 
 void ElementParserRegistration::RemoveParser(std::string const& elementType)
 {
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (!TryGetKnownElementType(elementType))
     {
-        ElementParserRegistration::m_cardElementParsers.erase(elementType);
+        GetWritableParsers().erase(elementType);
     }
     else
     {
@@ -116,8 +181,8 @@ void ElementParserRegistration::RemoveParser(std::string const& elementType)
 
 std::shared_ptr<BaseCardElementParser> ElementParserRegistration::GetParser(std::string const& elementType) const
 {
-    auto parser = m_cardElementParsers.find(elementType);
-    if (parser != ElementParserRegistration::m_cardElementParsers.end())
+    auto parser = m_cardElementParsers->find(elementType);
+    if (parser != m_cardElementParsers->end())
     {
         // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
         // collision detection. We *could* do this within the implementation of parsers themselves, but that would
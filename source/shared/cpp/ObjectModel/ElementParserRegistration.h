@@ -30,6 +30,10 @@ public:
 
     std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& value) override;
     std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& value) override;
+
+    // Does what Deserialize does for the given parser, without a wrapper having to be made for it
+    static std::shared_ptr<BaseCardElement> DeserializeWithParser(BaseCardElementParser& parser, ParseContext& context, const Json::Value& value);
+
     std::shared_ptr<BaseCardElementParser> GetActualParser() const
     {
         return m_parser;
@@ -39,6 +43,8 @@ private:
     std::shared_ptr<BaseCardElementParser> m_parser;
 };
 
+// Every registration starts out sharing a single read-only map of the built-in parsers, so creating one (as every
+// ParseContext does) costs next to nothing. The first AddParser or RemoveParser gives the registration a copy of its own.
 class ElementParserRegistration
 {
 public:
@@ -48,8 +54,19 @@ public:
     void RemoveParser(std::string const& elementType);
     std::shared_ptr<AdaptiveCards::BaseCardElementParser> GetParser(std::string const& elementType) const;
 
+    // The element types with built-in parsers can't be overridden or removed, so every registration parses them the
+    // same way. TryGetKnownElementType matches elementType against their names, ignoring case as GetParser does, and
+    // GetKnownParser hands back the (unwrapped) parser for a type it returned.
+    static std::optional<CardElementType> TryGetKnownElementType(std::string_view elementType);
+    static BaseCardElementParser& GetKnownParser(CardElementType elementType);
+
 private:
-    std::unordered_set<std::string> m_knownElements;
-    std::unordered_map<std::string, std::shared_ptr<AdaptiveCards::BaseCardElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_cardElementParsers;
+    using ParserMap =
+        std::unordered_map<std::string, std::shared_ptr<AdaptiveCards::BaseCardElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo>;
+
+    static const std::shared_ptr<ParserMap>& GetDefaultParsers();
+    ParserMap& GetWritableParsers();
+
+    std::shared_ptr<ParserMap> m_cardElementParsers;
 };
 } // namespace AdaptiveCards
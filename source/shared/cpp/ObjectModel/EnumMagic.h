@@ -5,24 +5,42 @@
 
 namespace AdaptiveCards
 {
+// Case folding for the ASCII letters alone, for any character type. Everything we match without regard to case (type
+// names, enum values, feature names) is ASCII, and unlike std::toupper/std::tolower these consult no locale, so they
+// cost a compare and a subtract per character and vectorize in loops. Other characters, including the bytes of UTF-8
+// sequences, are left as they are.
+template <typename CharT>
+constexpr CharT AsciiToUpper(CharT c) noexcept
+{
+    return (c >= CharT('a') && c <= CharT('z')) ? static_cast<CharT>(c - CharT('a' - 'A')) : c;
+}
+
+template <typename CharT>
+constexpr CharT AsciiToLower(CharT c) noexcept
+{
+    return (c >= CharT('A') && c <= CharT('Z')) ? static_cast<CharT>(c + CharT('a' - 'A')) : c;
+}
+
 struct CaseInsensitiveEqualTo
 {
     template <typename T>
     bool operator()(T const& lhs, T const& rhs) const noexcept
     {
         return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs), [](auto a, auto b) {
-            return std::toupper(a) == std::toupper(b);
+            return AsciiToUpper(a) == AsciiToUpper(b);
         });
     }
 };
 
+// FNV-1a over the upper-cased characters. (A plain sum of characters would send every anagram to the same bucket.)
 struct CaseInsensitiveHash
 {
     template <typename T>
     size_t operator()(T const& keyval) const noexcept
     {
-        return std::accumulate(
-            std::cbegin(keyval), std::cend(keyval), size_t{0}, [](size_t acc, auto c) { return acc + std::toupper(c); });
+        return std::accumulate(std::cbegin(keyval), std::cend(keyval), size_t{2166136261u}, [](size_t acc, auto c) {
+            return (acc ^ static_cast<size_t>(AsciiToUpper(c))) * size_t{16777619u};
+        });
     }
 };
 
@@ -37,46 +55,130 @@ struct EnumHash
 
 namespace EnumHelpers
 {
-    // Manage mapping T<->std::string using two internal unordered_maps.
+    // Manage mapping T<->std::string. Enum values index straight into an array of names, and names are looked up
+    // (case-insensitively) through a perfect hash table that's built the first time the mapping is used.
     template <typename T>
     class EnumMapping
     {
     public:
         // Initialize with a single list -> automatically generate reverse mapping
-        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t) :
-            _enumToString{t.begin(), t.end()}, _stringToEnum(t.size())
-        {
-            _GenerateStringToEnumMap();
-        }
+        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t) : EnumMapping(t, {}) {}
 
         // Initialize with two lists -> t1 is our forward list and t2 contains additional terms to use in addition
         // to the generated reverse mapping
-        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t1, const std::initializer_list<std::pair<std::string, T>>& t2) :
-            _enumToString{t1.begin(), t1.end()}, _stringToEnum(t2.begin(), t2.end())
+        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t1, const std::initializer_list<std::pair<std::string, T>>& t2)
         {
-            _GenerateStringToEnumMap();
+            for (const auto& kv : t1)
+            {
+                const auto index = static_cast<size_t>(kv.first);
+                if (index >= _enumToString.size())
+                {
+                    _enumToString.resize(index + 1);
+                }
+                if (!_enumToString[index].has_value())
+                {
+                    _enumToString[index] = kv.second;
+                }
+            }
+
+            // as with the maps this replaced, additional terms win over generated ones, and the first of any
+            // duplicate names wins
+            for (const auto& kv : t2)
+            {
+                _AddName(kv.first, kv.second);
+            }
+            for (const auto& kv : t1)
+            {
+                _AddName(kv.second, kv.first);
+            }
+            _BuildStringToEnumTable();
         }
 
         const std::string& toString(T t) const
         {
-            return _enumToString.at(t);
+            const auto index = static_cast<size_t>(t);
+            if (index >= _enumToString.size() || !_enumToString[index].has_value())
+            {
+                throw std::out_of_range("Unmapped enum value");
+            }
+            return *_enumToString[index];
         }
+
         T fromString(const std::string& str) const
         {
-            return _stringToEnum.at(str);
+            if (const auto value = tryFromString(str))
+            {
+                return *value;
+            }
+            throw std::out_of_range("Unmapped enum string");
+        }
+
+        std::optional<T> tryFromString(const std::string& str) const
+        {
+            const auto slot = _stringToEnum[_Hash(str, _seed) & (_stringToEnum.size() - 1)];
+            if (slot != 0 && CaseInsensitiveEqualTo{}(_names[slot - 1].first, str))
+            {
+                return _names[slot - 1].second;
+            }
+            return std::nullopt;
         }
 
     private:
-        inline void _GenerateStringToEnumMap()
+        static size_t _Hash(const std::string& str, size_t seed) noexcept
+        {
+            size_t hash = size_t{2166136261u} ^ (seed * size_t{0x9E3779B9u});
+            for (const char c : str)
+            {
+                hash = (hash ^ static_cast<unsigned char>(AsciiToUpper(c))) * size_t{16777619u};
+            }
+            return hash ^ (hash >> 15);
+        }
+
+        void _AddName(const std::string& name, T value)
+        {
+            const bool isDuplicate = std::any_of(_names.begin(), _names.end(), [&name](const auto& existing) {
+                return CaseInsensitiveEqualTo{}(existing.first, name);
+            });
+            if (!isDuplicate)
+            {
+                _names.emplace_back(name, value);
+            }
+        }
+
+        // Find a seed (growing the table if we have to) that sends every name to its own slot, so that a lookup is
+        // one hash plus one string compare.
+        void _BuildStringToEnumTable()
         {
-            for (const auto& kv : _enumToString)
+            size_t tableSize = 1;
+            while (tableSize < 2 * _names.size())
+            {
+                tableSize *= 2;
+            }
+
+            for (;; tableSize *= 2)
             {
-                _stringToEnum.emplace(kv.second, kv.first);
+                for (_seed = 0; _seed < 256; ++_seed)
+                {
+                    _stringToEnum.assign(tableSize, 0);
+                    bool collided = false;
+                    for (size_t i = 0; i < _names.size() && !collided; ++i)
+                    {
+                        auto& slot = _stringToEnum[_Hash(_names[i].first, _seed) & (tableSize - 1)];
+                        collided = (slot != 0);
+                        slot = static_cast<unsigned short>(i + 1);
+                    }
+                    if (!collided)
+                    {
+                        return;
+                    }
+                }
             }
         }
 
-        const std::unordered_map<T, std::string, EnumHash> _enumToString;
-        std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqualTo> _stringToEnum;
+        std::vector<std::optional<std::string>> _enumToString;
+        std::vector<std::pair<std::string, T>> _names;
+        std::vector<unsigned short> _stringToEnum; // index into _names, plus one (zero marks an empty slot)
+        size_t _seed = 0;
     };
 } // namespace EnumHelpers
 
@@ -87,7 +189,8 @@ namespace EnumHelpers
         const EnumMapping<ENUMTYPE>& get##ENUMTYPE##Enum(); \
     } \
     const std::string& ENUMTYPE##ToString(const ENUMTYPE t); \
-    ENUMTYPE ENUMTYPE##FromString(const std::string& t);
+    ENUMTYPE ENUMTYPE##FromString(const std::string& t); \
+    std::optional<ENUMTYPE> ENUMTYPE##TryFromString(const std::string& t);
 
 #define _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, ...) \
     namespace EnumHelpers \
@@ -103,18 +206,20 @@ namespace EnumHelpers
         return EnumHelpers::get##ENUMTYPE##Enum().toString(t); \
     }
 
-// Define mapping functions for ENUMTYPE. Throw an exception if caller passes in a string that doesn't map
+// Define mapping functions for ENUMTYPE. FromString throws if the caller passes in a string that doesn't map, while
+// TryFromString returns std::nullopt instead.
 #define DEFINE_ADAPTIVECARD_ENUM(ENUMTYPE, ...) \
     _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, __VA_ARGS__); \
     ENUMTYPE ENUMTYPE##FromString(const std::string& t) \
     { \
-        try \
-        { \
-            return EnumHelpers::get##ENUMTYPE##Enum().fromString(t); \
-        } \
-        catch (const std::out_of_range&) \
+        if (const auto value = EnumHelpers::get##ENUMTYPE##Enum().tryFromString(t)) \
         { \
-            throw std::out_of_range("Invalid " #ENUMTYPE ": " + t); \
+            return *value; \
         } \
+        throw std::out_of_range("Invalid " #ENUMTYPE ": " + t); \
+    } \
+    std::optional<ENUMTYPE> ENUMTYPE##TryFromString(const std::string& t) \
+    { \
+        return EnumHelpers::get##ENUMTYPE##Enum().tryFromString(t); \
     }
 } // namespace AdaptiveCards
@@ -51,9 +51,9 @@ void ExecuteAction::SetAssociatedInputs(const AssociatedInputs value)
     m_associatedInputs = value;
 }
 
-Json::Value ExecuteAction::SerializeToJsonValue() const
+void ExecuteAction::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseActionElement::SerializeToJsonValue();
+    BaseActionElement::SerializeProperties(root);
 
     if (!m_dataJson.empty())
     {
@@ -69,8 +69,11 @@ Json::Value ExecuteAction::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AssociatedInputs)] = AssociatedInputsToString(m_associatedInputs);
     }
+}
 
-    return root;
+void ExecuteAction::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::shared_ptr<BaseActionElement> ExecuteActionParser::Deserialize(ParseContext& context, const Json::Value& json)
@@ -80,7 +83,7 @@ std::shared_ptr<BaseActionElement> ExecuteActionParser::Deserialize(ParseContext
     executeAction->SetDataJson(ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Data));
     executeAction->SetVerb(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Verb));
     executeAction->SetAssociatedInputs(ParseUtil::GetEnumValue<AssociatedInputs>(
-        json, AdaptiveCardSchemaKey::AssociatedInputs, AssociatedInputs::Auto, AssociatedInputsFromString));
+        json, AdaptiveCardSchemaKey::AssociatedInputs, AssociatedInputs::Auto, AssociatedInputsTryFromString));
 
     return executeAction;
 }
@@ -92,8 +95,9 @@ std::shared_ptr<BaseActionElement> ExecuteActionParser::DeserializeFromString(Pa
 
 void ExecuteAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Verb),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AssociatedInputs)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Data,
+         AdaptiveCardSchemaKey::Verb,
+         AdaptiveCardSchemaKey::AssociatedInputs});
+    m_knownProperties = &knownProperties;
 }
@@ -29,7 +29,9 @@ public:
     virtual AssociatedInputs GetAssociatedInputs() const;
     virtual void SetAssociatedInputs(const AssociatedInputs value);
 
-    Json::Value SerializeToJsonValue() const override;
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
 
 private:
     void PopulateKnownPropertiesSet();
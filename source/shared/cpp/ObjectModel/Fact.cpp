@@ -22,11 +22,13 @@ std::shared_ptr<Fact> Fact::Deserialize(ParseContext& context, const Json::Value
 
     if (title.empty() && value.empty())
     {
-        context.warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+        context.warnings.emplace_back(context.MakeShared<AdaptiveCardParseWarning>(
             WarningStatusCode::RequiredPropertyMissing,
             "non-empty string has to be given for either title or value, none given"));
     }
-    auto fact = std::make_shared<Fact>(title, value);
+    auto fact = context.MakeShared<Fact>();
+    fact->SetTitle(std::move(title));
+    fact->SetValue(std::move(value));
     fact->SetLanguage(context.GetLanguage());
 
     return fact;
@@ -56,9 +58,16 @@ std::string Fact::GetTitle() const
     return m_title;
 }
 
+void Fact::SetTitle(std::string&& value)
+{
+    m_title = std::move(value);
+    m_titleDateTimePreparser.Reset();
+}
+
 void Fact::SetTitle(const std::string& value)
 {
     m_title = value;
+    m_titleDateTimePreparser.Reset();
 }
 
 std::string Fact::GetValue() const
@@ -66,19 +75,26 @@ std::string Fact::GetValue() const
     return m_value;
 }
 
+void Fact::SetValue(std::string&& value)
+{
+    m_value = std::move(value);
+    m_valueDateTimePreparser.Reset();
+}
+
 void Fact::SetValue(const std::string& value)
 {
     m_value = value;
+    m_valueDateTimePreparser.Reset();
 }
 
-DateTimePreparser Fact::GetTitleForDateParsing() const
+const DateTimePreparser& Fact::GetTitleForDateParsing() const
 {
-    return DateTimePreparser(m_title);
+    return m_titleDateTimePreparser.Get(m_title);
 }
 
-DateTimePreparser Fact::GetValueForDateParsing() const
+const DateTimePreparser& Fact::GetValueForDateParsing() const
 {
-    return DateTimePreparser(m_value);
+    return m_valueDateTimePreparser.Get(m_value);
 }
 
 const std::string& Fact::GetLanguage() const
@@ -18,12 +18,14 @@ public:
     Json::Value SerializeToJsonValue();
 
     std::string GetTitle() const;
+    void SetTitle(std::string&& value);
     void SetTitle(const std::string& value);
 
     std::string GetValue() const;
+    void SetValue(std::string&& value);
     void SetValue(const std::string& value);
-    DateTimePreparser GetTitleForDateParsing() const;
-    DateTimePreparser GetValueForDateParsing() const;
+    const DateTimePreparser& GetTitleForDateParsing() const;
+    const DateTimePreparser& GetValueForDateParsing() const;
 
     void SetLanguage(const std::string& value);
     const std::string& GetLanguage() const;
@@ -35,5 +37,7 @@ private:
     std::string m_title;
     std::string m_value;
     std::string m_language;
+    MemoizedDateTimePreparser m_titleDateTimePreparser;
+    MemoizedDateTimePreparser m_valueDateTimePreparser;
 };
 } // namespace AdaptiveCards
@@ -23,9 +23,9 @@ std::vector<std::shared_ptr<Fact>>& FactSet::GetFacts()
     return m_facts;
 }
 
-Json::Value FactSet::SerializeToJsonValue() const
+void FactSet::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseCardElement::SerializeToJsonValue();
+    BaseCardElement::SerializeProperties(root);
 
     const std::string& factsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts);
     root[factsPropertyName] = Json::Value(Json::arrayValue);
@@ -33,8 +33,11 @@ Json::Value FactSet::SerializeToJsonValue() const
     {
         root[factsPropertyName].append(fact->SerializeToJsonValue());
     }
+}
 
-    return root;
+void FactSet::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::shared_ptr<BaseCardElement> FactSetParser::Deserialize(ParseContext& context, const Json::Value& value)
@@ -49,7 +52,7 @@ std::shared_ptr<BaseCardElement> FactSetParser::Deserialize(ParseContext& contex
 
     if (facts.empty())
     {
-        context.warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+        context.warnings.emplace_back(context.MakeShared<AdaptiveCardParseWarning>(
             WarningStatusCode::RequiredPropertyMissing, "required property, \"fact\", is missing"));
     }
 
@@ -65,5 +68,6 @@ std::shared_ptr<BaseCardElement> FactSetParser::DeserializeFromString(ParseConte
 
 void FactSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts)});
+    static const auto knownProperties = ExtendKnownProperties({AdaptiveCardSchemaKey::Facts});
+    m_knownProperties = &knownProperties;
 }
@@ -22,11 +22,13 @@ public:
     FactSet& operator=(FactSet&&) = default;
     ~FactSet() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::vector<std::shared_ptr<Fact>>& GetFacts();
     const std::vector<std::shared_ptr<Fact>>& GetFacts() const;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
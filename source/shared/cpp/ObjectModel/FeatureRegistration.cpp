@@ -22,14 +22,11 @@ void FeatureRegistration::AddFeature(std::string const& featureName, const std::
         const SemanticVersion version(featureVersion);
     }
 
-    if (m_supportedFeatures.find(featureName) == m_supportedFeatures.end())
-    {
-        m_supportedFeatures[featureName] = featureVersion;
-    }
-    else
+    const auto [feature, added] = m_supportedFeatures.emplace(featureName, featureVersion);
+    if (!added)
     {
         // only allow a duplicate add attempt if the version is the same.
-        if (m_supportedFeatures[featureName] != featureVersion)
+        if (feature->second != featureVersion)
         {
             throw AdaptiveCardParseException(
                 ErrorStatusCode::InvalidPropertyValue, "Attempting to add a feature with a differing version");
@@ -56,9 +53,10 @@ SemanticVersion FeatureRegistration::GetAdaptiveCardsVersion() const
 
 std::string FeatureRegistration::GetFeatureVersion(const std::string& featureName) const
 {
-    if (m_supportedFeatures.find(featureName) != m_supportedFeatures.end())
+    const auto feature = m_supportedFeatures.find(featureName);
+    if (feature != m_supportedFeatures.end())
     {
-        return m_supportedFeatures.at(featureName);
+        return feature->second;
     }
     else
     {
@@ -9,26 +9,9 @@ namespace AdaptiveCards
 {
 constexpr const char* const c_adaptiveCardsFeature = "adaptiveCards";
 
-namespace ParseUtil
-{
-    std::string ToLowercase(const std::string& value);
-}
-
-struct CaseInsensitiveKeyHash
-{
-    size_t operator()(const std::string& keyVal) const
-    {
-        return std::hash<std::string>{}(ParseUtil::ToLowercase(keyVal));
-    }
-};
-
-struct CaseInsensitiveKeyEquals
-{
-    bool operator()(const std::string& leftVal, const std::string& rightVal) const
-    {
-        return (ParseUtil::ToLowercase(leftVal) == ParseUtil::ToLowercase(rightVal));
-    }
-};
+// Feature names match without regard to case, folding in place rather than through lowercased copies
+using CaseInsensitiveKeyHash = CaseInsensitiveHash;
+using CaseInsensitiveKeyEquals = CaseInsensitiveEqualTo;
 
 class SemanticVersion;
 class FeatureRegistration
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "pch.h"
+#include "ArgbColor.h"
 
 namespace AdaptiveCards
 {
@@ -376,6 +377,8 @@ struct TableConfig
     static TableConfig Deserialize(const Json::Value& json, const TableConfig& defaultValue);
 };
 
+class ResolvedHostConfig;
+
 class HostConfig
 {
 public:
@@ -394,6 +397,17 @@ public:
     std::string GetBorderColor(ContainerStyle style) const;
     unsigned int GetBorderThickness(ContainerStyle style) const;
 
+    // The colors above as ArgbColors, decoded from their strings on every call (GetResolved decodes them just once)
+    ArgbColor GetBackgroundColorArgb(ContainerStyle style) const;
+    ArgbColor GetForegroundColorArgb(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+    ArgbColor GetHighlightColorArgb(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+    ArgbColor GetBorderColorArgb(ContainerStyle style) const;
+
+    // The lookups above worked out ahead of time (see ResolvedHostConfig). A HostConfig from Deserialize carries one
+    // built as it was parsed; after a change to the fonts or container styles, or on a default constructed HostConfig,
+    // each call builds a new one, so hold on to the result.
+    std::shared_ptr<const ResolvedHostConfig> GetResolved() const;
+
     std::string GetFontFamily() const;
     void SetFontFamily(const std::string& value);
 
@@ -455,6 +469,7 @@ public:
     void SetTable(const TableConfig value);
 
 private:
+    const FontTypeDefinition& GetFontTypeDefinition(FontType fontType) const;
     const ContainerStyleDefinition& GetContainerStyle(ContainerStyle style) const;
     const ColorConfig& GetContainerColorConfig(const ColorsConfig& colors, ForegroundColor color) const;
 
@@ -478,5 +493,7 @@ private:
     TextBlockConfig _textBlock;
     TextStylesConfig _textStyles;
     TableConfig _table;
+
+    std::shared_ptr<const ResolvedHostConfig> _resolved;
 };
 } // namespace AdaptiveCards
@@ -15,11 +15,11 @@ Image::Image() :
     PopulateKnownPropertiesSet();
 }
 
-Json::Value Image::SerializeToJsonValue() const
+void Image::SerializeProperties(JsonMembers& root) const
 {
     const std::string pixelstring("px");
 
-    Json::Value root = BaseCardElement::SerializeToJsonValue();
+    BaseCardElement::SerializeProperties(root);
 
     if (m_pixelWidth || m_pixelHeight)
     {
@@ -73,11 +73,13 @@ Json::Value Image::SerializeToJsonValue() const
 
     if (m_selectAction != nullptr)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction)] =
-            BaseCardElement::SerializeSelectAction(m_selectAction);
+        root.SetObject(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction), *m_selectAction);
     }
+}
 
-    return root;
+void Image::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::string Image::GetUrl() const
@@ -85,6 +87,11 @@ std::string Image::GetUrl() const
     return m_url;
 }
 
+void Image::SetUrl(std::string&& value)
+{
+    m_url = std::move(value);
+}
+
 void Image::SetUrl(const std::string& value)
 {
     m_url = value;
@@ -95,11 +102,23 @@ std::string Image::GetBackgroundColor() const
     return m_backgroundColor;
 }
 
+void Image::SetBackgroundColor(std::string&& value)
+{
+    m_backgroundColorArgb = ArgbColor::FromString(value);
+    m_backgroundColor = std::move(value);
+}
+
 void Image::SetBackgroundColor(const std::string& value)
 {
+    m_backgroundColorArgb = ArgbColor::FromString(value);
     m_backgroundColor = value;
 }
 
+ArgbColor Image::GetBackgroundColorArgb() const
+{
+    return m_backgroundColorArgb;
+}
+
 ImageStyle Image::GetImageStyle() const
 {
     return m_imageStyle;
@@ -125,6 +144,11 @@ std::string Image::GetAltText() const
     return m_altText;
 }
 
+void Image::SetAltText(std::string&& value)
+{
+    m_altText = std::move(value);
+}
+
 void Image::SetAltText(const std::string& value)
 {
     m_altText = value;
@@ -187,10 +211,10 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
 
     image->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
     image->SetBackgroundColor(ValidateColor(ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundColor), context.warnings));
-    image->SetImageStyle(ParseUtil::GetEnumValue<ImageStyle>(json, AdaptiveCardSchemaKey::Style, ImageStyle::Default, ImageStyleFromString));
+    image->SetImageStyle(ParseUtil::GetEnumValue<ImageStyle>(json, AdaptiveCardSchemaKey::Style, ImageStyle::Default, ImageStyleTryFromString));
     image->SetAltText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::AltText));
     image->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     const auto& widthDimension =
         ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Width), &context.warnings);
@@ -205,7 +229,7 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
     }
     else
     {
-        image->SetImageSize(ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, ImageSize::None, ImageSizeFromString));
+        image->SetImageSize(ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, ImageSize::None, ImageSizeTryFromString));
     }
 
     // Parse optional selectAction
@@ -215,16 +239,17 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
 
 void Image::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::AltText,
+         AdaptiveCardSchemaKey::BackgroundColor,
+         AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::HorizontalAlignment,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Url,
+         AdaptiveCardSchemaKey::Width});
+    m_knownProperties = &knownProperties;
 }
 
 void Image::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
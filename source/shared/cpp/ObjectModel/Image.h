@@ -3,6 +3,7 @@
 #pragma once
 
 #include "pch.h"
+#include "ArgbColor.h"
 #include "BaseActionElement.h"
 #include "BaseCardElement.h"
 #include "ElementParserRegistration.h"
@@ -19,13 +20,15 @@ public:
     Image& operator=(Image&&) = default;
     ~Image() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::string GetUrl() const;
+    void SetUrl(std::string&& value);
     void SetUrl(const std::string& value);
 
     std::string GetBackgroundColor() const;
+    void SetBackgroundColor(std::string&& value);
     void SetBackgroundColor(const std::string& value);
+    // The background color decoded, or transparent black if there isn't one
+    ArgbColor GetBackgroundColorArgb() const;
 
     ImageStyle GetImageStyle() const;
     void SetImageStyle(const ImageStyle value);
@@ -34,6 +37,7 @@ public:
     void SetImageSize(const ImageSize value);
 
     std::string GetAltText() const;
+    void SetAltText(std::string&& value);
     void SetAltText(const std::string& value);
 
     std::optional<HorizontalAlignment> GetHorizontalAlignment() const;
@@ -50,11 +54,16 @@ public:
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
     std::string m_url;
     std::string m_backgroundColor;
+    ArgbColor m_backgroundColorArgb;
     ImageStyle m_imageStyle;
     ImageSize m_imageSize;
     unsigned int m_pixelWidth;
@@ -33,23 +33,21 @@ std::vector<std::shared_ptr<Image>>& ImageSet::GetImages()
     return m_images;
 }
 
-Json::Value ImageSet::SerializeToJsonValue() const
+void ImageSet::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseCardElement::SerializeToJsonValue();
+    BaseCardElement::SerializeProperties(root);
 
     if (m_imageSize != ImageSize::None)
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ImageSize)] = ImageSizeToString(GetImageSize());
     }
 
-    const std::string& itemsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images);
-    root[itemsPropertyName] = Json::Value(Json::arrayValue);
-    for (const auto& image : m_images)
-    {
-        root[itemsPropertyName].append(image->SerializeToJsonValue());
-    }
+    root.SetArray(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images), m_images);
+}
 
-    return root;
+void ImageSet::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::shared_ptr<BaseCardElement> ImageSetParser::Deserialize(ParseContext& context, const Json::Value& value)
@@ -59,7 +57,7 @@ std::shared_ptr<BaseCardElement> ImageSetParser::Deserialize(ParseContext& conte
     auto imageSet = BaseCardElement::Deserialize<ImageSet>(context, value);
     // Get ImageSize
     imageSet->m_imageSize =
-        ParseUtil::GetEnumValue<ImageSize>(value, AdaptiveCardSchemaKey::ImageSize, ImageSize::None, ImageSizeFromString);
+        ParseUtil::GetEnumValue<ImageSize>(value, AdaptiveCardSchemaKey::ImageSize, ImageSize::None, ImageSizeTryFromString);
 
     // Parse Images
     auto images = ParseUtil::GetElementCollection<Image>(
@@ -80,9 +78,10 @@ std::shared_ptr<BaseCardElement> ImageSetParser::DeserializeFromString(ParseCont
 
 void ImageSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ImageSize)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Images,
+         AdaptiveCardSchemaKey::ImageSize});
+    m_knownProperties = &knownProperties;
 }
 
 void ImageSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
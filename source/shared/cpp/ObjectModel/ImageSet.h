@@ -21,8 +21,6 @@ public:
     ImageSet& operator=(ImageSet&&) = default;
     ~ImageSet() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     ImageSize GetImageSize() const;
     void SetImageSize(const ImageSize value);
 
@@ -31,6 +29,10 @@ public:
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
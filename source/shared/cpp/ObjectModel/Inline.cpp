@@ -6,6 +6,11 @@
 
 using namespace AdaptiveCards;
 
+Inline::Inline()
+{
+    PopulateKnownPropertiesSet();
+}
+
 Inline::Inline(InlineElementType type) : m_type(type)
 {
     PopulateKnownPropertiesSet();
@@ -53,5 +58,6 @@ std::shared_ptr<Inline> Inline::Deserialize(ParseContext& context, const Json::V
 
 void Inline::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const std::unordered_set<std::string> knownProperties{AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)};
+    m_knownProperties = &knownProperties;
 }
@@ -13,7 +13,7 @@ class Inline
 {
 public:
     Inline(InlineElementType type);
-    Inline() = default;
+    Inline();
     Inline(const Inline&) = default;
     Inline(Inline&&) = default;
     Inline& operator=(const Inline&) = default;
@@ -33,7 +33,7 @@ public:
     void SetAdditionalProperties(const Json::Value& additionalProperties);
 
 protected:
-    std::unordered_set<std::string> m_knownProperties;
+    const std::unordered_set<std::string>* m_knownProperties;
     Json::Value m_additionalProperties;
 
 private:
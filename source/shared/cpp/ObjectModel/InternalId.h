@@ -8,6 +8,11 @@ namespace AdaptiveCards
 {
 // Used to uniquely identify a single BaseElement-derived object through the course of deserializing. For more
 // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
+//
+// IDs are drawn from a single process-wide atomic counter, so they stay unique even when several threads parse cards
+// at the same time. Current() returns the ID most recently handed out by Next() on the calling thread, which is what
+// lets an element constructed by a parser pick up the ID its parser wrapper just pushed onto the ParseContext. As a
+// result, concurrent parses are safe as long as each thread uses its own ParseContext.
 class InternalId
 {
 public:
@@ -40,7 +45,8 @@ public:
     }
 
 private:
-    static unsigned int s_currentInternalId;
+    static std::atomic<unsigned int> s_lastAllocatedInternalId;
+    static thread_local unsigned int s_currentInternalId;
     InternalId(const unsigned int id);
     unsigned int m_internalId;
 };
@@ -0,0 +1,564 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "JsonPullReader.h"
+
+// The reading here follows jsoncpp's OurReader (jsoncpp.cpp) step for step, with the settings ParseUtil gives it, so
+// that the two agree on what's valid and on where each value begins and ends. They part ways once something is wrong:
+// OurReader works out an error message, while this reader just gives up and leaves jsoncpp to do it.
+
+namespace AdaptiveCards
+{
+namespace
+{
+    // jsoncpp's default, which ParseUtil keeps. jsoncpp throws when a document nests deeper than this.
+    constexpr unsigned int c_stackLimit = 1000;
+
+    constexpr std::size_t c_maxNameLength = 1U << 30;
+} // namespace
+
+JsonPullReader::JsonPullReader(std::string_view json) :
+    m_begin(json.data()), m_end(json.data() + json.size()), m_current(json.data()), m_rootContainers(nullptr)
+{
+}
+
+JsonPullReader::JsonPullReader(std::string_view json, const JsonPullReader& root) :
+    m_begin(json.data()), m_end(json.data() + json.size()), m_current(json.data()), m_rootContainers(&root.m_containers)
+{
+}
+
+std::optional<std::string_view> JsonPullReader::ReadRootValue()
+{
+    m_current = m_begin;
+    m_containers.clear();
+
+    const char* valueBegin = nullptr;
+    if (!ReadValue(1, valueBegin))
+    {
+        return std::nullopt;
+    }
+    return std::string_view(valueBegin, static_cast<std::size_t>(m_current - valueBegin));
+}
+
+void JsonPullReader::ForEachMember(std::string_view object, const MemberCallback& onMember) const
+{
+    JsonPullReader reader(object, *this);
+    Token objectBegin;
+    reader.SkipCommentTokens(objectBegin);
+    reader.ReadObject(1, &onMember);
+}
+
+void JsonPullReader::ForEachItem(std::string_view array, const ItemCallback& onItem) const
+{
+    JsonPullReader reader(array, *this);
+    Token arrayBegin;
+    reader.SkipCommentTokens(arrayBegin);
+    reader.ReadArray(1, &onItem);
+}
+
+bool JsonPullReader::ReadValue(unsigned int depth, const char*& valueBegin)
+{
+    if (depth > c_stackLimit)
+    {
+        return false;
+    }
+
+    Token token;
+    SkipCommentTokens(token);
+    valueBegin = token.begin;
+
+    // a walk has nothing left to check, and knows where every object and array ends
+    const bool walking = (m_rootContainers != nullptr);
+    switch (token.type)
+    {
+    case TokenType::ObjectBegin:
+    case TokenType::ArrayBegin:
+    {
+        if (walking)
+        {
+            return SkipContainer(token);
+        }
+
+        const std::size_t container = m_containers.size();
+        m_containers.emplace_back(token.begin, nullptr);
+        const bool ok = (token.type == TokenType::ObjectBegin) ? ReadObject(depth, nullptr) : ReadArray(depth, nullptr);
+        m_containers[container].second = m_current;
+        return ok;
+    }
+    case TokenType::Number:
+        return walking || IsValidNumber(token);
+    case TokenType::String:
+        return walking || IsValidString(token);
+    case TokenType::True:
+    case TokenType::False:
+    case TokenType::Null:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool JsonPullReader::ReadObject(unsigned int depth, const MemberCallback* onMember)
+{
+    // jsoncpp takes a '}' where a member name should be as the end of the object only while the last name it read
+    // is empty, which it is before the first member -- and after a member named ""
+    bool lastNameEmpty = true;
+
+    Token tokenName;
+    while (true)
+    {
+        ReadToken(tokenName);
+        while (tokenName.type == TokenType::Comment)
+        {
+            ReadToken(tokenName);
+        }
+        if (tokenName.type == TokenType::ObjectEnd && lastNameEmpty)
+        {
+            return true;
+        }
+        if (tokenName.type != TokenType::String || (m_rootContainers == nullptr && !IsValidString(tokenName)))
+        {
+            return false;
+        }
+
+        // decoding never drops a character, so only the quotes can make a name shorter than its token
+        const std::size_t nameLength = static_cast<std::size_t>(tokenName.end - tokenName.begin);
+        lastNameEmpty = (nameLength == 2);
+        if (nameLength >= c_maxNameLength)
+        {
+            return false;
+        }
+
+        Token colon;
+        ReadToken(colon);
+        if (colon.type != TokenType::MemberSeparator)
+        {
+            return false;
+        }
+
+        const char* valueBegin = nullptr;
+        if (!ReadValue(depth + 1, valueBegin))
+        {
+            return false;
+        }
+        if (onMember)
+        {
+            (*onMember)(std::string_view(tokenName.begin, nameLength),
+                        std::string_view(valueBegin, static_cast<std::size_t>(m_current - valueBegin)));
+        }
+
+        // jsoncpp lets any token stand in for the comma once a comment has come before it
+        Token comma;
+        ReadToken(comma);
+        if (comma.type != TokenType::ObjectEnd && comma.type != TokenType::ArraySeparator &&
+            comma.type != TokenType::Comment)
+        {
+            return false;
+        }
+        while (comma.type == TokenType::Comment)
+        {
+            ReadToken(comma);
+        }
+        if (comma.type == TokenType::ObjectEnd)
+        {
+            return true;
+        }
+    }
+}
+
+bool JsonPullReader::ReadArray(unsigned int depth, const ItemCallback* onItem)
+{
+    SkipSpaces();
+    if (m_current != m_end && *m_current == ']')
+    {
+        Token arrayEnd;
+        ReadToken(arrayEnd);
+        return true;
+    }
+
+    while (true)
+    {
+        const char* valueBegin = nullptr;
+        if (!ReadValue(depth + 1, valueBegin))
+        {
+            return false;
+        }
+        if (onItem)
+        {
+            (*onItem)(std::string_view(valueBegin, static_cast<std::size_t>(m_current - valueBegin)));
+        }
+
+        Token token;
+        ReadToken(token);
+        while (token.type == TokenType::Comment)
+        {
+            ReadToken(token);
+        }
+        if (token.type == TokenType::ArrayEnd)
+        {
+            return true;
+        }
+        if (token.type != TokenType::ArraySeparator)
+        {
+            return false;
+        }
+    }
+}
+
+bool JsonPullReader::SkipContainer(const Token& token)
+{
+    const auto container = std::lower_bound(
+        m_rootContainers->begin(), m_rootContainers->end(), token.begin, [](const auto& container, const char* begin) {
+            return container.first < begin;
+        });
+    m_current = container->second;
+    return true;
+}
+
+void JsonPullReader::ReadToken(Token& token)
+{
+    SkipSpaces();
+    token.begin = m_current;
+
+    bool ok = true;
+    switch (GetNextChar())
+    {
+    case '{':
+        token.type = TokenType::ObjectBegin;
+        break;
+    case '}':
+        token.type = TokenType::ObjectEnd;
+        break;
+    case '[':
+        token.type = TokenType::ArrayBegin;
+        break;
+    case ']':
+        token.type = TokenType::ArrayEnd;
+        break;
+    case '"':
+        token.type = TokenType::String;
+        ok = ReadString();
+        break;
+    case '\'': // without single quoted strings, jsoncpp reads a quote as it does a slash
+    case '/':
+        token.type = TokenType::Comment;
+        ok = ReadComment();
+        break;
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+        token.type = TokenType::Number;
+        ReadNumber(false);
+        break;
+    case '-':
+        // "-Infinity" is only for special floats, which are off
+        token.type = TokenType::Number;
+        ok = ReadNumber(true);
+        break;
+    case 't':
+        token.type = TokenType::True;
+        ok = Match("rue");
+        break;
+    case 'f':
+        token.type = TokenType::False;
+        ok = Match("alse");
+        break;
+    case 'n':
+        token.type = TokenType::Null;
+        ok = Match("ull");
+        break;
+    case ',':
+        token.type = TokenType::ArraySeparator;
+        break;
+    case ':':
+        token.type = TokenType::MemberSeparator;
+        break;
+    case '\0':
+        token.type = TokenType::EndOfStream;
+        break;
+    default:
+        ok = false;
+        break;
+    }
+    if (!ok)
+    {
+        token.type = TokenType::Error;
+    }
+    token.end = m_current;
+}
+
+void JsonPullReader::SkipCommentTokens(Token& token)
+{
+    do
+    {
+        ReadToken(token);
+    } while (token.type == TokenType::Comment);
+}
+
+void JsonPullReader::SkipSpaces()
+{
+    while (m_current != m_end && (*m_current == ' ' || *m_current == '\t' || *m_current == '\r' || *m_current == '\n'))
+    {
+        ++m_current;
+    }
+}
+
+char JsonPullReader::GetNextChar()
+{
+    return (m_current == m_end) ? '\0' : *m_current++;
+}
+
+bool JsonPullReader::Match(std::string_view pattern)
+{
+    if (static_cast<std::size_t>(m_end - m_current) < pattern.size() ||
+        std::string_view(m_current, pattern.size()) != pattern)
+    {
+        return false;
+    }
+    m_current += pattern.size();
+    return true;
+}
+
+bool JsonPullReader::ReadComment()
+{
+    const char c = GetNextChar();
+    if (c == '*')
+    {
+        return ReadCStyleComment();
+    }
+    if (c == '/')
+    {
+        ReadCppStyleComment();
+        return true;
+    }
+    return false;
+}
+
+bool JsonPullReader::ReadCStyleComment()
+{
+    while ((m_current + 1) < m_end)
+    {
+        const char c = GetNextChar();
+        if (c == '*' && *m_current == '/')
+        {
+            break;
+        }
+    }
+    return GetNextChar() == '/';
+}
+
+void JsonPullReader::ReadCppStyleComment()
+{
+    while (m_current != m_end)
+    {
+        const char c = GetNextChar();
+        if (c == '\n')
+        {
+            break;
+        }
+        if (c == '\r')
+        {
+            if (m_current != m_end && *m_current == '\n')
+            {
+                GetNextChar();
+            }
+            break;
+        }
+    }
+}
+
+bool JsonPullReader::ReadNumber(bool checkInf)
+{
+    const char* p = m_current;
+    if (checkInf && p != m_end && *p == 'I')
+    {
+        m_current = ++p;
+        return false;
+    }
+
+    // each step looks at the next character, leaving m_current on it until it's known to belong to the number
+    const auto next = [this, &p]() { return ((m_current = p) < m_end) ? *p++ : '\0'; };
+    const auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+
+    char c = '0'; // stands in for the character already read
+    while (isDigit(c))
+    {
+        c = next();
+    }
+    if (c == '.')
+    {
+        c = next();
+        while (isDigit(c))
+        {
+            c = next();
+        }
+    }
+    if (c == 'e' || c == 'E')
+    {
+        c = next();
+        if (c == '+' || c == '-')
+        {
+            c = next();
+        }
+        while (isDigit(c))
+        {
+            c = next();
+        }
+    }
+    return true;
+}
+
+bool JsonPullReader::ReadString()
+{
+    char c = '\0';
+    while (m_current != m_end)
+    {
+        c = GetNextChar();
+        if (c == '\\')
+        {
+            GetNextChar();
+        }
+        else if (c == '"')
+        {
+            break;
+        }
+    }
+    return c == '"';
+}
+
+bool JsonPullReader::IsValidNumber(const Token& token)
+{
+    // jsoncpp decodes anything that's all digits (after an optional '-') as an integer, falling back on a double when
+    // it's too big for one, and both of those always work. Anything else is up to sscanf.
+    const char* current = token.begin;
+    if (*current == '-')
+    {
+        ++current;
+    }
+    if (std::all_of(current, token.end, [](char c) { return c >= '0' && c <= '9'; }))
+    {
+        return true;
+    }
+
+    std::string buffer(token.begin, token.end);
+
+    // jsoncpp only swaps in the locale's decimal point for numbers short enough for its stack buffer
+    constexpr std::size_t jsoncppBufferSize = 32;
+    const lconv* locale = std::localeconv();
+    const char decimalPoint = locale ? *locale->decimal_point : '\0';
+    if (buffer.size() <= jsoncppBufferSize && decimalPoint != '\0' && decimalPoint != '.')
+    {
+        std::replace(buffer.begin(), buffer.end(), '.', decimalPoint);
+    }
+
+    double value = 0;
+    return std::sscanf(buffer.c_str(), "%lf", &value) == 1;
+}
+
+bool JsonPullReader::IsValidString(const Token& token)
+{
+    const char* current = token.begin + 1; // skip '"'
+    const char* end = token.end - 1;       // do not include '"'
+    while (current != end)
+    {
+        const char c = *current++;
+        if (c == '"')
+        {
+            break;
+        }
+        if (c != '\\')
+        {
+            continue;
+        }
+
+        if (current == end)
+        {
+            return false;
+        }
+        switch (*current++)
+        {
+        case '"':
+        case '/':
+        case '\\':
+        case 'b':
+        case 'f':
+        case 'n':
+        case 'r':
+        case 't':
+            break;
+        case 'u':
+            if (!IsValidUnicodeCodePoint(current, end))
+            {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+bool JsonPullReader::IsValidUnicodeCodePoint(const char*& current, const char* end)
+{
+    unsigned int codeUnit = 0;
+    if (!IsValidUnicodeEscapeSequence(current, end, codeUnit))
+    {
+        return false;
+    }
+    if (codeUnit < 0xD800 || codeUnit > 0xDBFF)
+    {
+        return true;
+    }
+
+    // the first half of a surrogate pair must be followed by "\u" and the second half
+    if (end - current < 6)
+    {
+        return false;
+    }
+    if (*current++ != '\\' || *current++ != 'u')
+    {
+        return false;
+    }
+    return IsValidUnicodeEscapeSequence(current, end, codeUnit);
+}
+
+bool JsonPullReader::IsValidUnicodeEscapeSequence(const char*& current, const char* end, unsigned int& codeUnit)
+{
+    if (end - current < 4)
+    {
+        return false;
+    }
+
+    codeUnit = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        const char c = *current++;
+        codeUnit *= 16;
+        if (c >= '0' && c <= '9')
+        {
+            codeUnit += c - '0';
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            codeUnit += c - 'a' + 10;
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            codeUnit += c - 'A' + 10;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// Reads JSON text in place, without building anything from it. ReadRootValue accepts exactly the documents that the
+// jsoncpp reader behind ParseUtil::GetJsonValueFromString does -- comments, the odd trailing comma jsoncpp lets
+// through, and anything after the root value, which is ignored. Along the way it notes where each object and array
+// ends, so that ForEachMember and ForEachItem can walk one of them without reading through everything inside it,
+// handing out the text of each of its members or items to be read (or walked) in turn.
+class JsonPullReader
+{
+public:
+    // name is the member name as written, quotes and escapes included
+    using MemberCallback = std::function<void(std::string_view name, std::string_view value)>;
+    using ItemCallback = std::function<void(std::string_view item)>;
+
+    explicit JsonPullReader(std::string_view json);
+
+    JsonPullReader(const JsonPullReader&) = delete;
+    JsonPullReader& operator=(const JsonPullReader&) = delete;
+
+    // Returns the text of the document's root value, or nothing if jsoncpp might not read the document the way this
+    // reader would -- in which case it's up to jsoncpp to parse it or to say what's wrong with it
+    std::optional<std::string_view> ReadRootValue();
+
+    // object and array must be text that ReadRootValue (or a walk of it) handed out
+    void ForEachMember(std::string_view object, const MemberCallback& onMember) const;
+    void ForEachItem(std::string_view array, const ItemCallback& onItem) const;
+
+private:
+    enum class TokenType
+    {
+        ObjectBegin,
+        ObjectEnd,
+        ArrayBegin,
+        ArrayEnd,
+        String,
+        Number,
+        True,
+        False,
+        Null,
+        ArraySeparator,
+        MemberSeparator,
+        Comment,
+        EndOfStream,
+        Error
+    };
+
+    struct Token
+    {
+        TokenType type;
+        const char* begin;
+        const char* end;
+    };
+
+    // walks text that root has already read
+    JsonPullReader(std::string_view json, const JsonPullReader& root);
+
+    bool ReadValue(unsigned int depth, const char*& valueBegin);
+    bool SkipContainer(const Token& token);
+    bool ReadObject(unsigned int depth, const MemberCallback* onMember);
+    bool ReadArray(unsigned int depth, const ItemCallback* onItem);
+
+    void ReadToken(Token& token);
+    void SkipCommentTokens(Token& token);
+    void SkipSpaces();
+    char GetNextChar();
+    bool Match(std::string_view pattern);
+    bool ReadComment();
+    bool ReadCStyleComment();
+    void ReadCppStyleComment();
+    bool ReadNumber(bool checkInf);
+    bool ReadString();
+
+    static bool IsValidNumber(const Token& token);
+    static bool IsValidString(const Token& token);
+    static bool IsValidUnicodeCodePoint(const char*& current, const char* end);
+    static bool IsValidUnicodeEscapeSequence(const char*& current, const char* end, unsigned int& codeUnit);
+
+    const char* m_begin;
+    const char* m_end;
+    const char* m_current;
+
+    // where each object and array in the document begins and ends, in the order they begin. Filled in by
+    // ReadRootValue, and used in place of reading when walking.
+    std::vector<std::pair<const char*, const char*>> m_containers;
+    const std::vector<std::pair<const char*, const char*>>* m_rootContainers;
+};
+} // namespace AdaptiveCards
@@ -0,0 +1,406 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "JsonWriter.h"
+
+namespace
+{
+// The helpers below write compact JSON exactly as the Json::StreamWriter we used to build for every call to
+// JsonToString did (no indentation, no comments, default precision), so that moving off of it doesn't change a single
+// byte of serialized output -- including jsoncpp's quirks around which strings get their non-ASCII characters escaped.
+void AppendHex16(unsigned int codepoint, std::string& output)
+{
+    static constexpr char hexDigits[] = "0123456789abcdef";
+    output += "\\u";
+    output.push_back(hexDigits[(codepoint >> 12) & 0xF]);
+    output.push_back(hexDigits[(codepoint >> 8) & 0xF]);
+    output.push_back(hexDigits[(codepoint >> 4) & 0xF]);
+    output.push_back(hexDigits[codepoint & 0xF]);
+}
+
+// Mirrors jsoncpp's utf8ToCodepoint, including how it treats malformed input
+unsigned int Utf8ToCodepoint(const char*& current, const char* end)
+{
+    constexpr unsigned int replacementCharacter = 0xFFFD;
+    const unsigned int firstByte = static_cast<unsigned char>(*current);
+
+    if (firstByte < 0x80)
+    {
+        return firstByte;
+    }
+
+    if (firstByte < 0xE0)
+    {
+        if (end - current < 2)
+        {
+            return replacementCharacter;
+        }
+        const unsigned int codepoint = ((firstByte & 0x1F) << 6) | (static_cast<unsigned int>(current[1]) & 0x3F);
+        current += 1;
+        return codepoint < 0x80 ? replacementCharacter : codepoint;
+    }
+
+    if (firstByte < 0xF0)
+    {
+        if (end - current < 3)
+        {
+            return replacementCharacter;
+        }
+        const unsigned int codepoint = ((firstByte & 0x0F) << 12) | ((static_cast<unsigned int>(current[1]) & 0x3F) << 6) |
+                                       (static_cast<unsigned int>(current[2]) & 0x3F);
+        current += 2;
+        if (codepoint >= 0xD800 && codepoint <= 0xDFFF)
+        {
+            return replacementCharacter;
+        }
+        return codepoint < 0x800 ? replacementCharacter : codepoint;
+    }
+
+    if (firstByte < 0xF8)
+    {
+        if (end - current < 4)
+        {
+            return replacementCharacter;
+        }
+        const unsigned int codepoint = ((firstByte & 0x07) << 24) | ((static_cast<unsigned int>(current[1]) & 0x3F) << 12) |
+                                       ((static_cast<unsigned int>(current[2]) & 0x3F) << 6) |
+                                       (static_cast<unsigned int>(current[3]) & 0x3F);
+        current += 3;
+        return codepoint < 0x10000 ? replacementCharacter : codepoint;
+    }
+
+    return replacementCharacter;
+}
+
+void AppendQuotedString(const char* value, const char* end, std::string& output)
+{
+    // jsoncpp only leaves a string untouched when none of its characters pass this test. Note that the comparison
+    // against ' ' is made on plain char, so whether high bytes pass it depends on the platform's char signedness.
+    const bool requiresQuoting = std::any_of(value, end, [](const char c) {
+        return c == '\\' || c == '\"' || c < ' ' || static_cast<unsigned char>(c) < 0x80;
+    });
+
+    output.push_back('"');
+    if (!requiresQuoting)
+    {
+        output.append(value, end);
+        output.push_back('"');
+        return;
+    }
+
+    for (const char* c = value; c != end; ++c)
+    {
+        switch (*c)
+        {
+        case '"':
+            output += "\\\"";
+            break;
+        case '\\':
+            output += "\\\\";
+            break;
+        case '\b':
+            output += "\\b";
+            break;
+        case '\f':
+            output += "\\f";
+            break;
+        case '\n':
+            output += "\\n";
+            break;
+        case '\r':
+            output += "\\r";
+            break;
+        case '\t':
+            output += "\\t";
+            break;
+        default:
+        {
+            unsigned int codepoint = Utf8ToCodepoint(c, end);
+            if (codepoint < 0x80 && codepoint >= 0x20)
+            {
+                output.push_back(static_cast<char>(codepoint));
+            }
+            else if (codepoint < 0x10000)
+            {
+                AppendHex16(codepoint, output);
+            }
+            else
+            {
+                // outside the Basic Multilingual Plane, so write out a surrogate pair
+                codepoint -= 0x10000;
+                AppendHex16((codepoint >> 10) + 0xD800, output);
+                AppendHex16((codepoint & 0x3FF) + 0xDC00, output);
+            }
+            break;
+        }
+        }
+    }
+    output.push_back('"');
+}
+
+void AppendDouble(double value, std::string& output)
+{
+    char buffer[36];
+    if (std::isfinite(value))
+    {
+        const int length = snprintf(buffer, sizeof(buffer), "%.17g", value);
+        std::replace(buffer, buffer + length, ',', '.');
+        output.append(buffer, length);
+
+        // preserve the fact that this was a double on input
+        if (!strchr(buffer, '.') && !strchr(buffer, 'e'))
+        {
+            output += ".0";
+        }
+    }
+    else if (value != value)
+    {
+        output += "null";
+    }
+    else
+    {
+        output += (value < 0) ? "-1e+9999" : "1e+9999";
+    }
+}
+
+template <typename T>
+void AppendInteger(T value, std::string& output)
+{
+    char buffer[24];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    output.append(buffer, result.ptr);
+}
+
+void AppendJson(const Json::Value& json, std::string& output)
+{
+    switch (json.type())
+    {
+    case Json::nullValue:
+        output += "null";
+        break;
+    case Json::intValue:
+        AppendInteger(json.asLargestInt(), output);
+        break;
+    case Json::uintValue:
+        AppendInteger(json.asLargestUInt(), output);
+        break;
+    case Json::realValue:
+        AppendDouble(json.asDouble(), output);
+        break;
+    case Json::stringValue:
+    {
+        const char* begin;
+        const char* end;
+        if (json.getString(&begin, &end))
+        {
+            AppendQuotedString(begin, end, output);
+        }
+        break;
+    }
+    case Json::booleanValue:
+        output += json.asBool() ? "true" : "false";
+        break;
+    case Json::arrayValue:
+    {
+        output.push_back('[');
+        for (auto it = json.begin(); it != json.end(); ++it)
+        {
+            if (it != json.begin())
+            {
+                output.push_back(',');
+            }
+            AppendJson(*it, output);
+        }
+        output.push_back(']');
+        break;
+    }
+    case Json::objectValue:
+    {
+        // object members iterate in the same (sorted) order that Json::Value::getMemberNames() returns them in
+        output.push_back('{');
+        for (auto it = json.begin(); it != json.end(); ++it)
+        {
+            if (it != json.begin())
+            {
+                output.push_back(',');
+            }
+            const char* nameEnd;
+            const char* name = it.memberName(&nameEnd);
+            AppendQuotedString(name, nameEnd, output);
+            output.push_back(':');
+            AppendJson(*it, output);
+        }
+        output.push_back('}');
+        break;
+    }
+    }
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+JsonWriter::JsonWriter(std::string& output) : m_output(output), m_needsSeparator(false)
+{
+}
+
+void JsonWriter::WriteValue(const Json::Value& value)
+{
+    WriteSeparator();
+    AppendJson(value, m_output);
+    m_needsSeparator = true;
+}
+
+void JsonWriter::BeginObject()
+{
+    WriteSeparator();
+    m_output.push_back('{');
+    m_needsSeparator = false;
+}
+
+void JsonWriter::WriteMemberName(std::string_view name)
+{
+    WriteSeparator();
+    AppendQuotedString(name.data(), name.data() + name.size(), m_output);
+    m_output.push_back(':');
+    m_needsSeparator = false;
+}
+
+void JsonWriter::EndObject()
+{
+    m_output.push_back('}');
+    m_needsSeparator = true;
+}
+
+void JsonWriter::BeginArray()
+{
+    WriteSeparator();
+    m_output.push_back('[');
+    m_needsSeparator = false;
+}
+
+void JsonWriter::EndArray()
+{
+    m_output.push_back(']');
+    m_needsSeparator = true;
+}
+
+void JsonWriter::WriteSeparator()
+{
+    if (m_needsSeparator)
+    {
+        m_output.push_back(',');
+    }
+}
+
+JsonMembers::JsonMembers(const Json::Value& additionalProperties) : m_additionalProperties(additionalProperties)
+{
+    // enough for all but the most decorated elements
+    m_members.reserve(16);
+}
+
+Json::Value& JsonMembers::operator[](const std::string& name)
+{
+    Member& member = GetOrAddMember(name);
+    member.object = nullptr;
+    member.write = nullptr;
+    member.toJsonValue = nullptr;
+    return member.value;
+}
+
+Json::Value JsonMembers::ToJsonValue()
+{
+    Json::Value root = m_additionalProperties;
+    for (auto& member : m_members)
+    {
+        root[*member.name] = member.toJsonValue ? member.toJsonValue(member.object) : std::move(member.value);
+    }
+    return root;
+}
+
+void JsonMembers::Write(JsonWriter& writer)
+{
+    if (m_members.empty())
+    {
+        writer.WriteValue(m_additionalProperties);
+        return;
+    }
+
+    // jsoncpp won't add members to anything but an object (or null, which it makes into one), and the way to fail
+    // exactly as it does is to let it try
+    if (!m_additionalProperties.isObject() && !m_additionalProperties.isNull())
+    {
+        writer.WriteValue(ToJsonValue());
+        return;
+    }
+
+    // Json::Value keeps its members in this order too -- byte by byte, then shorter names first -- so the two lists
+    // can be merged as they go
+    std::sort(m_members.begin(), m_members.end(), [](const Member& a, const Member& b) { return *a.name < *b.name; });
+
+    writer.BeginObject();
+    auto additionalProperty = m_additionalProperties.begin();
+    const auto additionalPropertiesEnd = m_additionalProperties.end();
+    const auto writeAdditionalPropertiesBefore = [&](const std::string* name) {
+        for (; additionalProperty != additionalPropertiesEnd; ++additionalProperty)
+        {
+            const char* additionalNameEnd;
+            const char* additionalNameBegin = additionalProperty.memberName(&additionalNameEnd);
+            const std::string_view additionalName(additionalNameBegin, additionalNameEnd - additionalNameBegin);
+
+            const int comparison = name ? additionalName.compare(*name) : -1;
+            if (comparison == 0)
+            {
+                // overridden by the member
+                ++additionalProperty;
+            }
+            if (comparison >= 0)
+            {
+                return;
+            }
+
+            writer.WriteMemberName(additionalName);
+            writer.WriteValue(*additionalProperty);
+        }
+    };
+
+    for (const auto& member : m_members)
+    {
+        writeAdditionalPropertiesBefore(member.name);
+        writer.WriteMemberName(*member.name);
+        if (member.write)
+        {
+            member.write(member.object, writer);
+        }
+        else
+        {
+            writer.WriteValue(member.value);
+        }
+    }
+    writeAdditionalPropertiesBefore(nullptr);
+    writer.EndObject();
+}
+
+JsonMembers::Member& JsonMembers::GetOrAddMember(const std::string& name)
+{
+    const auto existing =
+        std::find_if(m_members.begin(), m_members.end(), [&name](const Member& member) { return *member.name == name; });
+    if (existing != m_members.end())
+    {
+        return *existing;
+    }
+    m_members.push_back({&name, Json::Value(), nullptr, nullptr, nullptr});
+    return m_members.back();
+}
+
+void JsonMembers::SetSerializedMember(const std::string& name,
+                                      const void* object,
+                                      void (*write)(const void*, JsonWriter&),
+                                      Json::Value (*toJsonValue)(const void*))
+{
+    Member& member = GetOrAddMember(name);
+    member.value = Json::Value();
+    member.object = object;
+    member.write = write;
+    member.toJsonValue = toJsonValue;
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "json/json.h"
+
+namespace AdaptiveCards
+{
+// Writes compact json to the end of a string, byte for byte as ParseUtil::JsonToString writes the same values (less
+// its trailing newline). Values can be written whole, or objects and arrays a piece at a time; the separators between
+// members and items are taken care of. Member names are written in the order they're given, so to match
+// JsonToString, an object's members have to be written sorted by name -- which JsonMembers does.
+class JsonWriter
+{
+public:
+    explicit JsonWriter(std::string& output);
+
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    void WriteValue(const Json::Value& value);
+
+    void BeginObject();
+    void WriteMemberName(std::string_view name);
+    void EndObject();
+
+    void BeginArray();
+    void EndArray();
+
+private:
+    void WriteSeparator();
+
+    std::string& m_output;
+    bool m_needsSeparator;
+};
+
+// The members of an object being serialized, on top of the additional properties it was parsed with -- which it
+// refers to rather than copies, and which give way to members of the same name, as they would if each member were
+// assigned into a copy of them. Members are either plain json values, added through operator[] just as they'd be
+// added to a Json::Value, or objects and arrays of objects (elements and cards) that serialize themselves, which can
+// be written out as they are, without building any json for them at all.
+//
+// Member names aren't copied either, so they have to outlive the JsonMembers -- as the strings that
+// AdaptiveCardSchemaKeyToString hands out do.
+class JsonMembers
+{
+public:
+    explicit JsonMembers(const Json::Value& additionalProperties);
+
+    JsonMembers(const JsonMembers&) = delete;
+    JsonMembers& operator=(const JsonMembers&) = delete;
+
+    // The value of the member called name, which is added, as null, if there isn't one already
+    Json::Value& operator[](const std::string& name);
+
+    // object is anything with SerializeToJsonValue() and Serialize(JsonWriter&), and has to outlive the JsonMembers
+    template <typename T>
+    void SetObject(const std::string& name, const T& object)
+    {
+        SetSerializedMember(
+            name,
+            &object,
+            [](const void* object, JsonWriter& writer) { static_cast<const T*>(object)->Serialize(writer); },
+            [](const void* object) { return static_cast<const T*>(object)->SerializeToJsonValue(); });
+    }
+
+    template <typename T>
+    void SetArray(const std::string& name, const std::vector<std::shared_ptr<T>>& objects)
+    {
+        SetSerializedMember(
+            name,
+            &objects,
+            [](const void* objects, JsonWriter& writer) {
+                writer.BeginArray();
+                for (const auto& object : *static_cast<const std::vector<std::shared_ptr<T>>*>(objects))
+                {
+                    object->Serialize(writer);
+                }
+                writer.EndArray();
+            },
+            [](const void* objects) {
+                Json::Value array(Json::arrayValue);
+                for (const auto& object : *static_cast<const std::vector<std::shared_ptr<T>>*>(objects))
+                {
+                    array.append(object->SerializeToJsonValue());
+                }
+                return array;
+            });
+    }
+
+    // The additional properties with the members set over them. Leaves the members' values moved from.
+    Json::Value ToJsonValue();
+
+    // Writes out what ToJsonValue would return. Leaves the members sorted by name.
+    void Write(JsonWriter& writer);
+
+private:
+    struct Member
+    {
+        const std::string* name;
+        Json::Value value;
+        // set for members that serialize themselves, in which case value is unused
+        const void* object;
+        void (*write)(const void* object, JsonWriter& writer);
+        Json::Value (*toJsonValue)(const void* object);
+    };
+
+    Member& GetOrAddMember(const std::string& name);
+    void SetSerializedMember(const std::string& name,
+                             const void* object,
+                             void (*write)(const void*, JsonWriter&),
+                             Json::Value (*toJsonValue)(const void*));
+
+    const Json::Value& m_additionalProperties;
+    std::vector<Member> m_members;
+};
+} // namespace AdaptiveCards
@@ -2,21 +2,52 @@
 // Licensed under the MIT License.
 #pragma once
 #include "MarkDownHtmlGenerator.h"
-#include <iomanip>
 #include "BaseCardElement.h"
 #include "MarkDownParsedResult.h"
 
 namespace AdaptiveCards
 {
+// Reads markdown text one char at a time. The parsers were written against std::stringstream, and this keeps its
+// behaviour -- including when eof and fail are set and cleared -- without copying the text into a stream.
+class MarkDownStream
+{
+public:
+    explicit MarkDownStream(std::string_view text) : m_text(text), m_position(0), m_eof(false), m_fail(false){};
+
+    int Peek();
+    int Get();
+    bool Get(char& ch);
+    void Unget();
+    // Returns -1 if the stream has failed or reached its end
+    int Tell();
+    void Seek(int position);
+    void ClearState()
+    {
+        m_eof = m_fail = false;
+    }
+    bool Eof() const
+    {
+        return m_eof;
+    }
+
+private:
+    bool IsGood();
+
+    std::string_view m_text;
+    size_t m_position;
+    bool m_eof;
+    bool m_fail;
+};
+
 class MarkDownBlockParser
 {
 public:
-    MarkDownBlockParser(){};
+    MarkDownBlockParser(MarkDownTokenStore& store) : m_parsedResult(store){};
     // Matches each MarkDown's Syntax Form
     // For each match, stream moves to the next char
-    virtual void Match(std::stringstream&) = 0;
+    virtual void Match(MarkDownStream&) = 0;
     // Parses Block
-    void ParseBlock(std::stringstream&);
+    void ParseBlock(MarkDownStream&);
     // Returns Parse result
     MarkDownParsedResult& GetParsedResult()
     {
@@ -51,7 +82,7 @@ protected:
         return (ch > 0) && isdigit(ch);
     }
 
-    void ParseTextAndEmphasis(std::stringstream& stream);
+    void ParseTextAndEmphasis(MarkDownStream& stream);
 
     // Holds parsed results
     MarkDownParsedResult m_parsedResult;
@@ -60,7 +91,7 @@ protected:
 class EmphasisParser : public MarkDownBlockParser
 {
 public:
-    EmphasisParser() = default;
+    EmphasisParser(MarkDownTokenStore& store) : MarkDownBlockParser(store), m_currentTokenStart(store.GetTextLength()){};
     EmphasisParser(const EmphasisParser&) = delete;
     EmphasisParser(EmphasisParser&&) = delete;
     EmphasisParser& operator=(const EmphasisParser&) = delete;
@@ -74,15 +105,14 @@ public:
         Captured  // Emphasis parsing is complete
     };
 
-    void Match(std::stringstream&) override;
+    void Match(MarkDownStream&) override;
 
-    // Captures remaining charaters in given token and causes the emphasis parsing to terminate
-    void Flush(const int ch, std::string& currentToken);
+    // Captures remaining charaters in current token and causes the emphasis parsing to terminate
+    void Flush(const int ch);
 
     // check if given character is * or _
     bool IsMarkDownDelimiter(const int ch) const;
 
-    void CaptureCurrentCollectedStringAsRegularToken(std::string& currentToken);
     void CaptureCurrentCollectedStringAsRegularToken();
     void UpdateCurrentEmphasisRunState(DelimiterType emphasisType);
     // Check if current delimiter will be considererd as a delimiter run
@@ -97,23 +127,21 @@ public:
     bool IsLeftEmphasisDelimiter(const int ch) const;
     bool IsRightEmphasisDelimiter(const int ch) const;
     // Attempt to capture current emphasis as left emphasis
-    bool TryCapturingLeftEmphasisToken(const int ch, std::string& currentToken);
+    bool TryCapturingLeftEmphasisToken(const int ch);
     // Attempt to capture current emphasis as right emphasis
-    bool TryCapturingRightEmphasisToken(const int ch, std::string& currentToken);
-    void CaptureEmphasisToken(const int ch, std::string& currentToken);
+    bool TryCapturingRightEmphasisToken(const int ch);
+    void CaptureEmphasisToken(const int ch);
     void UpdateLookBehind(const int ch);
     static constexpr DelimiterType GetDelimiterTypeForChar(const int ch)
     {
         return (ch == '*') ? DelimiterType::Asterisk : DelimiterType::Underscore;
     };
 
-    typedef EmphasisState (*MatchWithChar)(EmphasisParser&, std::stringstream&, std::string&);
-
     // Callback function that handles the Text State
-    static EmphasisState MatchText(EmphasisParser&, std::stringstream&, std::string&);
+    static EmphasisState MatchText(EmphasisParser&, MarkDownStream&);
 
     // Callback function that handles the Emphasis State
-    static EmphasisState MatchEmphasis(EmphasisParser&, std::stringstream&, std::string&);
+    static EmphasisState MatchEmphasis(EmphasisParser&, MarkDownStream&);
 
     static bool IsEmphasisToken(int token);
 
@@ -125,43 +153,50 @@ protected:
     DelimiterType m_currentDelimiterType = DelimiterType::Init;
     EmphasisState m_current_state = EmphasisState::Text;
 
-    // vector of callback functions that handles state transistions
-    const std::unordered_map<EmphasisState, MatchWithChar> m_stateMachine = {
-        {EmphasisState::Text, MatchText}, {EmphasisState::Emphasis, MatchEmphasis}};
+    // the token being collected is everything appended to the store's text from here on
+    size_t m_currentTokenStart;
 
-    // holds currently collected token
-    std::string m_current_token;
+private:
+    bool IsCurrentTokenEmpty() const
+    {
+        return m_parsedResult.GetStore().GetTextLength() == m_currentTokenStart;
+    }
+    void AppendToCurrentToken(char ch)
+    {
+        m_parsedResult.GetStore().AppendText(ch);
+    }
+    size_t CaptureCurrentToken(MarkDownToken::Kind kind);
 };
 
 class LinkParser : public MarkDownBlockParser
 {
 public:
-    LinkParser() = default;
-    LinkParser(const LinkParser&) = default;
-    LinkParser(LinkParser&&) = default;
-    LinkParser& operator=(const LinkParser&) = default;
-    LinkParser& operator=(LinkParser&&) = default;
+    LinkParser(MarkDownTokenStore& store) : MarkDownBlockParser(store), m_linkTextParsedResult(store){};
+    LinkParser(const LinkParser&) = delete;
+    LinkParser(LinkParser&&) = delete;
+    LinkParser& operator=(const LinkParser&) = delete;
+    LinkParser& operator=(LinkParser&&) = delete;
     virtual ~LinkParser() = default;
 
-    void Match(std::stringstream&) override;
+    void Match(MarkDownStream&) override;
 
 private:
     void CaptureLinkToken();
 
     // Matches Initial syntax of link
-    bool MatchAtLinkInit(std::stringstream&);
+    bool MatchAtLinkInit(MarkDownStream&);
     // Matches LinkText Run syntax of link
-    bool MatchAtLinkTextRun(std::stringstream&);
+    bool MatchAtLinkTextRun(MarkDownStream&);
     // Matches LinkText End syntax of link
-    bool MatchAtLinkTextEnd(std::stringstream&);
+    bool MatchAtLinkTextEnd(MarkDownStream&);
     // Matches LinkDestination Start syntax of link
-    bool MatchAtLinkDestinationStart(std::stringstream&);
+    bool MatchAtLinkDestinationStart(MarkDownStream&);
     // Matches LinkDestination Run syntax of link
-    bool MatchAtLinkDestinationRun(std::stringstream&);
+    bool MatchAtLinkDestinationRun(MarkDownStream&);
 
     int m_linkDestinationStart = 0;
     int m_linkDestinationEnd = 0;
-    std::stringstream::pos_type m_parsingCurrentPos = 0;
+    int m_parsingCurrentPos = 0;
 
     // holds intermediate result of LinkText
     MarkDownParsedResult m_linkTextParsedResult;
@@ -170,17 +205,17 @@ private:
 class ListParser : public MarkDownBlockParser
 {
 public:
-    ListParser() = default;
-    ListParser(const ListParser&) = default;
-    ListParser(ListParser&&) = default;
-    ListParser& operator=(const ListParser&) = default;
-    ListParser& operator=(ListParser&&) = default;
+    ListParser(MarkDownTokenStore& store) : MarkDownBlockParser(store){};
+    ListParser(const ListParser&) = delete;
+    ListParser(ListParser&&) = delete;
+    ListParser& operator=(const ListParser&) = delete;
+    ListParser& operator=(ListParser&&) = delete;
     virtual ~ListParser() = default;
 
-    void Match(std::stringstream&) override;
-    bool MatchNewListItem(std::stringstream&);
-    bool MatchNewBlock(std::stringstream&);
-    bool MatchNewOrderedListItem(std::stringstream&, std::string&);
+    void Match(MarkDownStream&) override;
+    bool MatchNewListItem(MarkDownStream&);
+    bool MatchNewBlock(MarkDownStream&);
+    bool MatchNewOrderedListItem(MarkDownStream&, std::string&);
     static constexpr bool IsHyphen(const int ch)
     {
         return ch == '-';
@@ -203,8 +238,8 @@ public:
     };
 
 protected:
-    void ParseSubBlocks(std::stringstream&);
-    bool CompleteListParsing(std::stringstream& stream);
+    void ParseSubBlocks(MarkDownStream&);
+    bool CompleteListParsing(MarkDownStream& stream);
 
 private:
     void CaptureListToken();
@@ -213,14 +248,14 @@ private:
 class OrderedListParser : public ListParser
 {
 public:
-    OrderedListParser() = default;
-    OrderedListParser(const OrderedListParser&) = default;
-    OrderedListParser(OrderedListParser&&) = default;
-    OrderedListParser& operator=(const OrderedListParser&) = default;
-    OrderedListParser& operator=(OrderedListParser&&) = default;
+    OrderedListParser(MarkDownTokenStore& store) : ListParser(store){};
+    OrderedListParser(const OrderedListParser&) = delete;
+    OrderedListParser(OrderedListParser&&) = delete;
+    OrderedListParser& operator=(const OrderedListParser&) = delete;
+    OrderedListParser& operator=(OrderedListParser&&) = delete;
     ~OrderedListParser() = default;
 
-    void Match(std::stringstream&) override;
+    void Match(MarkDownStream&) override;
 
 private:
     void CaptureOrderedListToken(std::string&);
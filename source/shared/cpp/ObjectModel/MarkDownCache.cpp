@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "MarkDownCache.h"
+
+namespace AdaptiveCards
+{
+MarkDownCache& MarkDownCache::Instance()
+{
+    static MarkDownCache instance;
+    return instance;
+}
+
+void MarkDownCache::Configure(std::size_t byteBudget)
+{
+    auto& cache = Instance();
+    std::lock_guard<std::mutex> lock(cache.m_lock);
+    cache.m_byteBudget = byteBudget;
+    cache.EvictToBudget();
+}
+
+bool MarkDownCache::TryGet(const std::string& text, Result& result)
+{
+    auto& cache = Instance();
+
+    // the cache is off unless a host asked for it, so don't make every parser take the lock
+    if (cache.m_byteBudget == 0)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(cache.m_lock);
+        const auto entry = cache.m_index.find(text);
+        if (entry != cache.m_index.end())
+        {
+            cache.m_entries.splice(cache.m_entries.begin(), cache.m_entries, entry->second);
+            result = entry->second->result;
+            ++cache.m_hitCount;
+            return true;
+        }
+    }
+    ++cache.m_missCount;
+    return false;
+}
+
+void MarkDownCache::Add(const std::string& text, const std::string& html, bool hasHtmlTags, bool isEscaped)
+{
+    auto& cache = Instance();
+    if (cache.m_byteBudget == 0)
+    {
+        return;
+    }
+
+    // build the entry before taking the lock; copying the strings is the expensive part
+    EntryList entries;
+    entries.push_back(Entry{text, {html, hasHtmlTags, isEscaped}});
+    const auto entryBytes = GetEntryBytes(entries.front());
+
+    std::lock_guard<std::mutex> lock(cache.m_lock);
+    if (entryBytes > cache.m_byteBudget)
+    {
+        return;
+    }
+
+    // another thread may have transformed the same text in the meantime
+    if (cache.m_index.find(text) != cache.m_index.end())
+    {
+        return;
+    }
+
+    cache.m_entries.splice(cache.m_entries.begin(), entries);
+    cache.m_index.emplace(cache.m_entries.front().text, cache.m_entries.begin());
+    cache.m_byteSize += entryBytes;
+    cache.EvictToBudget();
+}
+
+void MarkDownCache::Clear()
+{
+    auto& cache = Instance();
+    std::lock_guard<std::mutex> lock(cache.m_lock);
+    cache.m_index.clear();
+    cache.m_entries.clear();
+    cache.m_byteSize = 0;
+}
+
+std::size_t MarkDownCache::GetByteBudget()
+{
+    return Instance().m_byteBudget;
+}
+
+std::size_t MarkDownCache::GetByteSize()
+{
+    auto& cache = Instance();
+    std::lock_guard<std::mutex> lock(cache.m_lock);
+    return cache.m_byteSize;
+}
+
+std::size_t MarkDownCache::GetSize()
+{
+    auto& cache = Instance();
+    std::lock_guard<std::mutex> lock(cache.m_lock);
+    return cache.m_entries.size();
+}
+
+std::uint64_t MarkDownCache::GetHitCount()
+{
+    return Instance().m_hitCount;
+}
+
+std::uint64_t MarkDownCache::GetMissCount()
+{
+    return Instance().m_missCount;
+}
+
+void MarkDownCache::ResetCounts()
+{
+    auto& cache = Instance();
+    cache.m_hitCount = 0;
+    cache.m_missCount = 0;
+}
+
+// An estimate of what an entry costs: its strings plus the bookkeeping around them
+std::size_t MarkDownCache::GetEntryBytes(const Entry& entry)
+{
+    return entry.text.size() + entry.result.html.size() + sizeof(Entry) + 4 * sizeof(void*);
+}
+
+void MarkDownCache::EvictToBudget()
+{
+    while (m_byteSize > m_byteBudget)
+    {
+        const auto& leastRecentlyUsed = m_entries.back();
+        m_byteSize -= GetEntryBytes(leastRecentlyUsed);
+        m_index.erase(leastRecentlyUsed.text);
+        m_entries.pop_back();
+    }
+}
+} // namespace AdaptiveCards
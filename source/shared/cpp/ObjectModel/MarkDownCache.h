@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// A process-wide cache of MarkDownParser::TransformToHtml results for hosts that render the same text over and over
+// (e.g. re-rendering messages while scrolling). It is off until a host calls Configure with a non-zero budget; after
+// that every MarkDownParser consults it before parsing.
+//
+// Results are keyed by the raw markdown text; the transform doesn't depend on anything else. The least recently used
+// results are evicted once the text and html held by the cache exceed the byte budget. MarkDownCache may be used from
+// any number of threads at once.
+class MarkDownCache
+{
+public:
+    struct Result
+    {
+        std::string html;
+        bool hasHtmlTags;
+        bool isEscaped;
+    };
+
+    // Sets the number of bytes the cache may hold, and evicts results until it fits. A budget of 0 (the default)
+    // empties the cache and turns it off.
+    static void Configure(std::size_t byteBudget);
+
+    // Returns true and fills result if text has been transformed before
+    static bool TryGet(const std::string& text, Result& result);
+
+    // Remembers the result of transforming text; results larger than the whole budget aren't kept
+    static void Add(const std::string& text, const std::string& html, bool hasHtmlTags, bool isEscaped);
+
+    // Drops every cached result; the counters are left alone
+    static void Clear();
+
+    static std::size_t GetByteBudget();
+    static std::size_t GetByteSize();
+    static std::size_t GetSize();
+
+    // Number of TryGet calls that were (or weren't) answered from the cache while it was on
+    static std::uint64_t GetHitCount();
+    static std::uint64_t GetMissCount();
+    static void ResetCounts();
+
+private:
+    struct Entry
+    {
+        std::string text;
+        Result result;
+    };
+    using EntryList = std::list<Entry>;
+
+    MarkDownCache() = default;
+    static MarkDownCache& Instance();
+    static std::size_t GetEntryBytes(const Entry& entry);
+
+    // Must be called with m_lock held
+    void EvictToBudget();
+
+    std::mutex m_lock;
+    EntryList m_entries; // most recently used first
+    // keys view the text of the entry they point at, which list nodes keep in place
+    std::unordered_map<std::string_view, EntryList::iterator> m_index;
+    std::size_t m_byteSize = 0;
+    std::atomic<std::size_t> m_byteBudget{0};
+    std::atomic<std::uint64_t> m_hitCount{0};
+    std::atomic<std::uint64_t> m_missCount{0};
+};
+} // namespace AdaptiveCards
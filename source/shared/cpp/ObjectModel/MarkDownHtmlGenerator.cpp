@@ -5,66 +5,74 @@
 
 using namespace AdaptiveCards;
 
-std::string MarkDownStringHtmlGenerator::GenerateHtmlString()
+namespace
 {
-    if (m_isHead)
-    {
-        m_token = "<p>" + m_token;
-    }
-
-    if (m_isTail)
-    {
-        return m_token + "</p>";
-    }
-
-    return m_token;
-}
+    // tags pushed by emphasis tokens
+    constexpr char ItalicOpen = 'i';
+    constexpr char ItalicClose = 'I';
+    constexpr char BoldOpen = 'b';
+    constexpr char BoldClose = 'B';
+
+    void AppendTag(char tag, std::string& html)
+    {
+        switch (tag)
+        {
+        case ItalicOpen:
+            html += "<em>";
+            break;
+        case ItalicClose:
+            html += "</em>";
+            break;
+        case BoldOpen:
+            html += "<strong>";
+            break;
+        case BoldClose:
+            html += "</strong>";
+            break;
+        }
+    }
+} // namespace
 
 //     left and right emphasis tokens are match if
 //     1. they are same types
 //     2. neither of the emphasis tokens are both left and right emphasis tokens, and
 //        if either or both of them are, then their sum is not multiple of 3
-bool MarkDownEmphasisHtmlGenerator::IsMatch(const MarkDownEmphasisHtmlGenerator& emphasisToken)
+bool MarkDownToken::IsMatch(const MarkDownToken& emphasisToken) const
 {
-    if (this->type == emphasisToken.type)
+    if (this->delimiterType == emphasisToken.delimiterType)
     {
         // rule #9 & #10, sum of delimiter count can't be multiple of 3
         return !(
             (this->IsLeftAndRightEmphasis() || emphasisToken.IsLeftAndRightEmphasis()) &&
-            (((this->m_numberOfUnusedDelimiters + emphasisToken.m_numberOfUnusedDelimiters) % 3) == 0));
+            (((this->numberOfUnusedDelimiters + emphasisToken.numberOfUnusedDelimiters) % 3) == 0));
     }
     return false;
 }
 
-bool MarkDownEmphasisHtmlGenerator::IsSameType(const MarkDownEmphasisHtmlGenerator& token)
-{
-    return this->type == token.type;
-}
-
 // adjust number of emphasis counts after maching is done
-int MarkDownEmphasisHtmlGenerator::AdjustEmphasisCounts(int leftOver, MarkDownEmphasisHtmlGenerator& rightToken)
+int MarkDownToken::AdjustEmphasisCounts(int leftOver, MarkDownToken& rightToken)
 {
     int delimiterCount = 0;
     if (leftOver >= 0)
     {
-        delimiterCount = this->m_numberOfUnusedDelimiters - leftOver;
-        this->m_numberOfUnusedDelimiters = leftOver;
-        rightToken.m_numberOfUnusedDelimiters = 0;
+        delimiterCount = this->numberOfUnusedDelimiters - leftOver;
+        this->numberOfUnusedDelimiters = leftOver;
+        rightToken.numberOfUnusedDelimiters = 0;
     }
     else
     {
-        delimiterCount = this->m_numberOfUnusedDelimiters;
-        rightToken.m_numberOfUnusedDelimiters = leftOver * (-1);
-        this->m_numberOfUnusedDelimiters = 0;
+        delimiterCount = this->numberOfUnusedDelimiters;
+        rightToken.numberOfUnusedDelimiters = leftOver * (-1);
+        this->numberOfUnusedDelimiters = 0;
     }
     return delimiterCount;
 }
 
 // generate bold and emphasis html tags
-bool MarkDownEmphasisHtmlGenerator::GenerateTags(MarkDownEmphasisHtmlGenerator& token)
+bool MarkDownToken::GenerateTags(MarkDownToken& token)
 {
     int delimiterCount = 0, leftOver = 0;
-    leftOver = this->m_numberOfUnusedDelimiters - token.m_numberOfUnusedDelimiters;
+    leftOver = this->numberOfUnusedDelimiters - token.numberOfUnusedDelimiters;
     delimiterCount = this->AdjustEmphasisCounts(leftOver, token);
     const bool hasHtmlTags = (delimiterCount > 0);
 
@@ -84,131 +92,134 @@ bool MarkDownEmphasisHtmlGenerator::GenerateTags(MarkDownEmphasisHtmlGenerator&
     return hasHtmlTags;
 }
 
-void MarkDownEmphasisHtmlGenerator::PushItalicTag()
+void MarkDownToken::PushItalicTag()
 {
-    m_tags.push_back("<em>");
+    tags.push_back(IsLeftEmphasis() ? ItalicOpen : ItalicClose);
 }
 
-void MarkDownEmphasisHtmlGenerator::PushBoldTag()
+void MarkDownToken::PushBoldTag()
 {
-    m_tags.push_back("<strong>");
+    tags.push_back(IsLeftEmphasis() ? BoldOpen : BoldClose);
 }
 
-std::string MarkDownLeftEmphasisHtmlGenerator::GenerateHtmlString()
+void MarkDownTokenStore::Reserve(size_t textLength)
 {
-    if (m_isHead)
-    {
-        html << "<p>";
-    }
-
-    if (m_numberOfUnusedDelimiters)
-    {
-        const size_t startIdx = m_token.size() - m_numberOfUnusedDelimiters;
-        html << m_token.substr(startIdx, std::string::npos);
-    }
-
-    // append tags; since left delims, append it in the reverse order
-    for (auto itr = m_tags.rbegin(); itr != m_tags.rend(); ++itr)
-    {
-        html << *itr;
-    }
-
-    if (m_isTail)
-    {
-        return html.str() + "</p>";
-    }
-
-    return html.str();
+    m_text.reserve(textLength);
+    m_tokens.reserve(textLength / 4 + 1);
 }
 
-void MarkDownRightEmphasisHtmlGenerator::PushItalicTag()
+size_t MarkDownTokenStore::AddToken(MarkDownToken::Kind kind, size_t textOffset)
 {
-    m_tags.push_back("</em>");
-}
-
-void MarkDownRightEmphasisHtmlGenerator::PushBoldTag()
-{
-    m_tags.push_back("</strong>");
-}
-
-std::string MarkDownRightEmphasisHtmlGenerator::GenerateHtmlString()
-{
-    if (m_isHead)
-    {
-        html << "<p>";
-    }
-
-    // append tags;
-    for (auto itr = m_tags.begin(); itr != m_tags.end(); ++itr)
-    {
-        html << *itr;
-    }
-
-    // if there are unused emphasis, append them
-    if (m_numberOfUnusedDelimiters)
-    {
-        const size_t startIdx = m_token.size() - m_numberOfUnusedDelimiters;
-        html << m_token.substr(startIdx, std::string::npos);
-    }
-
-    if (m_isTail)
-    {
-        return html.str() + "</p>";
-    }
-
-    return html.str();
+    m_tokens.emplace_back(kind, textOffset, m_text.size() - textOffset);
+    return m_tokens.size() - 1;
 }
 
-void MarkDownLeftAndRightEmphasisHtmlGenerator::PushItalicTag()
+size_t MarkDownTokenStore::AddHtmlToken(MarkDownToken::Kind kind, std::string_view html)
 {
-    if (m_directionType == Left)
-    {
-        m_tags.push_back("<em>");
-    }
-    else
-    {
-        m_tags.push_back("</em>");
-    }
+    const size_t textOffset = m_text.size();
+    m_text.append(html);
+    return AddToken(kind, textOffset);
 }
 
-void MarkDownLeftAndRightEmphasisHtmlGenerator::PushBoldTag()
+void MarkDownTokenStore::AppendText(char ch)
 {
-    if (m_directionType == Left)
-    {
-        m_tags.push_back("<strong>");
-    }
-    else
-    {
-        m_tags.push_back("</strong>");
+    switch (ch)
+    {
+    case '<':
+        m_text += "&lt;";
+        break;
+    case '>':
+        m_text += "&gt;";
+        break;
+    case '"':
+        m_text += "&quot;";
+        break;
+    case '&':
+        m_text += "&amp;";
+        break;
+    default:
+        m_text += ch;
+        break;
     }
 }
 
-std::string MarkDownListHtmlGenerator::GenerateHtmlString()
+void MarkDownTokenStore::AppendText(std::string_view text)
 {
-    if (m_isHead)
-    {
-        m_token = "<ul>" + m_token;
-    }
-
-    if (m_isTail)
+    for (const char ch : text)
     {
-        return m_token + "</ul>";
+        AppendText(ch);
     }
-
-    return m_token;
 }
 
-std::string MarkDownOrderedListHtmlGenerator::GenerateHtmlString()
+void MarkDownTokenStore::GenerateHtmlString(const MarkDownToken& token, std::string& html) const
 {
-    if (m_isHead)
-    {
-        m_token = "<ol start=\"" + m_numberString + "\">" + m_token;
+    const std::string_view text(m_text.data() + token.textOffset, token.textLength);
+
+    if (token.isHead)
+    {
+        switch (token.kind)
+        {
+        case MarkDownToken::Kind::ListItem:
+            html += "<ul>";
+            break;
+        case MarkDownToken::Kind::OrderedListItem:
+            html += "<ol start=\"";
+            html.append(m_text, token.textOffset + token.textLength, token.numberLength);
+            html += "\">";
+            break;
+        default:
+            html += "<p>";
+            break;
+        }
+    }
+
+    switch (token.kind)
+    {
+    case MarkDownToken::Kind::LeftEmphasis:
+        if (token.numberOfUnusedDelimiters)
+        {
+            html.append(text.substr(text.size() - token.numberOfUnusedDelimiters));
+        }
+
+        // append tags; since left delims, append it in the reverse order
+        for (auto itr = token.tags.rbegin(); itr != token.tags.rend(); ++itr)
+        {
+            AppendTag(*itr, html);
+        }
+        break;
+
+    case MarkDownToken::Kind::RightEmphasis:
+    case MarkDownToken::Kind::LeftAndRightEmphasis:
+        for (const char tag : token.tags)
+        {
+            AppendTag(tag, html);
+        }
+
+        // if there are unused emphasis, append them
+        if (token.numberOfUnusedDelimiters)
+        {
+            html.append(text.substr(text.size() - token.numberOfUnusedDelimiters));
+        }
+        break;
+
+    default:
+        html.append(text);
+        break;
+    }
+
+    if (token.isTail)
+    {
+        switch (token.kind)
+        {
+        case MarkDownToken::Kind::ListItem:
+            html += "</ul>";
+            break;
+        case MarkDownToken::Kind::OrderedListItem:
+            html += "</ol>";
+            break;
+        default:
+            html += "</p>";
+            break;
+        }
     }
-
-    if (m_isTail)
-    {
-        return m_token + "</ol>";
-    }
-
-    return m_token;
 }
@@ -2,9 +2,8 @@
 // Licensed under the MIT License.
 #pragma once
 #include <string>
-#include <iomanip>
+#include <string_view>
 #include <vector>
-#include <list>
 #include "BaseCardElement.h"
 
 namespace AdaptiveCards
@@ -20,25 +19,37 @@ enum class DelimiterType
     Asterisk
 };
 
-// this class knows how to generate html string of their types
-// - MarkDownStringHtmlGenerator
+// A MarkDownToken is one piece of parsed markdown, and it knows how to generate html string of its kind
+// - String
 //   it is the most basic form,
 //   it simply retains and return text as string
-// - MarkDownEmphasisHtmlGenerator
-//   it knows how to handle bold and italic html
-//   tags and apply those to its text when asked to generate html string
-// - MarkDownListHtmlGenerator
-//   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   MarkDownBlockType, this is used in generating html block tags
-//   list uses block tag of <ul> all others use <p>
-class MarkDownHtmlGenerator
+// - NewLine
+//   it contains new line chars
+// - LeftEmphasis
+//   it knows how to generates opening italic and bold html tags
+// - RightEmphasis
+//   it knows how to generates closing italic and bold html tags
+// - LeftAndRightEmphasis
+//   it can have both directions, and its final direction is determined at the later stage
+// - ListItem and OrderedListItem
+//   they function similarly as String, but GetBlockType() returns UnorderedList or OrderedList,
+//   this is used in generating html block tags
+//   list uses block tag of <ul> or <ol>, all others use <p>
+//
+// Tokens are plain values that live in a MarkDownTokenStore and refer to each other by index, so that parsing a
+// string doesn't allocate an object (and a stream) per token.
+struct MarkDownToken
 {
-public:
-    MarkDownHtmlGenerator(const MarkDownHtmlGenerator&) = delete;
-    MarkDownHtmlGenerator(MarkDownHtmlGenerator&&) = delete;
-    MarkDownHtmlGenerator& operator=(const MarkDownHtmlGenerator&) = delete;
-    MarkDownHtmlGenerator& operator=(MarkDownHtmlGenerator&&) = delete;
-    virtual ~MarkDownHtmlGenerator() = default;
+    enum class Kind
+    {
+        String,
+        NewLine,
+        LeftEmphasis,
+        RightEmphasis,
+        LeftAndRightEmphasis,
+        ListItem,
+        OrderedListItem
+    };
 
     enum MarkDownBlockType
     {
@@ -47,257 +58,134 @@ public:
         OrderedList
     };
 
-    MarkDownHtmlGenerator() : m_token(""){};
-    MarkDownHtmlGenerator(std::string& token) : m_token(token){};
-    void MakeItHead()
+    static constexpr size_t None = static_cast<size_t>(-1);
+
+    MarkDownToken(Kind kind, size_t textOffset, size_t textLength) :
+        kind(kind), textOffset(textOffset), textLength(textLength)
     {
-        m_isHead = true;
     }
-    void MakeItTail()
+
+    MarkDownBlockType GetBlockType() const
     {
-        m_isTail = true;
+        return (kind == Kind::ListItem) ? UnorderedList : (kind == Kind::OrderedListItem) ? OrderedList : ContainerBlock;
     }
-    virtual bool IsNewLine()
+
+    bool IsNewLine() const
     {
-        return false;
+        return kind == Kind::NewLine;
     }
-    virtual std::string GenerateHtmlString() = 0;
-    virtual MarkDownBlockType GetBlockType() const
-    {
-        return ContainerBlock;
-    };
-
-protected:
-    std::string m_token;
-    std::ostringstream html;
-    bool m_isHead = false;
-    bool m_isTail = false;
-};
-
-// - MarkDownStringHtmlGenerator
-//   it is the most basic form,
-//   it simply retains and return text as string
-class MarkDownStringHtmlGenerator : public MarkDownHtmlGenerator
-{
-public:
-    MarkDownStringHtmlGenerator() = delete;
-    MarkDownStringHtmlGenerator(const MarkDownStringHtmlGenerator&) = delete;
-    MarkDownStringHtmlGenerator(MarkDownStringHtmlGenerator&&) = delete;
-    MarkDownStringHtmlGenerator& operator=(const MarkDownStringHtmlGenerator&) = delete;
-    MarkDownStringHtmlGenerator& operator=(MarkDownStringHtmlGenerator&&) = delete;
-    ~MarkDownStringHtmlGenerator() = default;
 
-    MarkDownStringHtmlGenerator(std::string& token) : MarkDownHtmlGenerator(token){};
-    std::string GenerateHtmlString() override;
-};
-
-// - MarkDownNewLineHtmlGenerator
-//   it contains new line chars
-class MarkDownNewLineHtmlGenerator : public MarkDownStringHtmlGenerator
-{
-public:
-    MarkDownNewLineHtmlGenerator() = delete;
-    MarkDownNewLineHtmlGenerator(const MarkDownNewLineHtmlGenerator&) = delete;
-    MarkDownNewLineHtmlGenerator(MarkDownNewLineHtmlGenerator&&) = delete;
-    MarkDownNewLineHtmlGenerator& operator=(const MarkDownNewLineHtmlGenerator&) = delete;
-    MarkDownNewLineHtmlGenerator& operator=(MarkDownNewLineHtmlGenerator&&) = delete;
-    ~MarkDownNewLineHtmlGenerator() = default;
-
-    MarkDownNewLineHtmlGenerator(std::string& token) : MarkDownStringHtmlGenerator(token){};
-    bool IsNewLine() override
+    bool IsRightEmphasis() const
     {
-        return true;
+        return kind == Kind::RightEmphasis || (kind == Kind::LeftAndRightEmphasis && direction == Right);
     }
-};
 
-// - MarkDownEmphasisHtmlGenerator
-//   it knows how to handle bold and italic html
-//   tags and apply those to its text when asked to generate html string
-class MarkDownEmphasisHtmlGenerator : public MarkDownHtmlGenerator
-{
-public:
-    MarkDownEmphasisHtmlGenerator() = delete;
-    MarkDownEmphasisHtmlGenerator(const MarkDownEmphasisHtmlGenerator&) = delete;
-    MarkDownEmphasisHtmlGenerator(MarkDownEmphasisHtmlGenerator&&) = delete;
-    MarkDownEmphasisHtmlGenerator& operator=(const MarkDownEmphasisHtmlGenerator&) = delete;
-    MarkDownEmphasisHtmlGenerator& operator=(MarkDownEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownEmphasisHtmlGenerator() = default;
-
-    MarkDownEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownHtmlGenerator(token), m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type){};
-
-    MarkDownEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type, std::vector<std::string>& tags) :
-        MarkDownHtmlGenerator(token), m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type), m_tags(tags){};
-
-    virtual bool IsRightEmphasis() const
+    bool IsLeftEmphasis() const
     {
-        return false;
+        return kind == Kind::LeftEmphasis || (kind == Kind::LeftAndRightEmphasis && direction == Left);
     }
-    virtual bool IsLeftEmphasis() const
+
+    bool IsLeftAndRightEmphasis() const
     {
-        return false;
+        return kind == Kind::LeftAndRightEmphasis;
     }
-    virtual bool IsLeftAndRightEmphasis() const
+
+    bool IsMatch(const MarkDownToken& token) const;
+    bool IsSameType(const MarkDownToken& token) const
     {
-        return false;
+        return delimiterType == token.delimiterType;
     }
-    virtual void PushItalicTag();
-    virtual void PushBoldTag();
-
-    bool IsMatch(const MarkDownEmphasisHtmlGenerator& token);
-    bool IsSameType(const MarkDownEmphasisHtmlGenerator& token);
     bool IsDone() const
     {
-        return m_numberOfUnusedDelimiters == 0;
+        return numberOfUnusedDelimiters == 0;
     }
-    int GetNumberOfUnusedDelimiters() const
-    {
-        return m_numberOfUnusedDelimiters;
-    };
-    bool GenerateTags(MarkDownEmphasisHtmlGenerator& token);
+    bool GenerateTags(MarkDownToken& token);
     void ReverseDirectionType()
     {
-        m_directionType = !m_directionType;
-    };
+        direction = !direction;
+    }
+
+    Kind kind;
+    bool isHead = false;
+    bool isTail = false;
 
-protected:
+    // where the token's html lives in MarkDownTokenStore's text; ordered list items keep their start number
+    // right after it
+    size_t textOffset;
+    size_t textLength;
+    size_t numberLength = 0;
+
+    // emphasis state
     enum
     {
         Left = 0,
         Right = 1,
     };
+    DelimiterType delimiterType = DelimiterType::Init;
+    int numberOfUnusedDelimiters = 0;
+    int direction = Right;
+    // one char per tag, see PushItalicTag
+    std::string tags;
+
+    // links to the neighbouring tokens of the MarkDownParsedResult this token belongs to, and to the next token of
+    // its emphasis look up table
+    size_t previous = None;
+    size_t next = None;
+    size_t nextEmphasis = None;
 
-    int AdjustEmphasisCounts(int leftOver, MarkDownEmphasisHtmlGenerator& rightToken);
-    int m_numberOfUnusedDelimiters;
-    int m_directionType = Right;
-    DelimiterType type;
-    std::vector<std::string> m_tags;
+private:
+    void PushItalicTag();
+    void PushBoldTag();
+    int AdjustEmphasisCounts(int leftOver, MarkDownToken& rightToken);
 };
 
-// - MarkDownLeftEmphasisHtmlGenerator
-//   it knows how to generates opening italic and bold html tags
-class MarkDownLeftEmphasisHtmlGenerator : public MarkDownEmphasisHtmlGenerator
+// Owns every token and all the token text of one markdown string. Text is html escaped as it's added, so tokens can
+// be written out as they are.
+class MarkDownTokenStore
 {
 public:
-    MarkDownLeftEmphasisHtmlGenerator() = delete;
-    MarkDownLeftEmphasisHtmlGenerator(const MarkDownLeftEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftEmphasisHtmlGenerator(MarkDownLeftEmphasisHtmlGenerator&&) = delete;
-    MarkDownLeftEmphasisHtmlGenerator& operator=(const MarkDownLeftEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftEmphasisHtmlGenerator& operator=(MarkDownLeftEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownLeftEmphasisHtmlGenerator() = default;
-
-    MarkDownLeftEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
+    MarkDownTokenStore() = default;
+    MarkDownTokenStore(const MarkDownTokenStore&) = delete;
+    MarkDownTokenStore(MarkDownTokenStore&&) = delete;
+    MarkDownTokenStore& operator=(const MarkDownTokenStore&) = delete;
+    MarkDownTokenStore& operator=(MarkDownTokenStore&&) = delete;
+    ~MarkDownTokenStore() = default;
 
-    MarkDownLeftEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type, std::vector<std::string>& tags) :
-        MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type, tags){};
+    void Reserve(size_t textLength);
 
-    bool IsLeftEmphasis() const override
+    MarkDownToken& operator[](size_t token)
     {
-        return true;
+        return m_tokens[token];
     }
-    std::string GenerateHtmlString() override;
-};
 
-// - MarkDownRightEmphasisHtmlGenerator
-//   it knows how to generates closing italic and bold html tags
-class MarkDownRightEmphasisHtmlGenerator : public MarkDownEmphasisHtmlGenerator
-{
-public:
-    MarkDownRightEmphasisHtmlGenerator() = delete;
-    MarkDownRightEmphasisHtmlGenerator(const MarkDownRightEmphasisHtmlGenerator&) = delete;
-    MarkDownRightEmphasisHtmlGenerator(MarkDownRightEmphasisHtmlGenerator&&) = delete;
-    MarkDownRightEmphasisHtmlGenerator& operator=(const MarkDownRightEmphasisHtmlGenerator&) = delete;
-    MarkDownRightEmphasisHtmlGenerator& operator=(MarkDownRightEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownRightEmphasisHtmlGenerator() = default;
-
-    MarkDownRightEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
-
-    void GenerateTags(std::shared_ptr<MarkDownEmphasisHtmlGenerator>& token);
-    bool IsRightEmphasis() const override
-    {
-        return true;
-    }
-    std::string GenerateHtmlString() override;
-    void PushItalicTag() override;
-    void PushBoldTag() override;
-};
+    // Adds a token whose text is everything appended to the text since textOffset
+    size_t AddToken(MarkDownToken::Kind kind, size_t textOffset);
 
-// - MarkDownLeftAndRightEmphasisHtmlGenerator
-//   it can have both directions, and its final direction is determined at the later stage
-class MarkDownLeftAndRightEmphasisHtmlGenerator : public MarkDownRightEmphasisHtmlGenerator
-{
-public:
-    MarkDownLeftAndRightEmphasisHtmlGenerator() = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator(const MarkDownLeftAndRightEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator(MarkDownLeftAndRightEmphasisHtmlGenerator&&) = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator& operator=(const MarkDownLeftAndRightEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator& operator=(MarkDownLeftAndRightEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownLeftAndRightEmphasisHtmlGenerator() = default;
+    // Adds a token holding the given html, which has already been escaped
+    size_t AddHtmlToken(MarkDownToken::Kind kind, std::string_view html);
 
-    MarkDownLeftAndRightEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownRightEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
-    bool IsRightEmphasis() const override
+    size_t GetTextLength() const
     {
-        return m_directionType == Right;
+        return m_text.size();
     }
-    bool IsLeftEmphasis() const override
+    void AppendText(char ch);
+    void AppendText(std::string_view text);
+    void PopBackText()
     {
-        return m_directionType == Left;
+        m_text.pop_back();
     }
-    bool IsLeftAndRightEmphasis() const override
-    {
-        return true;
-    };
-    void PushItalicTag() override;
-    void PushBoldTag() override;
-};
 
-// - MarkDownListHtmlGenerator
-//   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   UnorderedList type, this is used in generating html block tags <ul>
-class MarkDownListHtmlGenerator : public MarkDownStringHtmlGenerator
-{
-public:
-    MarkDownListHtmlGenerator() = delete;
-    MarkDownListHtmlGenerator(const MarkDownListHtmlGenerator&) = delete;
-    MarkDownListHtmlGenerator(MarkDownListHtmlGenerator&&) = delete;
-    MarkDownListHtmlGenerator& operator=(const MarkDownListHtmlGenerator&) = delete;
-    MarkDownListHtmlGenerator& operator=(MarkDownListHtmlGenerator&&) = delete;
-    ~MarkDownListHtmlGenerator() = default;
-
-    MarkDownListHtmlGenerator(std::string& token) : MarkDownStringHtmlGenerator(token){};
-    std::string GenerateHtmlString() override;
-    MarkDownBlockType GetBlockType() const override
+    // Buffer for building the html of links and list items before it becomes a token of its own
+    std::string& GetScratch()
     {
-        return UnorderedList;
-    };
-};
-
-// - MarkDownUnorderedListHtmlGenerator
-//   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   OrderedList type, this is used in generating html block tags <ol>
-class MarkDownOrderedListHtmlGenerator : public MarkDownStringHtmlGenerator
-{
-public:
-    MarkDownOrderedListHtmlGenerator() = delete;
-    MarkDownOrderedListHtmlGenerator(const MarkDownOrderedListHtmlGenerator&) = delete;
-    MarkDownOrderedListHtmlGenerator(MarkDownOrderedListHtmlGenerator&&) = delete;
-    MarkDownOrderedListHtmlGenerator& operator=(const MarkDownOrderedListHtmlGenerator&) = delete;
-    MarkDownOrderedListHtmlGenerator& operator=(MarkDownOrderedListHtmlGenerator&&) = delete;
-    ~MarkDownOrderedListHtmlGenerator() = default;
+        return m_scratch;
+    }
 
-    MarkDownOrderedListHtmlGenerator(std::string& token, std::string& number_string) :
-        MarkDownStringHtmlGenerator(token), m_numberString(number_string){};
-    std::string GenerateHtmlString() override;
-    MarkDownBlockType GetBlockType() const override
-    {
-        return OrderedList;
-    };
+    void GenerateHtmlString(const MarkDownToken& token, std::string& html) const;
 
 private:
-    std::string m_numberString;
+    std::vector<MarkDownToken> m_tokens;
+    std::string m_text;
+    std::string m_scratch;
 };
-
 } // namespace AdaptiveCards
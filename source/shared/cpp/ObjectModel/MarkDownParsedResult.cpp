@@ -13,109 +13,189 @@ void MarkDownParsedResult::Translate()
 // appends html block tags at head and tail of the list
 void MarkDownParsedResult::AddBlockTags()
 {
+    if (m_front == MarkDownToken::None)
+    {
+        return;
+    }
+
     // Parsing is done, let code gen token know who is the head of the list
-    m_codeGenTokens.front()->MakeItHead();
+    m_store[m_front].isHead = true;
 
     // Parsing is done, let code gen token know who is the tail of the list
-    m_codeGenTokens.back()->MakeItTail();
+    m_store[m_back].isTail = true;
 }
 
-void MarkDownParsedResult::MarkTags(MarkDownHtmlGenerator& x)
+void MarkDownParsedResult::MarkTags(MarkDownToken& x)
 {
-    if (m_codeGenTokens.back()->GetBlockType() != x.GetBlockType())
+    if (m_store[m_back].GetBlockType() != x.GetBlockType())
     {
-        if (m_codeGenTokens.back()->IsNewLine())
+        if (m_store[m_back].IsNewLine())
         {
-            m_codeGenTokens.pop_back();
+            PopBack();
         }
 
-        if (!m_codeGenTokens.empty())
+        if (m_front != MarkDownToken::None)
         {
-            m_codeGenTokens.back()->MakeItTail();
+            m_store[m_back].isTail = true;
         }
-        x.MakeItHead();
+        x.isHead = true;
     }
 }
 // append caller's parsed result to callee's parsed result
 void MarkDownParsedResult::AppendParseResult(MarkDownParsedResult& x)
 {
-    if (!m_codeGenTokens.empty() && !x.m_codeGenTokens.empty())
+    if (x.m_front != MarkDownToken::None)
     {
-        // check if two different block types, then add closing tag followed by the opening tag of new type
-        MarkTags(*(x.m_codeGenTokens.front()));
+        if (m_front == MarkDownToken::None)
+        {
+            m_front = x.m_front;
+        }
+        else
+        {
+            // check if two different block types, then add closing tag followed by the opening tag of new type
+            MarkTags(m_store[x.m_front]);
+
+            // MarkTags may have emptied the list
+            if (m_front == MarkDownToken::None)
+            {
+                m_front = x.m_front;
+            }
+            else
+            {
+                m_store[m_back].next = x.m_front;
+                m_store[x.m_front].previous = m_back;
+            }
+        }
+        m_back = x.m_back;
+        x.m_front = x.m_back = MarkDownToken::None;
+    }
+
+    if (x.m_emphasisFront != MarkDownToken::None)
+    {
+        if (m_emphasisFront == MarkDownToken::None)
+        {
+            m_emphasisFront = x.m_emphasisFront;
+        }
+        else
+        {
+            m_store[m_emphasisBack].nextEmphasis = x.m_emphasisFront;
+        }
+        m_emphasisBack = x.m_emphasisBack;
+        x.m_emphasisFront = x.m_emphasisBack = MarkDownToken::None;
     }
-    m_codeGenTokens.splice(m_codeGenTokens.end(), x.m_codeGenTokens);
-    m_emphasisLookUpTable.splice(m_emphasisLookUpTable.end(), x.m_emphasisLookUpTable);
+
     m_isHTMLTagsAdded = m_isHTMLTagsAdded || x.HasHtmlTags();
     SetIsCaptured(x.GetIsCaptured());
 }
 
-// append MarkDownHtmlGenerator object to callee's prased result
-void MarkDownParsedResult::AppendToTokens(const std::shared_ptr<MarkDownHtmlGenerator>& x)
+// append MarkDownToken to callee's prased result
+void MarkDownParsedResult::AppendToTokens(size_t token)
 {
-    if (!m_codeGenTokens.empty())
+    if (m_front != MarkDownToken::None)
     {
         // check if two different block types, then add closing tag followed by the opening tag of new type
-        MarkTags(*(x));
+        MarkTags(m_store[token]);
+    }
+
+    m_store[token].previous = m_back;
+    m_store[token].next = MarkDownToken::None;
+    if (m_front == MarkDownToken::None)
+    {
+        m_front = token;
+    }
+    else
+    {
+        m_store[m_back].next = token;
     }
-    m_codeGenTokens.push_back(x);
+    m_back = token;
 }
 
-void MarkDownParsedResult::AppendToLookUpTable(const std::shared_ptr<MarkDownEmphasisHtmlGenerator>& x)
+void MarkDownParsedResult::AppendToLookUpTable(size_t token)
 {
-    m_emphasisLookUpTable.push_back(x);
+    m_store[token].nextEmphasis = MarkDownToken::None;
+    if (m_emphasisFront == MarkDownToken::None)
+    {
+        m_emphasisFront = token;
+    }
+    else
+    {
+        m_store[m_emphasisBack].nextEmphasis = token;
+    }
+    m_emphasisBack = token;
 }
 
 void MarkDownParsedResult::PopFront()
 {
-    m_codeGenTokens.pop_front();
+    if (m_front == MarkDownToken::None)
+    {
+        return;
+    }
+
+    m_front = m_store[m_front].next;
+    if (m_front == MarkDownToken::None)
+    {
+        m_back = MarkDownToken::None;
+    }
+    else
+    {
+        m_store[m_front].previous = MarkDownToken::None;
+    }
 }
 
 void MarkDownParsedResult::PopBack()
 {
-    m_codeGenTokens.pop_back();
+    if (m_back == MarkDownToken::None)
+    {
+        return;
+    }
+
+    m_back = m_store[m_back].previous;
+    if (m_back == MarkDownToken::None)
+    {
+        m_front = MarkDownToken::None;
+    }
+    else
+    {
+        m_store[m_back].next = MarkDownToken::None;
+    }
 }
 
 void MarkDownParsedResult::Clear()
 {
-    m_codeGenTokens.clear();
-    m_emphasisLookUpTable.clear();
+    m_front = m_back = MarkDownToken::None;
+    m_emphasisFront = m_emphasisBack = MarkDownToken::None;
 }
 
-// create and add new MarkDownStringHtmlGenerator object that has string of ch
-void MarkDownParsedResult::AddNewTokenToParsedResult(int ch)
+// create and add new String token that has string of ch
+void MarkDownParsedResult::AddNewTokenToParsedResult(char ch)
 {
-    std::string string_token = std::string(1, static_cast<char>(ch));
-    std::shared_ptr<MarkDownStringHtmlGenerator> htmlToken = std::make_shared<MarkDownStringHtmlGenerator>(string_token);
-    AppendToTokens(htmlToken);
+    const size_t textOffset = m_store.GetTextLength();
+    m_store.AppendText(ch);
+    AppendToTokens(m_store.AddToken(MarkDownToken::Kind::String, textOffset));
 }
 
-// create and add new MarkDownStringHtmlGenerator object that has string word
-void MarkDownParsedResult::AddNewTokenToParsedResult(std::string& word)
+// create and add new String token that has string word
+void MarkDownParsedResult::AddNewTokenToParsedResult(std::string_view word)
 {
-    std::shared_ptr<MarkDownStringHtmlGenerator> htmlToken = std::make_shared<MarkDownStringHtmlGenerator>(word);
-    AppendToTokens(htmlToken);
+    const size_t textOffset = m_store.GetTextLength();
+    m_store.AppendText(word);
+    AppendToTokens(m_store.AddToken(MarkDownToken::Kind::String, textOffset));
 }
 
-// create and add new MarkDownSpaceHtmlGenerator object that has string of ch
+// create and add new NewLine token that has string of ch
 void MarkDownParsedResult::AddNewLineTokenToParsedResult(char ch)
 {
-    std::string string_token = std::string(1, ch);
-    std::shared_ptr<MarkDownHtmlGenerator> htmlToken = std::make_shared<MarkDownNewLineHtmlGenerator>(string_token);
-    AppendToTokens(htmlToken);
+    const size_t textOffset = m_store.GetTextLength();
+    m_store.AppendText(ch);
+    AppendToTokens(m_store.AddToken(MarkDownToken::Kind::NewLine, textOffset));
 }
 
-std::string MarkDownParsedResult::GenerateHtmlString()
+void MarkDownParsedResult::GenerateHtmlString(std::string& html) const
 {
-    // process tags
-    std::ostringstream html;
-
-    for (auto itr = m_codeGenTokens.begin(); itr != m_codeGenTokens.end(); ++itr)
+    for (size_t token = m_front; token != MarkDownToken::None; token = m_store[token].next)
     {
-        html << (*itr)->GenerateHtmlString();
+        m_store.GenerateHtmlString(m_store[token], html);
     }
-
-    return html.str();
 }
 
 // Following the rules speicified in CommonMark (http://spec.commonmark.org/0.27/)
@@ -132,23 +212,23 @@ std::string MarkDownParsedResult::GenerateHtmlString()
 // add comments -> what it does: generating  n supported features + 1 tokens --> capture them in token class
 void MarkDownParsedResult::MatchLeftAndRightEmphasises()
 {
-    std::vector<std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>>::iterator> leftEmphasisToExplore;
-    auto currentEmphasis = m_emphasisLookUpTable.begin();
+    std::vector<size_t> leftEmphasisToExplore;
+    size_t currentEmphasis = m_emphasisFront;
 
-    while (!(currentEmphasis == m_emphasisLookUpTable.end()))
+    while (currentEmphasis != MarkDownToken::None)
     {
         // keep exploring left until right token is found
-        if ((*currentEmphasis)->IsLeftEmphasis() ||
-            ((*currentEmphasis)->IsLeftAndRightEmphasis() && leftEmphasisToExplore.empty()))
+        if (m_store[currentEmphasis].IsLeftEmphasis() ||
+            (m_store[currentEmphasis].IsLeftAndRightEmphasis() && leftEmphasisToExplore.empty()))
         {
-            if ((*currentEmphasis)->IsLeftAndRightEmphasis() && (*currentEmphasis)->IsRightEmphasis())
+            if (m_store[currentEmphasis].IsLeftAndRightEmphasis() && m_store[currentEmphasis].IsRightEmphasis())
             {
                 // Reverse Direction Type; right empahsis to left emphasis
-                (*currentEmphasis)->ReverseDirectionType();
+                m_store[currentEmphasis].ReverseDirectionType();
             }
 
             leftEmphasisToExplore.push_back(currentEmphasis);
-            ++currentEmphasis;
+            currentEmphasis = m_store[currentEmphasis].nextEmphasis;
         }
         else if (!leftEmphasisToExplore.empty())
         {
@@ -172,9 +252,9 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
             //        as left emphasis
             //        else
             //        use current left emphasis to search, and pop current right emphasis
-            if (!(*currentLeftEmphasis)->IsMatch(*(*currentEmphasis)))
+            if (!m_store[currentLeftEmphasis].IsMatch(m_store[currentEmphasis]))
             {
-                std::vector<std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>>::iterator> store;
+                std::vector<size_t> store;
                 bool isFound = false;
                 // search first if matching left emphasis can be found with the right delim
                 // if match found, set the new left emphasis token as current token, and
@@ -184,7 +264,7 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
                 while (!leftEmphasisToExplore.empty() && !isFound)
                 {
                     auto leftToken = leftEmphasisToExplore.back();
-                    if ((*leftToken)->IsMatch(*(*currentEmphasis)))
+                    if (m_store[leftToken].IsMatch(m_store[currentEmphasis]))
                     {
                         currentLeftEmphasis = leftToken;
                         isFound = true;
@@ -212,45 +292,47 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
                         store.pop_back();
                     }
 
-                    // check for the reason why we had to backtrack
-                    if ((*leftEmphasisToExplore.back())->IsSameType(*(*currentEmphasis)))
+                    // check for the reason why we had to backtrack; only a token that can be either direction can
+                    // become a left emphasis, anything else would be looked at again forever
+                    if (m_store[currentEmphasis].IsLeftAndRightEmphasis() &&
+                        m_store[leftEmphasisToExplore.back()].IsSameType(m_store[currentEmphasis]))
                     {
                         // right emphasis becomes left emphasis
                         /// create new left empahsis html generator from right
-                        (*currentEmphasis)->ReverseDirectionType();
+                        m_store[currentEmphasis].ReverseDirectionType();
                     }
                     else
                     {
                         // move to next token for right delim tokens
-                        ++currentEmphasis;
+                        currentEmphasis = m_store[currentEmphasis].nextEmphasis;
                     }
                     // no maching found begin from the start
                     continue;
                 }
             }
             // check which one has leftover delims
-            m_isHTMLTagsAdded = (*currentLeftEmphasis)->GenerateTags(*(*currentEmphasis)) || m_isHTMLTagsAdded;
+            m_isHTMLTagsAdded = m_store[currentLeftEmphasis].GenerateTags(m_store[currentEmphasis]) || m_isHTMLTagsAdded;
 
             // all right delims used, move to next
-            if ((*currentEmphasis)->IsDone())
+            if (m_store[currentEmphasis].IsDone())
             {
-                ++currentEmphasis;
+                currentEmphasis = m_store[currentEmphasis].nextEmphasis;
             }
 
             // all left or right delims used, pop
-            if ((*currentLeftEmphasis)->IsDone())
+            if (m_store[currentLeftEmphasis].IsDone())
             {
                 leftEmphasisToExplore.pop_back();
             }
         }
         else
         {
-            ++currentEmphasis;
+            currentEmphasis = m_store[currentEmphasis].nextEmphasis;
         }
     }
 }
 
-bool MarkDownParsedResult::HasHtmlTags()
+bool MarkDownParsedResult::HasHtmlTags() const
 {
     return m_isHTMLTagsAdded;
 }
@@ -4,38 +4,45 @@
 
 #include "BaseCardElement.h"
 #include "MarkDownHtmlGenerator.h"
-#include <list>
 
 namespace AdaptiveCards
 {
 // Holds Parsing Result of MarkDown String
+//
+// The tokens themselves live in the MarkDownTokenStore; a parsed result is a list threaded through them, so
+// appending one result to another is O(1) and doesn't allocate.
 class MarkDownParsedResult
 {
 public:
-    MarkDownParsedResult() : m_isHTMLTagsAdded(false), m_isCaptured(false){};
+    MarkDownParsedResult(MarkDownTokenStore& store) : m_store(store), m_isHTMLTagsAdded(false), m_isCaptured(false){};
+    MarkDownParsedResult(const MarkDownParsedResult&) = delete;
+    MarkDownParsedResult(MarkDownParsedResult&&) = delete;
+    MarkDownParsedResult& operator=(const MarkDownParsedResult&) = delete;
+    MarkDownParsedResult& operator=(MarkDownParsedResult&&) = delete;
+    ~MarkDownParsedResult() = default;
 
     // Translate Intermediate Parsing Result to a form that can be written to html string
     void Translate();
     void AddBlockTags();
 
     // Write to html string
-    std::string GenerateHtmlString();
+    void GenerateHtmlString(std::string& html) const;
 
     // Append contents of the given parsing result object
     void AppendParseResult(MarkDownParsedResult&);
 
-    // Append html code gen object to parse result
-    void AppendToTokens(const std::shared_ptr<MarkDownHtmlGenerator>&);
+    // Append html code gen token to parse result
+    void AppendToTokens(size_t token);
 
-    // Append emphasis html code gen object to parse result
-    void AppendToLookUpTable(const std::shared_ptr<MarkDownEmphasisHtmlGenerator>&);
+    // Append emphasis html code gen token to parse result
+    void AppendToLookUpTable(size_t token);
 
     // Take a char and convert it html code gen and append it to the result. used to store MarkDown keywords such as
     // '[', ']', '(', ')'
-    void AddNewTokenToParsedResult(int ch);
+    void AddNewTokenToParsedResult(char ch);
 
     // Take string and convert it html code gen and append it to the result
-    void AddNewTokenToParsedResult(std::string& word);
+    void AddNewTokenToParsedResult(std::string_view word);
 
     // Take a new line char and convert it html code gen and append it to the result It is used to store MarkDown
     // keywords such as '\r', '\n'
@@ -43,7 +50,7 @@ public:
     void PopFront();
     void PopBack();
     void Clear();
-    bool HasHtmlTags();
+    bool HasHtmlTags() const;
     void FoundHtmlTags();
     bool GetIsCaptured() const
     {
@@ -53,15 +60,22 @@ public:
     {
         m_isCaptured = val;
     }
+    MarkDownTokenStore& GetStore() const
+    {
+        return m_store;
+    }
 
 private:
-    void MarkTags(MarkDownHtmlGenerator&);
-    std::list<std::shared_ptr<MarkDownHtmlGenerator>> m_codeGenTokens;
-    std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>> m_emphasisLookUpTable;
+    void MarkTags(MarkDownToken&);
+    MarkDownTokenStore& m_store;
+    size_t m_front = MarkDownToken::None;
+    size_t m_back = MarkDownToken::None;
+    size_t m_emphasisFront = MarkDownToken::None;
+    size_t m_emphasisBack = MarkDownToken::None;
     bool m_isHTMLTagsAdded;
     bool m_isCaptured;
 
-    // take m_emphasisLookUpTable and matches left and right emphasises
+    // take the emphasis look up table and matches left and right emphasises
     void MatchLeftAndRightEmphasises();
 };
 } // namespace AdaptiveCards
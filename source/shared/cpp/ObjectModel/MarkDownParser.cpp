@@ -1,10 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include "pch.h"
-#include <vector>
-#include <iomanip>
-#include <iostream>
 #include "MarkDownParser.h"
+#include "MarkDownCache.h"
 
 using namespace AdaptiveCards;
 
@@ -19,18 +17,39 @@ std::string MarkDownParser::TransformToHtml()
     {
         return "<p></p>";
     }
+
+    MarkDownCache::Result cached;
+    if (MarkDownCache::TryGet(m_text, cached))
+    {
+        m_hasHTMLTag = cached.hasHtmlTags;
+        m_isEscaped = cached.isEscaped;
+        return std::move(cached.html);
+    }
+
+    // tokens and their text are kept in one store, and escaped as they're read
+    MarkDownTokenStore store;
+    store.Reserve(m_text.size() * 2);
+    MarkDownParsedResult parsedResult(store);
+
     // begin parsing html blocks
-    ParseBlock();
+    ParseBlock(parsedResult);
 
     // process further what is parsed before outputting
     // html string
-    m_parsedResult.Translate();
+    parsedResult.Translate();
 
     // add block tags such as <p> <ul>
-    m_parsedResult.AddBlockTags();
+    parsedResult.AddBlockTags();
+
+    m_hasHTMLTag = parsedResult.HasHtmlTags();
+    m_isEscaped = (m_text.find_first_of("<>\"&") != std::string::npos);
 
-    m_hasHTMLTag = m_parsedResult.HasHtmlTags();
-    return m_parsedResult.GenerateHtmlString();
+    std::string html;
+    html.reserve(m_text.size() * 2);
+    parsedResult.GenerateHtmlString(html);
+
+    MarkDownCache::Add(m_text, html, m_hasHTMLTag, m_isEscaped);
+    return html;
 }
 
 bool MarkDownParser::HasHtmlTags()
@@ -49,46 +68,13 @@ std::string MarkDownParser::GetRawText() const
 }
 
 // MarkDown is consisted of Blocks, this methods parses blocks
-void MarkDownParser::ParseBlock()
+void MarkDownParser::ParseBlock(MarkDownParsedResult& parsedResult)
 {
-    std::stringstream stream(EscapeText());
-    EmphasisParser parser;
-    while (!stream.eof())
+    MarkDownStream stream(m_text);
+    EmphasisParser parser(parsedResult.GetStore());
+    while (!stream.Eof())
     {
         parser.ParseBlock(stream);
     }
-    m_parsedResult.AppendParseResult(parser.GetParsedResult());
-}
-
-std::string MarkDownParser::EscapeText()
-{
-    std::string escaped;
-    unsigned int nonEscapedCounts = 0;
-
-    for (std::string::size_type i = 0; i < m_text.length(); i++)
-    {
-        switch (m_text.at(i))
-        {
-        case '<':
-            escaped += "&lt;";
-            break;
-        case '>':
-            escaped += "&gt;";
-            break;
-        case '"':
-            escaped += "&quot;";
-            break;
-        case '&':
-            escaped += "&amp;";
-            break;
-        default:
-            escaped += m_text.at(i);
-            nonEscapedCounts++;
-            break;
-        }
-    }
-
-    m_isEscaped = (nonEscapedCounts != m_text.length());
-
-    return escaped;
+    parsedResult.AppendParseResult(parser.GetParsedResult());
 }
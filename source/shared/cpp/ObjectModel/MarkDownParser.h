@@ -24,10 +24,8 @@ public:
     bool IsEscaped() const;
 
 private:
-    void ParseBlock();
-    std::string EscapeText();
+    void ParseBlock(MarkDownParsedResult& parsedResult);
     std::string m_text;
-    MarkDownParsedResult m_parsedResult;
     bool m_hasHTMLTag;
     bool m_isEscaped;
 };
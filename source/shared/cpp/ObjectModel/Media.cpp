@@ -12,9 +12,9 @@ Media::Media() : BaseCardElement(CardElementType::Media)
     PopulateKnownPropertiesSet();
 }
 
-Json::Value Media::SerializeToJsonValue() const
+void Media::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseCardElement::SerializeToJsonValue();
+    BaseCardElement::SerializeProperties(root);
 
     if (!m_poster.empty())
     {
@@ -32,8 +32,11 @@ Json::Value Media::SerializeToJsonValue() const
     {
         root[sourcesPropertyName].append(source->SerializeToJsonValue());
     }
+}
 
-    return root;
+void Media::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::string Media::GetPoster() const
@@ -41,6 +44,11 @@ std::string Media::GetPoster() const
     return m_poster;
 }
 
+void Media::SetPoster(std::string&& value)
+{
+    m_poster = std::move(value);
+}
+
 void Media::SetPoster(const std::string& value)
 {
     m_poster = value;
@@ -51,6 +59,11 @@ std::string Media::GetAltText() const
     return m_altText;
 }
 
+void Media::SetAltText(std::string&& value)
+{
+    m_altText = std::move(value);
+}
+
 void Media::SetAltText(const std::string& value)
 {
     m_altText = value;
@@ -68,10 +81,11 @@ std::vector<std::shared_ptr<CaptionSource>>& Media::GetCaptionSources()
 
 void Media::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Poster),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Sources)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Poster,
+         AdaptiveCardSchemaKey::AltText,
+         AdaptiveCardSchemaKey::Sources});
+    m_knownProperties = &knownProperties;
 }
 
 void Media::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -115,7 +129,7 @@ std::shared_ptr<BaseCardElement> MediaParser::Deserialize(ParseContext& context,
         }
         else if (mimeBaseType != currentMimeBaseType)
         {
-            context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(
+            context.warnings.push_back(context.MakeShared<AdaptiveCardParseWarning>(
                 AdaptiveCards::WarningStatusCode::InvalidMediaMix,
                 "Media element containing a mix of audio and video was dropped"));
             return nullptr;
@@ -22,12 +22,12 @@ public:
     Media& operator=(Media&&) = default;
     ~Media() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::string GetPoster() const;
+    void SetPoster(std::string&& value);
     void SetPoster(const std::string& value);
 
     std::string GetAltText() const;
+    void SetAltText(std::string&& value);
     void SetAltText(const std::string& value);
 
     std::vector<std::shared_ptr<MediaSource>>& GetSources();
@@ -35,6 +35,10 @@ public:
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
+
 private:
     std::string m_poster;
     std::string m_altText;
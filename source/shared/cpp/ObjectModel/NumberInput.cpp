@@ -12,9 +12,9 @@ NumberInput::NumberInput() : BaseInputElement(CardElementType::NumberInput)
     PopulateKnownPropertiesSet();
 }
 
-Json::Value NumberInput::SerializeToJsonValue() const
+void NumberInput::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseInputElement::SerializeToJsonValue();
+    BaseInputElement::SerializeProperties(root);
 
     if (m_min)
     {
@@ -35,8 +35,6 @@ Json::Value NumberInput::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)] = m_placeholder;
     }
-
-    return root;
 }
 
 std::string NumberInput::GetPlaceholder() const
@@ -44,6 +42,11 @@ std::string NumberInput::GetPlaceholder() const
     return m_placeholder;
 }
 
+void NumberInput::SetPlaceholder(std::string&& value)
+{
+    m_placeholder = std::move(value);
+}
+
 void NumberInput::SetPlaceholder(const std::string& value)
 {
     m_placeholder = value;
@@ -101,9 +104,10 @@ std::shared_ptr<BaseCardElement> NumberInputParser::DeserializeFromString(ParseC
 
 void NumberInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Min});
+    m_knownProperties = &knownProperties;
 }
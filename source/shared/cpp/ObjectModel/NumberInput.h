@@ -18,9 +18,8 @@ public:
     NumberInput& operator=(NumberInput&&) = default;
     ~NumberInput() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::string GetPlaceholder() const;
+    void SetPlaceholder(std::string&& value);
     void SetPlaceholder(const std::string& value);
 
     std::optional<double> GetValue() const;
@@ -32,6 +31,9 @@ public:
     std::optional<double> GetMin() const;
     void SetMin(const std::optional<double>& value);
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
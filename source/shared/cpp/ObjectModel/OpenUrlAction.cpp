@@ -12,13 +12,16 @@ OpenUrlAction::OpenUrlAction() : BaseActionElement(ActionType::OpenUrl)
     PopulateKnownPropertiesSet();
 }
 
-Json::Value OpenUrlAction::SerializeToJsonValue() const
+void OpenUrlAction::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseActionElement::SerializeToJsonValue();
+    BaseActionElement::SerializeProperties(root);
 
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)] = GetUrl();
+}
 
-    return root;
+void OpenUrlAction::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::string OpenUrlAction::GetUrl() const
@@ -26,6 +29,11 @@ std::string OpenUrlAction::GetUrl() const
     return m_url;
 }
 
+void OpenUrlAction::SetUrl(std::string&& value)
+{
+    m_url = std::move(value);
+}
+
 void OpenUrlAction::SetUrl(const std::string& value)
 {
     m_url = value;
@@ -47,5 +55,6 @@ std::shared_ptr<BaseActionElement> OpenUrlActionParser::DeserializeFromString(Pa
 
 void OpenUrlAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)});
+    static const auto knownProperties = ExtendKnownProperties({AdaptiveCardSchemaKey::Url});
+    m_knownProperties = &knownProperties;
 }
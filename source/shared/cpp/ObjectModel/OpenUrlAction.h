@@ -18,11 +18,14 @@ public:
     OpenUrlAction& operator=(OpenUrlAction&&) = default;
     ~OpenUrlAction() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::string GetUrl() const;
+    void SetUrl(std::string&& value);
     void SetUrl(const std::string& value);
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseArena.h"
+
+namespace AdaptiveCards
+{
+ParseArena::ParseArena(std::size_t blockSize) :
+    m_blocks{}, m_blockSize(blockSize ? blockSize : DefaultBlockSize), m_reservedSize(0), m_cursor(nullptr), m_remaining(0)
+{
+}
+
+void* ParseArena::Allocate(std::size_t size, std::size_t alignment)
+{
+    const std::size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(m_cursor) % alignment) % alignment;
+    if (m_cursor == nullptr || padding + size > m_remaining)
+    {
+        // allocations that wouldn't leave room for anything else get a block of their own so that we don't throw
+        // away the rest of the current one
+        if (size + alignment > m_blockSize / 2)
+        {
+            auto block = static_cast<unsigned char*>(AllocateBlock(size + alignment));
+            return block + (alignment - reinterpret_cast<std::uintptr_t>(block) % alignment) % alignment;
+        }
+
+        m_cursor = static_cast<unsigned char*>(AllocateBlock(m_blockSize));
+        m_remaining = m_blockSize;
+        return Allocate(size, alignment);
+    }
+
+    void* allocation = m_cursor + padding;
+    m_cursor += padding + size;
+    m_remaining -= padding + size;
+    return allocation;
+}
+
+std::size_t ParseArena::GetReservedSize() const
+{
+    return m_reservedSize;
+}
+
+void* ParseArena::AllocateBlock(std::size_t size)
+{
+    m_blocks.emplace_back(new unsigned char[size]);
+    m_reservedSize += size;
+    return m_blocks.back().get();
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// A monotonic arena that a ParseContext can place the parsed object graph in. Allocation bumps a cursor through
+// large blocks and individual deallocation is a no-op; every block is released at once when the arena is destroyed.
+// An arena is not thread-safe and is meant to be fed by a single parse at a time.
+class ParseArena
+{
+public:
+    static constexpr std::size_t DefaultBlockSize = 16 * 1024;
+
+    explicit ParseArena(std::size_t blockSize = DefaultBlockSize);
+    ParseArena(const ParseArena&) = delete;
+    ParseArena& operator=(const ParseArena&) = delete;
+
+    void* Allocate(std::size_t size, std::size_t alignment);
+
+    // Total bytes reserved from the system, including unused space at the end of each block
+    std::size_t GetReservedSize() const;
+
+private:
+    void* AllocateBlock(std::size_t size);
+
+    std::vector<std::unique_ptr<unsigned char[]>> m_blocks;
+    std::size_t m_blockSize;
+    std::size_t m_reservedSize;
+    unsigned char* m_cursor;
+    std::size_t m_remaining;
+};
+
+// Standard allocator over a ParseArena, for use with std::allocate_shared. Every object allocated through it holds a
+// reference to the arena, so the arena lives exactly as long as the last object placed in it.
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(std::shared_ptr<ParseArena> arena) noexcept : m_arena(std::move(arena)) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_arena(other.m_arena)
+    {
+    }
+
+    T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(m_arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept
+    {
+        return m_arena == other.m_arena;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept
+    {
+        return m_arena != other.m_arena;
+    }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    std::shared_ptr<ParseArena> m_arena;
+};
+} // namespace AdaptiveCards
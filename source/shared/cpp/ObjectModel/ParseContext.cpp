@@ -4,6 +4,7 @@
 #include "ParseContext.h"
 #include "AdaptiveCardParseException.h"
 #include "BaseElement.h"
+#include "ParseInstrumentation.h"
 #include "StyledCollectionElement.h"
 
 namespace AdaptiveCards
@@ -144,7 +145,7 @@ ParseContext::ParseContext(std::shared_ptr<ElementParserRegistration> elementReg
 // ================================================================================
 
 // Push the provided state on to our ID stack (see comment above)
-void ParseContext::PushElement(const std::string& idJsonProperty, const AdaptiveCards::InternalId& internalId, const bool isFallback /*=false*/)
+void ParseContext::PushElement(std::string idJsonProperty, const AdaptiveCards::InternalId& internalId, const bool isFallback /*=false*/)
 {
     if (internalId == InternalId::Invalid)
     {
@@ -152,7 +153,17 @@ void ParseContext::PushElement(const std::string& idJsonProperty, const Adaptive
             ErrorStatusCode::InvalidPropertyValue, "Attemping to push an element on to the stack with an invalid ID");
     }
 
-    m_idStack.push_back({idJsonProperty, internalId, isFallback});
+    AdaptiveCards::InternalId nearestFallbackId;
+    if (isFallback)
+    {
+        nearestFallbackId = internalId;
+    }
+    else if (!m_idStack.empty())
+    {
+        nearestFallbackId = std::get<TupleIndex::NearestFallbackId>(m_idStack.back());
+    }
+
+    m_idStack.emplace_back(std::move(idJsonProperty), internalId, isFallback, nearestFallbackId);
 }
 
 // Pop the last id off our stack and perform validation (see comment above)
@@ -164,16 +175,20 @@ void ParseContext::PopElement()
     const auto& elementInternalId{std::get<TupleIndex::InternalId>(idsToPop)};
     const bool isFallback{std::get<TupleIndex::IsFallback>(idsToPop)};
 
-    if (!elementId.empty())
+    // Fallback entries neither collide nor get recorded; the element they were pushed for is checked when it's popped
+    if (!elementId.empty() && !isFallback)
     {
+        // -1 is the last item on the stack (the one we're about to pop)
+        // -2 is the parent of the last item on the stack, if it isn't a toplevel element
+        const bool haveParent = m_idStack.size() > 1;
+        const auto& parentInternalId = haveParent ? std::get<TupleIndex::InternalId>(m_idStack[m_idStack.size() - 2]) : elementInternalId;
+
+        auto& fallbackIds = m_elementIds[elementId];
         bool haveCollision = false;
-        const auto& nearestFallbackId = GetNearestFallbackId(elementInternalId);
 
-        // Walk through the list of elements we've seen with this ID
-        for (auto currentEntry = m_elementIds.find(elementId); currentEntry != m_elementIds.end(); ++currentEntry)
+        // Walk through the fallback parents of the elements we've seen with this ID
+        for (const auto& entryFallbackId : fallbackIds)
         {
-            const AdaptiveCards::InternalId& entryFallbackId = currentEntry->second;
-
             // If the element we're about to pop is the fallback parent for this entry, then there's no collision
             // (fallback content is allowed to have the same ID as its parent)
             if (entryFallbackId == elementInternalId)
@@ -182,32 +197,12 @@ void ParseContext::PopElement()
                 break;
             }
 
-            // The inverse of the above -- if this element's fallback parent is the entry we're looking at, there's
-            // no collision.
-            try
-            {
-                // -1 is the last item on the stack (the one we're about to pop)
-                // -2 is the parent of the last item on the stack
-                const auto& previousInStack = m_idStack.at(m_idStack.size() - 2);
-                if (std::get<TupleIndex::InternalId>(previousInStack) == entryFallbackId)
-                {
-                    // we're looking at a fallback entry for our parent
-                    break;
-                }
-            }
-            catch (const std::out_of_range&)
-            {
-                // we're looking at a toplevel element
-            }
-
-            // if the element we're inspecting is fallback content, continue on to the next entry
-            if (isFallback)
+            // The inverse of the above -- if this element's parent is the fallback parent for this entry, there's no
+            // collision. Anything else is.
+            if (!haveParent || entryFallbackId != parentInternalId)
             {
-                continue;
+                haveCollision = true;
             }
-
-            // at this point, we may or may not have a collision depending on additional entries.
-            haveCollision = true;
         }
 
         if (haveCollision)
@@ -216,36 +211,17 @@ void ParseContext::PopElement()
                 ErrorStatusCode::IdCollision, "Collision detected for id '" + elementId + "'");
         }
 
-        // no need to add an entry for this element if it's fallback (we'll add one when we parse it for non-fallback)
-        if (!isFallback)
+        // the nearest fallback below this element, since the element itself isn't fallback
+        const auto& nearestFallbackId = std::get<TupleIndex::NearestFallbackId>(idsToPop);
+        if (std::find(fallbackIds.begin(), fallbackIds.end(), nearestFallbackId) == fallbackIds.end())
         {
-            m_elementIds.emplace(std::make_pair(elementId, nearestFallbackId));
+            fallbackIds.push_back(nearestFallbackId);
         }
     }
 
     m_idStack.pop_back();
 }
 
-// Walk stack looking for first element to be marked fallback (which isn't the ID we're supposed to skip), then
-// return its internal ID. If none, return an invalid ID. (see comment above)
-const AdaptiveCards::InternalId ParseContext::GetNearestFallbackId(const AdaptiveCards::InternalId& skipId) const
-{
-    for (auto curElement = m_idStack.crbegin(); curElement != m_idStack.crend(); ++curElement)
-    {
-        if (std::get<TupleIndex::IsFallback>(*curElement)) // if element is fallback
-        {
-            // retrieve the internal ID
-            const AdaptiveCards::InternalId& internalId = std::get<TupleIndex::InternalId>(*curElement);
-            if (internalId != skipId)
-            {
-                return internalId;
-            }
-        }
-    }
-    AdaptiveCards::InternalId invalidId;
-    return invalidId;
-}
-
 ContainerStyle ParseContext::GetParentalContainerStyle() const
 {
     return m_parentalContainerStyles.size() ? m_parentalContainerStyles.back() : ContainerStyle::Default;
@@ -325,6 +301,32 @@ void ParseContext::PopBleedDirection()
     m_parentalBleedDirection.pop_back();
 }
 
+void ParseContext::AddDeferredArray(const Json::Value& owner, AdaptiveCardSchemaKey key, const DeferredJsonArray& items)
+{
+    m_deferredArrays.emplace_back(&owner, key, &items);
+}
+
+void ParseContext::RemoveDeferredArrays(const Json::Value& owner)
+{
+    // owner's arrays are the last ones added, as anything added while it was being parsed is gone again
+    while (!m_deferredArrays.empty() && std::get<0>(m_deferredArrays.back()) == &owner)
+    {
+        m_deferredArrays.pop_back();
+    }
+}
+
+const DeferredJsonArray* ParseContext::GetDeferredArray(const Json::Value& owner, AdaptiveCardSchemaKey key) const
+{
+    for (auto it = m_deferredArrays.rbegin(); it != m_deferredArrays.rend(); ++it)
+    {
+        if (std::get<0>(*it) == &owner && std::get<1>(*it) == key)
+        {
+            return std::get<2>(*it);
+        }
+    }
+    return nullptr;
+}
+
 void ParseContext::SetLanguage(const std::string& value)
 {
     m_language = value;
@@ -334,4 +336,19 @@ const std::string& ParseContext::GetLanguage() const
 {
     return m_language;
 }
+
+void ParseContext::EnableArenaAllocation(std::size_t blockSize)
+{
+    m_arena = std::make_shared<ParseArena>(blockSize);
+}
+
+std::shared_ptr<ParseArena> ParseContext::GetArena() const
+{
+    return m_arena;
+}
+
+void ParseContext::SetInstrumentation(std::shared_ptr<ParseInstrumentation> instrumentation)
+{
+    m_instrumentation = std::move(instrumentation);
+}
 } // namespace AdaptiveCards
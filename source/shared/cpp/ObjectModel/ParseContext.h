@@ -8,10 +8,33 @@
 #include "ElementParserRegistration.h"
 #include "ActionParserRegistration.h"
 #include "AdaptiveCardParseWarning.h"
+#include "ParseArena.h"
 
 namespace AdaptiveCards
 {
 class StyledCollectionElement;
+class ParseInstrumentation;
+class ParseContext;
+
+// An array of elements or actions that has been left out of the json of the object holding it, to be read one item at a
+// time as the collection parsers in ParseUtil come to it (see AdaptiveCard::DeserializeFromStringStreaming). Only the
+// item being parsed and those holding it, each less any arrays left out the same way, are ever held as Json::Values.
+class DeferredJsonArray
+{
+public:
+    using ItemCallback = std::function<void(const Json::Value&)>;
+
+    virtual ~DeferredJsonArray() = default;
+
+    virtual std::size_t GetItemCount() const = 0;
+
+    // Calls onItem with each item in turn. An item without a type is given impliedType, if that isn't empty.
+    virtual void ForEachItem(ParseContext& context, const std::string& impliedType, const ItemCallback& onItem) const = 0;
+};
+
+// Holds the mutable state of a single parse. A ParseContext must not be used by more than one thread at a time, but
+// separate contexts may parse concurrently, and may even share parser registrations as long as those registrations
+// aren't modified while a parse is in flight.
 class ParseContext
 {
 public:
@@ -22,7 +45,7 @@ public:
     std::shared_ptr<ActionParserRegistration> actionParserRegistration;
     std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
     // Push/PopElement are used during parsing to track the tree structure of a card.
-    void PushElement(const std::string& idJsonProperty, const AdaptiveCards::InternalId& internalId, const bool isFallback = false);
+    void PushElement(std::string idJsonProperty, const AdaptiveCards::InternalId& internalId, const bool isFallback = false);
     void PopElement();
 
     // tells if it's possible to fallback to ancestor
@@ -48,37 +71,77 @@ public:
     void PushBleedDirection(const ContainerBleedDirection direction);
     void PopBleedDirection();
 
+    // Opts this context in to arena allocation. From then on, the elements, actions, inlines and warnings created by
+    // parses using this context are placed in a single ParseArena instead of being allocated one at a time. The arena
+    // is freed in one go once the last object placed in it is released.
+    void EnableArenaAllocation(std::size_t blockSize = ParseArena::DefaultBlockSize);
+    std::shared_ptr<ParseArena> GetArena() const;
+
+    // Reports the parse of every element and action to instrumentation (see ParseInstrumentation.h), or stops
+    // reporting if it's null
+    void SetInstrumentation(std::shared_ptr<ParseInstrumentation> instrumentation);
+    ParseInstrumentation* GetInstrumentation() const
+    {
+        return m_instrumentation.get();
+    }
+
+    // Stands items in for the array under key in owner, which owner leaves out, until RemoveDeferredArrays(owner)
+    void AddDeferredArray(const Json::Value& owner, AdaptiveCardSchemaKey key, const DeferredJsonArray& items);
+    void RemoveDeferredArrays(const Json::Value& owner);
+    const DeferredJsonArray* GetDeferredArray(const Json::Value& owner, AdaptiveCardSchemaKey key) const;
+
+    // Used by parsers in place of std::make_shared, so that objects land in the arena when one is enabled
+    template <typename T, typename... Args>
+    std::shared_ptr<T> MakeShared(Args&&... args) const
+    {
+        if (m_arena)
+        {
+            return std::allocate_shared<T>(ArenaAllocator<T>(m_arena), std::forward<Args>(args)...);
+        }
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
 private:
-    const AdaptiveCards::InternalId GetNearestFallbackId(const AdaptiveCards::InternalId& skipId) const;
     // This enum is just a helper to keep track of the position of contents within the std::tuple used in
     // m_idStack below. We don't use enum class here because we don't want typed values for use in std::get
     enum TupleIndex : unsigned int
     {
         Id = 0U,
         InternalId,
-        IsFallback
+        IsFallback,
+        NearestFallbackId
     };
 
     // m_elementIds keeps track of which elements we've seen during a parse. This is used to detect collisions on id
-    // within an Adaptive Card json file. Specifically, we track which non-empty ids we've seen and correllate them
-    // to the internal ID of the element for which it serves fallback (if any). We use unordered_multimap here as
-    // duplicate entries are valid in some circumstances (i.e. where fallback content shares an ID with its parent)
+    // within an Adaptive Card json file. Specifically, we track which non-empty ids we've seen and, for each, the
+    // distinct internal IDs of the elements for which they serve fallback (or an invalid ID if they aren't in fallback
+    // content). An id may only repeat under a fallback parent, so in a card without collisions each list holds no more
+    // than a few entries no matter how large the card is.
     //
-    //             map ID json property           ->             fallback ID
-    std::unordered_multimap<std::string, AdaptiveCards::InternalId> m_elementIds;
+    //                 map ID json property    ->    fallback IDs
+    std::unordered_map<std::string, std::vector<AdaptiveCards::InternalId>> m_elementIds;
 
     // m_idStack is the stack we use during parse time to track the hierarchy of cards as they are encountered.
     // Any time we parse an element we push it on to the stack, parse its children (if any), then pop it off the
-    // stack. When we pop off the stack, we perform id collision detection.
+    // stack. When we pop off the stack, we perform id collision detection. Each entry also carries the internal ID of
+    // the innermost fallback element at or below it on the stack, so that we never have to walk the stack.
     //
-    //                             (ID,  internal ID, isFallback)[]
-    std::vector<std::tuple<std::string, AdaptiveCards::InternalId, bool>> m_idStack;
+    //                             (ID,  internal ID, isFallback, nearest fallback ID)[]
+    std::vector<std::tuple<std::string, AdaptiveCards::InternalId, bool, AdaptiveCards::InternalId>> m_idStack;
 
     std::vector<ContainerStyle> m_parentalContainerStyles;
     std::vector<AdaptiveCards::InternalId> m_parentalPadding;
     std::vector<ContainerBleedDirection> m_parentalBleedDirection;
 
+    // the arrays added by AddDeferredArray, which only ever holds those of the objects being parsed on the way down from
+    // the root, so it's searched from the innermost object out
+    //
+    //                     (owner,            key,                   items)[]
+    std::vector<std::tuple<const Json::Value*, AdaptiveCardSchemaKey, const DeferredJsonArray*>> m_deferredArrays;
+
     bool m_canFallbackToAncestor;
     std::string m_language;
+    std::shared_ptr<ParseArena> m_arena;
+    std::shared_ptr<ParseInstrumentation> m_instrumentation;
 };
 } // namespace AdaptiveCards
@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseInstrumentation.h"
+
+namespace AdaptiveCards
+{
+ParseInstrumentationScope::ParseInstrumentationScope(ParseContext& context, ParseInstrumentation::ElementKind kind, const Json::Value& json) :
+    m_instrumentation(context.GetInstrumentation()), m_context(context), m_kind(kind), m_type{}, m_warningCount(0)
+{
+    if (m_instrumentation == nullptr)
+    {
+        return;
+    }
+
+    // don't use ParseUtil::GetTypeAsString here; a missing type is for the parser to complain about
+    const auto& type = json.isObject() ? json[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] : Json::Value::nullSingleton();
+    if (type.isString())
+    {
+        m_type = type.asString();
+    }
+    m_warningCount = context.warnings.size();
+    m_instrumentation->OnParseBegin(m_kind, m_type);
+}
+
+ParseInstrumentationScope::~ParseInstrumentationScope()
+{
+    if (m_instrumentation != nullptr)
+    {
+        m_instrumentation->OnParseEnd(m_kind, m_type, m_context.warnings.size() - m_warningCount);
+    }
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseContext.h"
+
+namespace AdaptiveCards
+{
+// Receives events from the parsers of a ParseContext it has been set on with ParseContext::SetInstrumentation, to find
+// out where parse time goes. Events for a given context arrive on the thread parsing with it; an instrumentation
+// shared between contexts must cope with events from several threads at once.
+//
+// Defining ADAPTIVECARDS_DISABLE_PARSE_INSTRUMENTATION compiles the events out of the parsers altogether.
+class ParseInstrumentation
+{
+public:
+    enum class ElementKind
+    {
+        CardElement,
+        Action
+    };
+
+    virtual ~ParseInstrumentation() = default;
+
+    // Called before and after an element or action parser's Deserialize, with the element's "type" property. Every
+    // begin is matched by an end, even if the parse throws. warningCount is the number of warnings added in between,
+    // including those of nested elements.
+    virtual void OnParseBegin(ElementKind kind, const std::string& type) = 0;
+    virtual void OnParseEnd(ElementKind kind, const std::string& type, std::size_t warningCount) = 0;
+
+    // Called while parsing an element that has fallback, with the kind of fallback it has
+    virtual void OnFallback(FallbackType fallbackType) = 0;
+
+    // Called when an element or action whose type has no registered parser is parsed as Unknown or UnknownAction
+    virtual void OnUnknownType(ElementKind kind, const std::string& type) = 0;
+};
+
+// Reports the begin and end of one element's parse to the context's instrumentation, if it has any
+class ParseInstrumentationScope
+{
+public:
+    ParseInstrumentationScope(ParseContext& context, ParseInstrumentation::ElementKind kind, const Json::Value& json);
+    ParseInstrumentationScope(const ParseInstrumentationScope&) = delete;
+    ParseInstrumentationScope& operator=(const ParseInstrumentationScope&) = delete;
+    ~ParseInstrumentationScope();
+
+private:
+    ParseInstrumentation* m_instrumentation;
+    const ParseContext& m_context;
+    ParseInstrumentation::ElementKind m_kind;
+    std::string m_type;
+    std::size_t m_warningCount;
+};
+} // namespace AdaptiveCards
@@ -21,4 +21,12 @@ private:
     std::shared_ptr<AdaptiveCard> m_adaptiveCard;
     std::vector<std::shared_ptr<AdaptiveCardParseWarning>> m_warnings;
 };
+
+// What parsing one card of a batch came to (see AdaptiveCard::DeserializeFromStrings): its ParseResult, or else the
+// exception parsing it threw, most often an AdaptiveCardParseException
+struct BatchParseResult
+{
+    std::shared_ptr<ParseResult> parseResult;
+    std::exception_ptr error;
+};
 } // namespace AdaptiveCards
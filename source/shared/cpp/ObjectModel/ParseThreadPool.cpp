@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseThreadPool.h"
+
+namespace AdaptiveCards
+{
+ParseThreadPool::ParseThreadPool(unsigned int threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // the thread calling ParallelFor is one of the threadCount
+    for (unsigned int i = 1; i < threadCount; ++i)
+    {
+        try
+        {
+            m_workers.emplace_back(&ParseThreadPool::RunWorker, this);
+        }
+        catch (const std::system_error&)
+        {
+            // out of threads -- the workers we already have will pick up the slack
+            break;
+        }
+    }
+}
+
+ParseThreadPool::~ParseThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_stopping = true;
+    }
+    m_batchStarted.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+unsigned int ParseThreadPool::GetThreadCount() const
+{
+    return static_cast<unsigned int>(m_workers.size()) + 1;
+}
+
+void ParseThreadPool::ParallelFor(std::size_t count, const std::function<void(std::size_t)>& job)
+{
+    std::lock_guard<std::mutex> batchLock(m_batchLock);
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_job = &job;
+        m_jobCount = count;
+        m_nextJob = 0;
+        ++m_batch;
+    }
+    m_batchStarted.notify_all();
+
+    RunJobs();
+
+    // every job has been claimed; wait for the workers still running theirs, then take the batch down so that a worker
+    // waking up late doesn't join a batch that's over
+    std::unique_lock<std::mutex> lock(m_lock);
+    m_workerFinished.wait(lock, [this]() { return m_busyWorkers == 0; });
+    m_job = nullptr;
+}
+
+ParseThreadPool& ParseThreadPool::GetDefault()
+{
+    static ParseThreadPool pool;
+    return pool;
+}
+
+void ParseThreadPool::RunWorker()
+{
+    std::uint64_t lastBatch = 0;
+    std::unique_lock<std::mutex> lock(m_lock);
+    while (true)
+    {
+        m_batchStarted.wait(lock, [&]() { return m_stopping || (m_job != nullptr && m_batch != lastBatch); });
+        if (m_stopping)
+        {
+            return;
+        }
+
+        // m_job and m_jobCount stay put while any worker is busy
+        lastBatch = m_batch;
+        ++m_busyWorkers;
+        lock.unlock();
+        RunJobs();
+        lock.lock();
+        if (--m_busyWorkers == 0)
+        {
+            m_workerFinished.notify_all();
+        }
+    }
+}
+
+void ParseThreadPool::RunJobs()
+{
+    for (std::size_t i = m_nextJob++; i < m_jobCount; i = m_nextJob++)
+    {
+        (*m_job)(i);
+    }
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// A set of worker threads for parsing batches of cards (see AdaptiveCard::DeserializeFromStrings). The threads are
+// started when the pool is made and reused by every batch run on it, so a service that parses batch after batch pays for
+// thread creation once. Within a batch, idle threads claim the next job from a shared counter, so a thread that draws a
+// run of cheap cards goes on to claim more while the others are busy with expensive ones.
+class ParseThreadPool
+{
+public:
+    // threadCount includes the thread that calls ParallelFor, which always takes part; 0 means one per hardware thread
+    explicit ParseThreadPool(unsigned int threadCount = 0);
+    ~ParseThreadPool();
+
+    ParseThreadPool(const ParseThreadPool&) = delete;
+    ParseThreadPool& operator=(const ParseThreadPool&) = delete;
+
+    unsigned int GetThreadCount() const;
+
+    // Calls job(i) for each i in [0, count) on the pool's threads and the calling one, and returns once every call has.
+    // job must not throw. Batches from different callers take turns; a job must not start a batch on its own pool.
+    void ParallelFor(std::size_t count, const std::function<void(std::size_t)>& job);
+
+    // A pool with one thread per hardware thread, shared by everything that doesn't bring its own
+    static ParseThreadPool& GetDefault();
+
+private:
+    void RunWorker();
+    void RunJobs();
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_batchLock; // held for the whole of a batch, so that batches take turns
+    std::mutex m_lock;      // guards everything below but m_nextJob
+    std::condition_variable m_batchStarted;
+    std::condition_variable m_workerFinished;
+    const std::function<void(std::size_t)>* m_job = nullptr;
+    std::size_t m_jobCount = 0;
+    std::atomic<std::size_t> m_nextJob{0};
+    std::uint64_t m_batch = 0;
+    unsigned int m_busyWorkers = 0;
+    bool m_stopping = false;
+};
+} // namespace AdaptiveCards
@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseTimingAggregator.h"
+#include "ParseUtil.h"
+
+namespace AdaptiveCards
+{
+namespace
+{
+    std::size_t GetHistogramBucket(std::chrono::nanoseconds duration)
+    {
+        std::size_t bucket = 0;
+        for (auto count = duration.count(); count > 1 && bucket < ParseTimingAggregator::HistogramBucketCount - 1; count >>= 1)
+        {
+            ++bucket;
+        }
+        return bucket;
+    }
+} // namespace
+
+thread_local std::vector<ParseTimingAggregator::ThreadParse> ParseTimingAggregator::s_threadParses;
+
+ParseTimingAggregator::ThreadParse* ParseTimingAggregator::FindThreadParse() const
+{
+    for (auto parse = s_threadParses.rbegin(); parse != s_threadParses.rend(); ++parse)
+    {
+        if (parse->aggregator == this)
+        {
+            return &*parse;
+        }
+    }
+    return nullptr;
+}
+
+void ParseTimingAggregator::OnParseBegin(ElementKind, const std::string& type)
+{
+    const auto generation = m_generation.load();
+    ThreadParse* parse = FindThreadParse();
+    if (!parse)
+    {
+        parse = &s_threadParses.emplace_back(ThreadParse{this, generation, {}, {}});
+    }
+    else if (parse->generation != generation)
+    {
+        // Reset was called partway through the parse: what the parse has counted so far is dropped, and the elements
+        // still being parsed from before it are left uncounted
+        parse->generation = generation;
+        parse->statistics.clear();
+    }
+
+    parse->frames.push_back(Frame{type, generation, Clock::now(), std::chrono::nanoseconds{0}, 0});
+}
+
+void ParseTimingAggregator::OnParseEnd(ElementKind, const std::string&, std::size_t warningCount)
+{
+    const auto end = Clock::now();
+
+    ThreadParse* parse = FindThreadParse();
+    if (!parse || parse->frames.empty())
+    {
+        return;
+    }
+
+    auto& frames = parse->frames;
+    const Frame frame = std::move(frames.back());
+    frames.pop_back();
+
+    const auto totalTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - frame.start);
+    const auto selfTime = totalTime - frame.childTime;
+
+    if (frame.generation == parse->generation)
+    {
+        auto& statistics = parse->statistics[frame.type];
+        ++statistics.parseCount;
+        statistics.totalTime += totalTime;
+        statistics.selfTime += selfTime;
+        statistics.warningCount += warningCount - std::min(warningCount, frame.childWarningCount);
+        ++statistics.selfTimeHistogram[GetHistogramBucket(selfTime)];
+    }
+
+    if (frames.empty())
+    {
+        MergeStatistics(*parse);
+        s_threadParses.erase(s_threadParses.begin() + (parse - s_threadParses.data()));
+    }
+    else
+    {
+        frames.back().childTime += totalTime;
+        frames.back().childWarningCount += warningCount;
+    }
+}
+
+void ParseTimingAggregator::OnFallback(FallbackType)
+{
+    ThreadParse* parse = FindThreadParse();
+    if (parse && !parse->frames.empty() && parse->frames.back().generation == parse->generation)
+    {
+        ++parse->statistics[parse->frames.back().type].fallbackCount;
+    }
+}
+
+void ParseTimingAggregator::OnUnknownType(ElementKind, const std::string& type)
+{
+    ThreadParse* parse = FindThreadParse();
+    if (parse && !parse->frames.empty() && parse->frames.back().generation == parse->generation)
+    {
+        ++parse->statistics[type].unknownCount;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_lock);
+    ++m_statistics[type].unknownCount;
+}
+
+void ParseTimingAggregator::MergeStatistics(const ThreadParse& parse)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    // Reset was called after the last element was counted
+    if (parse.generation != m_generation)
+    {
+        return;
+    }
+
+    for (const auto& [type, statistics] : parse.statistics)
+    {
+        auto& merged = m_statistics[type];
+        merged.parseCount += statistics.parseCount;
+        merged.totalTime += statistics.totalTime;
+        merged.selfTime += statistics.selfTime;
+        merged.warningCount += statistics.warningCount;
+        merged.fallbackCount += statistics.fallbackCount;
+        merged.unknownCount += statistics.unknownCount;
+        for (std::size_t bucket = 0; bucket < HistogramBucketCount; ++bucket)
+        {
+            merged.selfTimeHistogram[bucket] += statistics.selfTimeHistogram[bucket];
+        }
+    }
+}
+
+std::map<std::string, ParseTimingAggregator::TypeStatistics> ParseTimingAggregator::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_statistics;
+}
+
+Json::Value ParseTimingAggregator::SerializeToJsonValue() const
+{
+    Json::Value root(Json::objectValue);
+    for (const auto& [type, statistics] : GetStatistics())
+    {
+        Json::Value& typeValue = root[type];
+        typeValue["parseCount"] = Json::UInt64{statistics.parseCount};
+        typeValue["totalNanoseconds"] = Json::Int64{statistics.totalTime.count()};
+        typeValue["selfNanoseconds"] = Json::Int64{statistics.selfTime.count()};
+        typeValue["warningCount"] = Json::UInt64{statistics.warningCount};
+        typeValue["fallbackCount"] = Json::UInt64{statistics.fallbackCount};
+        typeValue["unknownCount"] = Json::UInt64{statistics.unknownCount};
+
+        // leave off the empty buckets at the slow end
+        const auto& histogram = statistics.selfTimeHistogram;
+        const auto used = std::find_if(histogram.rbegin(), histogram.rend(), [](std::uint64_t count) { return count != 0; });
+        Json::Value& histogramValue = typeValue["selfTimeHistogram"] = Json::Value(Json::arrayValue);
+        for (auto bucket = histogram.begin(); bucket != used.base(); ++bucket)
+        {
+            histogramValue.append(Json::UInt64{*bucket});
+        }
+    }
+    return root;
+}
+
+std::string ParseTimingAggregator::Serialize() const
+{
+    return ParseUtil::JsonToString(SerializeToJsonValue());
+}
+
+void ParseTimingAggregator::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    ++m_generation;
+    m_statistics.clear();
+}
+} // namespace AdaptiveCards
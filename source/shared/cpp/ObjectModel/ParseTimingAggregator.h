@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseInstrumentation.h"
+
+namespace AdaptiveCards
+{
+// A ParseInstrumentation that totals up parse time, warnings, fallbacks and unknown types per element type, with a
+// histogram of how long individual parses of each type took. One aggregator may be set on any number of contexts,
+// including ones parsing on different threads at the same time. Each thread keeps the statistics of the card it's
+// parsing to itself, and only adds them to the aggregator's once the card is done.
+class ParseTimingAggregator : public ParseInstrumentation
+{
+public:
+    static constexpr std::size_t HistogramBucketCount = 32;
+
+    struct TypeStatistics
+    {
+        std::uint64_t parseCount = 0;
+        // time spent in the parser, with and without the time spent parsing nested elements
+        std::chrono::nanoseconds totalTime{0};
+        std::chrono::nanoseconds selfTime{0};
+        // warnings raised by elements of this type, not counting those raised by nested elements
+        std::uint64_t warningCount = 0;
+        std::uint64_t fallbackCount = 0;
+        std::uint64_t unknownCount = 0;
+        // selfTimeHistogram[i] counts the parses whose self time was under 2^(i+1) ns but not under 2^i ns; the
+        // first bucket also holds anything quicker, the last anything slower
+        std::array<std::uint64_t, HistogramBucketCount> selfTimeHistogram{};
+    };
+
+    void OnParseBegin(ElementKind kind, const std::string& type) override;
+    void OnParseEnd(ElementKind kind, const std::string& type, std::size_t warningCount) override;
+    void OnFallback(FallbackType fallbackType) override;
+    void OnUnknownType(ElementKind kind, const std::string& type) override;
+
+    // Statistics gathered from the cards parsed so far, keyed by the "type" property of the elements and actions parsed
+    std::map<std::string, TypeStatistics> GetStatistics() const;
+    Json::Value SerializeToJsonValue() const;
+    std::string Serialize() const;
+
+    // Forgets the statistics gathered so far; parses in flight are only counted from their next element on
+    void Reset();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Frame
+    {
+        std::string type;
+        std::uint64_t generation;
+        Clock::time_point start;
+        std::chrono::nanoseconds childTime;
+        std::size_t childWarningCount;
+    };
+
+    // What one thread is in the middle of parsing with one aggregator: its elements, innermost last, and the
+    // statistics of those it has finished, which are only merged into the aggregator's once the outermost one ends
+    struct ThreadParse
+    {
+        const ParseTimingAggregator* aggregator;
+        std::uint64_t generation;
+        std::vector<Frame> frames;
+        std::map<std::string, TypeStatistics> statistics;
+    };
+
+    ThreadParse* FindThreadParse() const;
+    void MergeStatistics(const ThreadParse& parse);
+
+    // a thread's parses, for each aggregator it's parsing with; more than one only when one parse runs inside another
+    static thread_local std::vector<ThreadParse> s_threadParses;
+
+    mutable std::mutex m_lock;
+    // counts the calls to Reset, so that statistics from parses in flight at the time can be told apart
+    std::atomic<std::uint64_t> m_generation{0};
+    std::map<std::string, TypeStatistics> m_statistics;
+};
+} // namespace AdaptiveCards
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "ParseUtil.h"
+#include "JsonWriter.h"
 #include "AdaptiveCardParseException.h"
 #include "ElementParserRegistration.h"
 #include "ActionParserRegistration.h"
@@ -11,11 +12,11 @@
 
 namespace
 {
-Json::StreamWriterBuilder CreateJsonStreamWriter()
+Json::CharReaderBuilder CreateJsonCharReader()
 {
-    Json::StreamWriterBuilder builder;
-    builder["commentStyle"] = "None";
-    builder["indentation"] = "";
+    Json::CharReaderBuilder builder;
+    // comments are still accepted, but we never write them back out, so there's no point attaching them to the DOM
+    builder["collectComments"] = false;
 
     return builder;
 }
@@ -25,13 +26,15 @@ namespace AdaptiveCards
 {
 std::string ParseUtil::JsonToString(const Json::Value& json)
 {
-    const thread_local Json::StreamWriterBuilder builder = ::CreateJsonStreamWriter();
-    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+    std::string output;
+    AppendJsonToString(json, output);
+    return output;
+}
 
-    std::ostringstream outStream;
-    writer->write(json, &outStream);
-    outStream << std::endl;
-    return outStream.str();
+void ParseUtil::AppendJsonToString(const Json::Value& json, std::string& output)
+{
+    JsonWriter(output).WriteValue(json);
+    output.push_back('\n');
 }
 
 void ParseUtil::ThrowIfNotJsonObject(const Json::Value& json)
@@ -56,7 +59,26 @@ std::string ParseUtil::GetTypeAsString(const Json::Value& json)
         throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, ss.str());
     }
 
-    return json.get(typeKey, Json::Value()).asString();
+    return json[typeKey].asString();
+}
+
+std::string_view ParseUtil::GetTypeAsStringView(const Json::Value& json)
+{
+    const char typeKey[] = "type";
+
+    if (!json.isMember(typeKey))
+    {
+        throw AdaptiveCardParseException(
+            ErrorStatusCode::RequiredPropertyMissing, std::string("The JSON element is missing the following value: ") + typeKey);
+    }
+
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    if (!json[typeKey].getString(&begin, &end))
+    {
+        return {};
+    }
+    return std::string_view(begin, static_cast<std::size_t>(end - begin));
 }
 
 std::string ParseUtil::TryGetTypeAsString(const Json::Value& json)
@@ -87,7 +109,7 @@ std::string ParseUtil::TryGetString(const Json::Value& json, AdaptiveCardSchemaK
 std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -126,7 +148,7 @@ std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey
 std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -147,7 +169,7 @@ std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchema
 std::string ParseUtil::GetValueAsString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -189,7 +211,7 @@ bool ParseUtil::GetBool(const Json::Value& json, AdaptiveCardSchemaKey key, bool
 std::optional<bool> ParseUtil::GetOptionalBool(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -208,7 +230,7 @@ std::optional<bool> ParseUtil::GetOptionalBool(const Json::Value& json, Adaptive
 unsigned int ParseUtil::GetUInt(const Json::Value& json, AdaptiveCardSchemaKey key, unsigned int defaultValue, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -251,7 +273,7 @@ int ParseUtil::GetInt(const Json::Value& json, AdaptiveCardSchemaKey key, int de
 std::optional<int> ParseUtil::GetOptionalInt(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -270,7 +292,7 @@ std::optional<int> ParseUtil::GetOptionalInt(const Json::Value& json, AdaptiveCa
 std::optional<double> ParseUtil::GetOptionalDouble(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -317,14 +339,13 @@ void ParseUtil::ExpectKeyAndValueType(const Json::Value& json, const char* expec
             ErrorStatusCode::RequiredPropertyMissing, "The JSON element is missing the following key: " + std::string(expectedKey));
     }
 
-    auto value = json.get(expectedKey, Json::Value());
-    throwIfWrongType(value);
+    throwIfWrongType(json[expectedKey]);
 }
 
-Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+const Json::Value& ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto elementArray = json.get(propertyName, Json::Value());
+    const auto& elementArray = ExtractJsonValue(json, key);
 
     if (!elementArray.isNull() && !elementArray.isArray())
     {
@@ -345,7 +366,7 @@ Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey k
 
 std::vector<std::string> ParseUtil::GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto jsonArray = ParseUtil::GetArray(json, key, isRequired);
+    const auto& jsonArray = ParseUtil::GetArray(json, key, isRequired);
     std::vector<std::string> strings;
 
     strings.reserve(jsonArray.size());
@@ -358,10 +379,10 @@ std::vector<std::string> ParseUtil::GetStringArray(const Json::Value& json, Adap
     return strings;
 }
 
-Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
+Json::Value ParseUtil::GetJsonValueFromString(std::string_view jsonString)
 {
-    const thread_local Json::CharReaderBuilder readerBuilder;
-    std::unique_ptr<Json::CharReader> reader(readerBuilder.newCharReader());
+    // readers reset all of their state at the start of every parse, so each thread can keep reusing the same one
+    const thread_local std::unique_ptr<Json::CharReader> reader(::CreateJsonCharReader().newCharReader());
 
     Json::Value jsonValue;
     std::string errors;
@@ -375,23 +396,24 @@ Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
     return jsonValue;
 }
 
-Json::Value ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+// Look up the value mapped to key without copying it. Missing keys map to the shared null value so that callers
+// can hold on to the result by reference.
+const Json::Value& ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (isRequired && propertyValue.empty())
+    const Json::Value* propertyValue = json.find(propertyName.data(), propertyName.data() + propertyName.size());
+    if (isRequired && (propertyValue == nullptr || propertyValue->empty()))
     {
         throw AdaptiveCardParseException(
             ErrorStatusCode::RequiredPropertyMissing, "Could not extract required key: " + propertyName + ".");
     }
-    return propertyValue;
+    return (propertyValue != nullptr) ? *propertyValue : Json::Value::nullSingleton();
 }
 
 std::string ParseUtil::ToLowercase(std::string const& value)
 {
-    std::string new_value;
-    new_value.resize(value.size());
-    std::transform(value.begin(), value.end(), new_value.begin(), [](char c) { return std::tolower(c, std::locale()); });
+    std::string new_value(value);
+    std::transform(new_value.begin(), new_value.end(), new_value.begin(), AsciiToLower<char>);
     return new_value;
 }
 
@@ -403,46 +425,52 @@ std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContex
             ErrorStatusCode::InvalidPropertyValue, "Expected a Json object to extract Action element");
     }
 
-    // Get the element's type
-    std::string typeString = GetTypeAsString(json);
-
-    auto parser = context.actionParserRegistration->GetParser(typeString);
-    if (parser == nullptr)
+    // Built-in action types skip the registration; see BaseCardElement::ParseJsonObject
+    if (const auto knownType = ActionParserRegistration::TryGetKnownActionType(GetTypeAsStringView(json)))
     {
-        parser = context.actionParserRegistration->GetParser("UnknownAction");
+        return ActionElementParserWrapper::DeserializeWithParser(ActionParserRegistration::GetKnownParser(*knownType), context, json);
     }
 
-    // Parse it if it's allowed by the current parsers
-    if (parser != nullptr)
+    if (const auto parser = context.actionParserRegistration->GetParser(GetTypeAsString(json)))
     {
-        // Use the parser that maps to the type
         return parser->Deserialize(context, json);
     }
 
-    return nullptr;
+    return ActionElementParserWrapper::DeserializeWithParser(
+        ActionParserRegistration::GetKnownParser(ActionType::UnknownAction), context, json);
 }
 
 std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
     ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const DeferredJsonArray* deferredArray = context.GetDeferredArray(json, key);
+    const auto& elementArray = deferredArray ? Json::Value::nullSingleton() : GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<BaseActionElement>> elements;
+    const size_t elemSize = deferredArray ? deferredArray->GetItemCount() : elementArray.size();
 
-    if (elementArray.empty())
+    if (elemSize == 0)
     {
         return elements;
     }
 
-    elements.reserve(elementArray.size());
+    elements.reserve(elemSize);
 
-    for (const auto& curJsonValue : elementArray)
-    {
+    const auto parseAction = [&](const Json::Value& curJsonValue) {
         auto action = ParseUtil::GetActionFromJsonValue(context, curJsonValue);
         if (action != nullptr)
         {
             elements.push_back(action);
         }
+    };
+
+    if (deferredArray)
+    {
+        deferredArray->ForEachItem(context, std::string(), parseAction);
+    }
+    else
+    {
+        std::for_each(elementArray.begin(), elementArray.end(), parseAction);
     }
 
     return elements;
@@ -450,7 +478,7 @@ std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
 
 std::shared_ptr<BaseActionElement> ParseUtil::GetAction(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
+    const auto& selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
 
     if (!selectAction.empty())
     {
@@ -469,30 +497,19 @@ std::shared_ptr<BaseCardElement> ParseUtil::GetLabelFromJsonValue(ParseContext&
     }
 
     // Get the element's type
-    std::string typeString = ToLowercase(GetTypeAsString(json));
-
-    if ((typeString != ToLowercase(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextBlock))) &&
-        (typeString != ToLowercase(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::RichTextBlock))))
+    const auto knownType = ElementParserRegistration::TryGetKnownElementType(GetTypeAsStringView(json));
+    if (knownType != CardElementType::TextBlock && knownType != CardElementType::RichTextBlock)
     {
         throw AdaptiveCardParseException(
             ErrorStatusCode::InvalidPropertyValue, "Element type is not a string, TextBlock or RichTextBlock");
     }
 
-    auto parser = context.elementParserRegistration->GetParser(typeString);
-
-    // Parse it if it's allowed by the current parsers
-    if (parser != nullptr)
-    {
-        // Use the parser that maps to the type
-        return parser->Deserialize(context, json);
-    }
-
-    return nullptr;
+    return BaseCardElementParserWrapper::DeserializeWithParser(ElementParserRegistration::GetKnownParser(*knownType), context, json);
 }
 
 std::shared_ptr<BaseCardElement> ParseUtil::GetLabel(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key)
 {
-    auto label = ParseUtil::ExtractJsonValue(json, key);
+    const auto& label = ParseUtil::ExtractJsonValue(json, key);
 
     if (!label.empty())
     {
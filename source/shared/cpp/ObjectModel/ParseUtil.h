@@ -19,10 +19,17 @@ namespace ParseUtil
 {
     std::string JsonToString(const Json::Value& json);
 
+    // Same output as JsonToString, appended to the end of a caller-supplied buffer
+    void AppendJsonToString(const Json::Value& json, std::string& output);
+
     void ThrowIfNotJsonObject(const Json::Value& json);
 
     std::string GetTypeAsString(const Json::Value& json);
 
+    // Like GetTypeAsString, but views the type in place rather than copying it. Types that aren't strings come back
+    // empty, as there's nothing to view.
+    std::string_view GetTypeAsStringView(const Json::Value& json);
+
     std::string TryGetTypeAsString(const Json::Value& json);
 
     std::string GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
@@ -50,13 +57,17 @@ namespace ParseUtil
 
     std::optional<double> GetOptionalDouble(const Json::Value& json, AdaptiveCardSchemaKey key);
 
-    Json::Value GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+    // Returns a reference to the array stored under key in json (or to a shared null value if the key is absent).
+    // The reference is only valid for as long as json is.
+    const Json::Value& GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     std::vector<std::string> GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
-    Json::Value GetJsonValueFromString(const std::string& jsonString);
+    Json::Value GetJsonValueFromString(std::string_view jsonString);
 
-    Json::Value ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
+    // Returns a reference to the value stored under key in jsonRoot (or to a shared null value if the key is
+    // absent). The reference is only valid for as long as jsonRoot is.
+    const Json::Value& ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     template <typename T, typename Fn>
     std::optional<T> GetOptionalEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, Fn enumConverter);
@@ -127,8 +138,7 @@ std::optional<T> ParseUtil::GetOptionalEnumValue(const Json::Value& json, Adapti
     std::string propertyValueStr = "";
     try
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto const& propertyValue = json.get(propertyName, Json::Value());
+        auto const& propertyValue = ExtractJsonValue(json, key);
         if (propertyValue.empty())
         {
             return std::nullopt;
@@ -141,6 +151,9 @@ std::optional<T> ParseUtil::GetOptionalEnumValue(const Json::Value& json, Adapti
         }
 
         propertyValueStr = propertyValue.asString();
+
+        // enumConverter may either throw std::out_of_range or (like the generated XTryFromString functions) return
+        // std::nullopt for a value it doesn't recognize. The latter keeps unrecognized values off the exception path.
         return enumConverter(propertyValueStr);
     }
     catch (const std::out_of_range&)
@@ -205,25 +218,34 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollectionOfSingleType(
     const std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value&)>& deserializer,
     bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const DeferredJsonArray* deferredArray = context.GetDeferredArray(json, key);
+    const auto& elementArray = deferredArray ? Json::Value::nullSingleton() : GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<T>> elements;
-    if (elementArray.empty())
+    const size_t elemSize = deferredArray ? deferredArray->GetItemCount() : elementArray.size();
+    if (elemSize == 0)
     {
         return elements;
     }
 
-    elements.reserve(elementArray.size());
+    elements.reserve(elemSize);
 
     // Deserialize every element in the array
-    for (const Json::Value& curJsonValue : elementArray)
-    {
-        // Parse the element
+    const auto parseElement = [&](const Json::Value& curJsonValue) {
         auto el = deserializer(context, curJsonValue);
         if (el != nullptr)
         {
             elements.push_back(el);
         }
+    };
+
+    if (deferredArray)
+    {
+        deferredArray->ForEachItem(context, std::string(), parseElement);
+    }
+    else
+    {
+        std::for_each(elementArray.begin(), elementArray.end(), parseElement);
     }
 
     return elements;
@@ -239,7 +261,7 @@ T ParseUtil::ExtractJsonValueAndMergeWithDefault(
     T result = defaultValue;
     try
     {
-        auto jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
+        const auto& jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
         if (!jsonObject.empty())
         {
             result = deserializer(jsonObject, defaultValue);
@@ -267,22 +289,22 @@ template <typename T>
 std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
     bool isTopToBottomContainer, ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired, const std::string& impliedType)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const DeferredJsonArray* deferredArray = context.GetDeferredArray(json, key);
+    const auto& elementArray = deferredArray ? Json::Value::nullSingleton() : GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<T>> elements;
-    if (elementArray.empty())
+    const size_t elemSize = deferredArray ? deferredArray->GetItemCount() : elementArray.size();
+    if (elemSize == 0)
     {
         return elements;
     }
 
-    const size_t elemSize = elementArray.size();
     elements.reserve(elemSize);
 
     const ContainerBleedDirection previousBleedState = context.GetBleedDirection();
 
     size_t currentIndex = 0;
-    for (auto& curJsonValue : elementArray)
-    {
+    const auto parseElement = [&](const Json::Value& curJsonValue) {
         ContainerBleedDirection currentBleedState = previousBleedState;
 
         if (currentIndex != 0)
@@ -303,28 +325,44 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
 
         context.PushBleedDirection(currentBleedState);
 
-        // If all items in this collection have the same implied type (i.e. Columns), verify
-        // that if set it is set correctly and set it if it isn't
+        // If all items in this collection have the same implied type (i.e. Columns), verify that if set it is set
+        // correctly. Elements are parsed in place; only an element that omits its type is copied so that the
+        // implied type can be filled in (items from a deferred array come with it filled in already).
+        const Json::Value* elementJson = &curJsonValue;
+        Json::Value typedJsonValue;
         if (!impliedType.empty())
         {
-            const std::string typeString = ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type, impliedType, false);
-            if (typeString.compare(impliedType) != 0)
+            const std::string typeString = ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type);
+            if (typeString.empty())
+            {
+                typedJsonValue = curJsonValue;
+                typedJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = impliedType;
+                elementJson = &typedJsonValue;
+            }
+            else if (typeString.compare(impliedType) != 0)
             {
                 throw AdaptiveCardParseException(
                     ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + typeString);
             }
-
-            curJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = typeString;
         }
 
         std::shared_ptr<BaseElement> curElement;
-        ParseJsonObject<T>(context, curJsonValue, curElement);
+        ParseJsonObject<T>(context, *elementJson, curElement);
         elements.push_back(std::static_pointer_cast<T>(curElement));
 
         // restores the parent's bleed state
         context.PopBleedDirection();
 
         currentIndex++;
+    };
+
+    if (deferredArray)
+    {
+        deferredArray->ForEachItem(context, impliedType, parseElement);
+    }
+    else
+    {
+        std::for_each(elementArray.begin(), elementArray.end(), parseElement);
     }
 
     return elements;
@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ResolvedHostConfig.h"
+
+namespace AdaptiveCards
+{
+namespace
+{
+    // Values outside the enum get what HostConfig gives them, which is its Default
+    template <typename T>
+    std::size_t IndexOf(T value, std::size_t count)
+    {
+        const auto index = static_cast<std::size_t>(value);
+        return (index < count) ? index : static_cast<std::size_t>(T::Default);
+    }
+} // namespace
+
+ResolvedHostConfig::Color ResolvedHostConfig::MakeColor(std::string value)
+{
+    const auto argb = ArgbColor::FromString(value);
+    return Color{std::move(value), argb};
+}
+
+ResolvedHostConfig::ResolvedHostConfig(const HostConfig& hostConfig)
+{
+    // fill every table through HostConfig's own lookups so the two can't disagree. Colors are decoded from the strings
+    // those lookups return, and so always match them.
+    for (std::size_t fontType = 0; fontType < c_fontTypeCount; ++fontType)
+    {
+        m_fontFamilies[fontType] = hostConfig.GetFontFamily(static_cast<FontType>(fontType));
+        for (std::size_t size = 0; size < c_textSizeCount; ++size)
+        {
+            m_fontSizes[fontType][size] = hostConfig.GetFontSize(static_cast<FontType>(fontType), static_cast<TextSize>(size));
+        }
+        for (std::size_t weight = 0; weight < c_textWeightCount; ++weight)
+        {
+            m_fontWeights[fontType][weight] =
+                hostConfig.GetFontWeight(static_cast<FontType>(fontType), static_cast<TextWeight>(weight));
+        }
+    }
+
+    for (std::size_t styleIndex = 0; styleIndex < c_containerStyleCount; ++styleIndex)
+    {
+        const auto style = static_cast<ContainerStyle>(styleIndex);
+        auto& styleColors = m_containerStyles[styleIndex];
+        styleColors.background = MakeColor(hostConfig.GetBackgroundColor(style));
+        styleColors.border = MakeColor(hostConfig.GetBorderColor(style));
+        styleColors.borderThickness = hostConfig.GetBorderThickness(style);
+
+        for (std::size_t colorIndex = 0; colorIndex < c_foregroundColorCount; ++colorIndex)
+        {
+            const auto color = static_cast<ForegroundColor>(colorIndex);
+            for (const bool isSubtle : {false, true})
+            {
+                styleColors.foreground[colorIndex][isSubtle] = MakeColor(hostConfig.GetForegroundColor(style, color, isSubtle));
+                styleColors.highlight[colorIndex][isSubtle] = MakeColor(hostConfig.GetHighlightColor(style, color, isSubtle));
+            }
+        }
+    }
+}
+
+std::string_view ResolvedHostConfig::GetFontFamily(FontType fontType) const
+{
+    return m_fontFamilies[IndexOf(fontType, c_fontTypeCount)];
+}
+
+unsigned int ResolvedHostConfig::GetFontSize(FontType fontType, TextSize size) const
+{
+    return m_fontSizes[IndexOf(fontType, c_fontTypeCount)][IndexOf(size, c_textSizeCount)];
+}
+
+unsigned int ResolvedHostConfig::GetFontWeight(FontType fontType, TextWeight weight) const
+{
+    return m_fontWeights[IndexOf(fontType, c_fontTypeCount)][IndexOf(weight, c_textWeightCount)];
+}
+
+const ResolvedHostConfig::Color& ResolvedHostConfig::GetForeground(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    return m_containerStyles[IndexOf(style, c_containerStyleCount)].foreground[IndexOf(color, c_foregroundColorCount)][isSubtle];
+}
+
+const ResolvedHostConfig::Color& ResolvedHostConfig::GetHighlight(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    return m_containerStyles[IndexOf(style, c_containerStyleCount)].highlight[IndexOf(color, c_foregroundColorCount)][isSubtle];
+}
+
+std::string_view ResolvedHostConfig::GetBackgroundColor(ContainerStyle style) const
+{
+    return m_containerStyles[IndexOf(style, c_containerStyleCount)].background.value;
+}
+
+std::string_view ResolvedHostConfig::GetForegroundColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    return GetForeground(style, color, isSubtle).value;
+}
+
+std::string_view ResolvedHostConfig::GetHighlightColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    return GetHighlight(style, color, isSubtle).value;
+}
+
+std::string_view ResolvedHostConfig::GetBorderColor(ContainerStyle style) const
+{
+    return m_containerStyles[IndexOf(style, c_containerStyleCount)].border.value;
+}
+
+unsigned int ResolvedHostConfig::GetBorderThickness(ContainerStyle style) const
+{
+    return m_containerStyles[IndexOf(style, c_containerStyleCount)].borderThickness;
+}
+
+ArgbColor ResolvedHostConfig::GetBackgroundColorArgb(ContainerStyle style) const
+{
+    return m_containerStyles[IndexOf(style, c_containerStyleCount)].background.argb;
+}
+
+ArgbColor ResolvedHostConfig::GetForegroundColorArgb(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    return GetForeground(style, color, isSubtle).argb;
+}
+
+ArgbColor ResolvedHostConfig::GetHighlightColorArgb(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    return GetHighlight(style, color, isSubtle).argb;
+}
+
+ArgbColor ResolvedHostConfig::GetBorderColorArgb(ContainerStyle style) const
+{
+    return m_containerStyles[IndexOf(style, c_containerStyleCount)].border.argb;
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "HostConfig.h"
+
+namespace AdaptiveCards
+{
+// The font and color lookups of a HostConfig, worked out once and kept in flat tables for renderers to query per text
+// run. HostConfig answers the same questions by walking fallbacks on every call (a font size comes from the font type,
+// then the default font type, then the deprecated fontSizes, then the built-in default) and returns copies of its
+// strings; here each answer is an array index, and colors come back as views of strings this object owns along with
+// their ArgbColor values. A color that isn't #RRGGBB or #AARRGGBB has an ArgbColor of transparent black.
+//
+// A ResolvedHostConfig is a snapshot of the HostConfig it was built from and doesn't see later changes to it; see
+// HostConfig::GetResolved.
+class ResolvedHostConfig
+{
+public:
+    explicit ResolvedHostConfig(const HostConfig& hostConfig);
+
+    std::string_view GetFontFamily(FontType fontType) const;
+    unsigned int GetFontSize(FontType fontType, TextSize size) const;
+    unsigned int GetFontWeight(FontType fontType, TextWeight weight) const;
+
+    std::string_view GetBackgroundColor(ContainerStyle style) const;
+    std::string_view GetForegroundColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+    std::string_view GetHighlightColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+    std::string_view GetBorderColor(ContainerStyle style) const;
+    unsigned int GetBorderThickness(ContainerStyle style) const;
+
+    ArgbColor GetBackgroundColorArgb(ContainerStyle style) const;
+    ArgbColor GetForegroundColorArgb(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+    ArgbColor GetHighlightColorArgb(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+    ArgbColor GetBorderColorArgb(ContainerStyle style) const;
+
+private:
+    static constexpr std::size_t c_fontTypeCount = static_cast<std::size_t>(FontType::Monospace) + 1;
+    static constexpr std::size_t c_textSizeCount = static_cast<std::size_t>(TextSize::ExtraLarge) + 1;
+    static constexpr std::size_t c_textWeightCount = static_cast<std::size_t>(TextWeight::Bolder) + 1;
+    static constexpr std::size_t c_containerStyleCount = static_cast<std::size_t>(ContainerStyle::Accent) + 1;
+    static constexpr std::size_t c_foregroundColorCount = static_cast<std::size_t>(ForegroundColor::Attention) + 1;
+
+    struct Color
+    {
+        std::string value;
+        ArgbColor argb;
+    };
+
+    struct ContainerStyleColors
+    {
+        Color background;
+        Color border;
+        unsigned int borderThickness;
+        // indexed by ForegroundColor, then by isSubtle
+        std::array<std::array<Color, 2>, c_foregroundColorCount> foreground;
+        std::array<std::array<Color, 2>, c_foregroundColorCount> highlight;
+    };
+
+    static Color MakeColor(std::string value);
+    const Color& GetForeground(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+    const Color& GetHighlight(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+
+    std::array<std::string, c_fontTypeCount> m_fontFamilies;
+    std::array<std::array<unsigned int, c_textSizeCount>, c_fontTypeCount> m_fontSizes;
+    std::array<std::array<unsigned int, c_textWeightCount>, c_fontTypeCount> m_fontWeights;
+    std::array<ContainerStyleColors, c_containerStyleCount> m_containerStyles;
+};
+} // namespace AdaptiveCards
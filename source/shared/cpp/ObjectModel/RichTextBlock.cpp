@@ -2,7 +2,6 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include <iomanip>
-#include <regex>
 #include <iostream>
 #include <codecvt>
 #include "ParseContext.h"
@@ -18,9 +17,9 @@ RichTextBlock::RichTextBlock() : BaseCardElement(CardElementType::RichTextBlock)
     PopulateKnownPropertiesSet();
 }
 
-Json::Value RichTextBlock::SerializeToJsonValue() const
+void RichTextBlock::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseCardElement::SerializeToJsonValue();
+    BaseCardElement::SerializeProperties(root);
 
     if (m_hAlignment.has_value())
     {
@@ -34,8 +33,11 @@ Json::Value RichTextBlock::SerializeToJsonValue() const
     {
         root[inlinesPropertyName].append(currentInline->SerializeToJsonValue());
     }
+}
 
-    return root;
+void RichTextBlock::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::optional<HorizontalAlignment> RichTextBlock::GetHorizontalAlignment() const
@@ -64,7 +66,7 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::Deserialize(ParseContext&
 
     std::shared_ptr<RichTextBlock> richTextBlock = BaseCardElement::Deserialize<RichTextBlock>(context, json);
     richTextBlock->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     auto inlines = ParseUtil::GetElementCollectionOfSingleType<Inline>(
         context, json, AdaptiveCardSchemaKey::Inlines, Inline::Deserialize, false);
@@ -80,7 +82,8 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::DeserializeFromString(Pars
 
 void RichTextBlock::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Inlines)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::HorizontalAlignment,
+         AdaptiveCardSchemaKey::Inlines});
+    m_knownProperties = &knownProperties;
 }
@@ -22,14 +22,16 @@ public:
     RichTextBlock& operator=(RichTextBlock&&) = default;
     ~RichTextBlock() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::optional<HorizontalAlignment> GetHorizontalAlignment() const;
     void SetHorizontalAlignment(const std::optional<HorizontalAlignment> value);
 
     std::vector<std::shared_ptr<Inline>>& GetInlines();
     const std::vector<std::shared_ptr<Inline>>& GetInlines() const;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
+
 private:
     std::optional<HorizontalAlignment> m_hAlignment;
     void PopulateKnownPropertiesSet();
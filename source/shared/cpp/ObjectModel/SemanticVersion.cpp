@@ -19,49 +19,31 @@ SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor
     // "1."
     // "F"
 
-    bool versionValid = false;
-#pragma warning(push)
-#pragma warning(disable : 26426)
-    // disable spurious warning (Global initializer calls a non-constexpr function.) -- this isn't global
-    static const std::regex versionMatch(R"regex(^([\d]+)(?:\.([\d]+))?(?:\.([\d]+))?(?:\.([\d]+))?$)regex");
-#pragma warning(pop)
-    std::smatch subMatches;
-    if (std::regex_match(version, subMatches, versionMatch))
+    // scan up to four dot-separated runs of digits, in place
+    unsigned int* const parts[] = {&_major, &_minor, &_build, &_revision};
+    const char* cursor = version.data();
+    const char* const end = version.data() + version.size();
+    bool versionValid = !version.empty();
+    for (size_t i = 0; versionValid && i < std::size(parts) && cursor != end; ++i)
     {
-        versionValid = true;
-        // subMatches[0] contains the entire string, so no need to refer to it here
-
-        try
+        if (i != 0 && *cursor++ != '.')
         {
-            // subMatches[1] contains the major version
-            if (subMatches[1].matched)
-            {
-                _major = std::stoi(subMatches[1]);
-            }
-
-            if (subMatches[2].matched)
-            {
-                // subMatches[2] contains the minor version
-                _minor = std::stoi(subMatches[2]);
-            }
-
-            if (subMatches[3].matched)
-            {
-                // subMatches[3] contains the build version
-                _build = std::stoi(subMatches[3]);
-            }
-
-            if (subMatches[4].matched)
-            {
-                // subMatches[4] contains the revision
-                _revision = std::stoi(subMatches[4]);
-            }
+            versionValid = false;
+            break;
         }
-        catch (const std::out_of_range&)
+
+        const char* digitsEnd = cursor;
+        while (digitsEnd != end && *digitsEnd >= '0' && *digitsEnd <= '9')
         {
-            versionValid = false;
+            ++digitsEnd;
         }
+
+        int part = 0;
+        versionValid = (digitsEnd != cursor) && (std::from_chars(cursor, digitsEnd, part).ec == std::errc{});
+        *parts[i] = static_cast<unsigned int>(part);
+        cursor = digitsEnd;
     }
+    versionValid = versionValid && (cursor == end);
 
     if (!versionValid)
     {
@@ -9,6 +9,8 @@
 #include "AdaptiveCardParseWarning.h"
 #include "SemanticVersion.h"
 #include "ParseContext.h"
+#include "ParseThreadPool.h"
+#include "StreamingCardParser.h"
 #include "BackgroundImage.h"
 
 using namespace AdaptiveCards;
@@ -64,7 +66,6 @@ AdaptiveCard::AdaptiveCard(
     m_language(language), m_verticalContentAlignment(verticalContentAlignment), m_height(height),
     m_minHeight(minHeight), m_internalId{InternalId::Next()}, m_additionalProperties{}
 {
-    PopulateKnownPropertiesSet();
 }
 
 AdaptiveCard::AdaptiveCard(
@@ -116,7 +117,6 @@ AdaptiveCard::AdaptiveCard(
     m_verticalContentAlignment(verticalContentAlignment), m_height(height),
     m_minHeight(minHeight), m_internalId{InternalId::Next()}, m_body(body), m_actions(actions), m_additionalProperties{}
 {
-    PopulateKnownPropertiesSet();
 }
 
 #ifdef __ANDROID__
@@ -216,9 +216,9 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
                 speak = fallbackText;
             }
 
-            context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(
+            context.warnings.push_back(context.MakeShared<AdaptiveCardParseWarning>(
                 AdaptiveCards::WarningStatusCode::UnsupportedSchemaVersion, "Schema version not supported"));
-            return std::make_shared<ParseResult>(MakeFallbackTextCard(fallbackText, language, speak), context.warnings);
+            return context.MakeShared<ParseResult>(MakeFallbackTextCard(fallbackText, language, speak), context.warnings);
         }
     }
 
@@ -229,13 +229,13 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         context, json, AdaptiveCardSchemaKey::Authentication, Authentication::Deserialize);
 
     ContainerStyle style =
-        ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString);
+        ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString);
     context.SetParentalContainerStyle(style);
 
     VerticalContentAlignment verticalContentAlignment = ParseUtil::GetEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignment::Top, VerticalContentAlignmentFromString);
+        json, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignment::Top, VerticalContentAlignmentTryFromString);
     HeightType height =
-        ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeFromString);
+        ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeTryFromString);
 
     unsigned int minHeight =
         ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MinHeight), &context.warnings).value_or(0);
@@ -247,7 +247,7 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
 
     EnsureShowCardVersions(actions, version);
 
-    auto result = std::make_shared<AdaptiveCard>(
+    auto result = context.MakeShared<AdaptiveCard>(
         version, fallbackText, backgroundImage, refresh, authentication, style, speak, language, verticalContentAlignment, height, minHeight, body, actions);
     result->SetLanguage(language);
     result->SetRtl(ParseUtil::GetOptionalBool(json, AdaptiveCardSchemaKey::Rtl));
@@ -257,9 +257,9 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
 
     Json::Value additionalProperties;
     HandleUnknownProperties(json, result->GetKnownProperties(), additionalProperties);
-    result->SetAdditionalProperties(additionalProperties);
+    result->SetAdditionalProperties(std::move(additionalProperties));
 
-    return std::make_shared<ParseResult>(result, context.warnings);
+    return context.MakeShared<ParseResult>(result, context.warnings);
 }
 
 #ifdef __ANDROID__
@@ -283,9 +283,73 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(const std::stri
     return AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(jsonString), rendererVersion, context);
 }
 
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringStreaming(
+    const std::string& jsonString, const std::string& rendererVersion, ParseContext& context)
+{
+    std::shared_ptr<ParseResult> parseResult;
+    StreamingCardParser::ParseCard(context, jsonString, [&](const Json::Value& json) {
+        parseResult = AdaptiveCard::Deserialize(json, rendererVersion, context);
+    });
+    return parseResult;
+}
+
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringStreaming(const std::string& jsonString, const std::string& rendererVersion)
+{
+    ParseContext context;
+    return AdaptiveCard::DeserializeFromStringStreaming(jsonString, rendererVersion, context);
+}
+
+std::vector<BatchParseResult> AdaptiveCard::DeserializeFromStrings(
+    const std::vector<std::string>& jsonStrings,
+    const std::string& rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementRegistration,
+    std::shared_ptr<ActionParserRegistration> actionRegistration,
+    ParseThreadPool& pool)
+{
+    // create the default registrations up front so that every card shares them rather than building its own
+    if (!elementRegistration)
+    {
+        elementRegistration = std::make_shared<ElementParserRegistration>();
+    }
+    if (!actionRegistration)
+    {
+        actionRegistration = std::make_shared<ActionParserRegistration>();
+    }
+
+    std::vector<BatchParseResult> results(jsonStrings.size());
+    pool.ParallelFor(jsonStrings.size(), [&](std::size_t i) {
+        try
+        {
+            ParseContext context(elementRegistration, actionRegistration);
+            results[i].parseResult = AdaptiveCard::DeserializeFromString(jsonStrings[i], rendererVersion, context);
+        }
+        catch (...)
+        {
+            results[i].error = std::current_exception();
+        }
+    });
+    return results;
+}
+
+std::vector<BatchParseResult> AdaptiveCard::DeserializeFromStrings(
+    const std::vector<std::string>& jsonStrings,
+    const std::string& rendererVersion,
+    std::shared_ptr<ElementParserRegistration> elementRegistration,
+    std::shared_ptr<ActionParserRegistration> actionRegistration)
+{
+    return DeserializeFromStrings(
+        jsonStrings, rendererVersion, std::move(elementRegistration), std::move(actionRegistration), ParseThreadPool::GetDefault());
+}
+
 Json::Value AdaptiveCard::SerializeToJsonValue() const
 {
-    Json::Value root = GetAdditionalProperties();
+    JsonMembers root(m_additionalProperties);
+    SerializeProperties(root);
+    return root.ToJsonValue();
+}
+
+void AdaptiveCard::SerializeProperties(JsonMembers& root) const
+{
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = CardElementTypeToString(CardElementType::AdaptiveCard);
 
     if (!m_version.empty())
@@ -347,21 +411,8 @@ Json::Value AdaptiveCard::SerializeToJsonValue() const
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height)] = HeightTypeToString(GetHeight());
     }
 
-    const std::string& bodyPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body);
-    root[bodyPropertyName] = Json::Value(Json::arrayValue);
-    for (const auto& cardElement : GetBody())
-    {
-        root[bodyPropertyName].append(cardElement->SerializeToJsonValue());
-    }
-
-    const std::string& actionsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions);
-    root[actionsPropertyName] = Json::Value(Json::arrayValue);
-    for (const auto& action : GetActions())
-    {
-        root[actionsPropertyName].append(action->SerializeToJsonValue());
-    }
-
-    return root;
+    root.SetArray(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body), GetBody());
+    root.SetArray(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions), GetActions());
 }
 
 #ifdef __ANDROID__
@@ -386,7 +437,18 @@ std::shared_ptr<AdaptiveCard> AdaptiveCard::MakeFallbackTextCard(
 
 std::string AdaptiveCard::Serialize() const
 {
-    return ParseUtil::JsonToString(SerializeToJsonValue());
+    std::string output;
+    JsonWriter writer(output);
+    Serialize(writer);
+    output.push_back('\n');
+    return output;
+}
+
+void AdaptiveCard::Serialize(JsonWriter& writer) const
+{
+    JsonMembers root(m_additionalProperties);
+    SerializeProperties(root);
+    root.Write(writer);
 }
 
 std::string AdaptiveCard::GetVersion() const
@@ -394,6 +456,11 @@ std::string AdaptiveCard::GetVersion() const
     return m_version;
 }
 
+void AdaptiveCard::SetVersion(std::string&& value)
+{
+    m_version = std::move(value);
+}
+
 void AdaptiveCard::SetVersion(const std::string& value)
 {
     m_version = value;
@@ -404,6 +471,11 @@ std::string AdaptiveCard::GetFallbackText() const
     return m_fallbackText;
 }
 
+void AdaptiveCard::SetFallbackText(std::string&& value)
+{
+    m_fallbackText = std::move(value);
+}
+
 void AdaptiveCard::SetFallbackText(const std::string& value)
 {
     m_fallbackText = value;
@@ -444,6 +516,11 @@ std::string AdaptiveCard::GetSpeak() const
     return m_speak;
 }
 
+void AdaptiveCard::SetSpeak(std::string&& value)
+{
+    m_speak = std::move(value);
+}
+
 void AdaptiveCard::SetSpeak(const std::string& value)
 {
     m_speak = value;
@@ -545,30 +622,26 @@ void AdaptiveCard::SetRtl(const std::optional<bool>& value)
     m_rtl = value;
 }
 
-void AdaptiveCard::PopulateKnownPropertiesSet()
-{
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Refresh),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Authentication),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Schema)});
-}
-
 const std::unordered_set<std::string>& AdaptiveCard::GetKnownProperties() const
 {
-    return m_knownProperties;
+    static const std::unordered_set<std::string> knownProperties{
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Refresh),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Authentication),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
+        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Schema)};
+    return knownProperties;
 }
 
 const Json::Value& AdaptiveCard::GetAdditionalProperties() const
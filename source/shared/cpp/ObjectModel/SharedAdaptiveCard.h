@@ -13,6 +13,7 @@ namespace AdaptiveCards
 {
 class Container;
 class BackgroundImage;
+class ParseThreadPool;
 
 class AdaptiveCard
 {
@@ -83,8 +84,10 @@ public:
         std::vector<std::shared_ptr<BaseActionElement>>& actions);
 
     std::string GetVersion() const;
+    void SetVersion(std::string&& value);
     void SetVersion(const std::string& value);
     std::string GetFallbackText() const;
+    void SetFallbackText(std::string&& value);
     void SetFallbackText(const std::string& value);
     std::shared_ptr<BackgroundImage> GetBackgroundImage() const;
     void SetBackgroundImage(const std::shared_ptr<BackgroundImage> value);
@@ -93,6 +96,7 @@ public:
     std::shared_ptr<Authentication> GetAuthentication() const;
     void SetAuthentication(const std::shared_ptr<Authentication> value);
     std::string GetSpeak() const;
+    void SetSpeak(std::string&& value);
     void SetSpeak(const std::string& value);
     ContainerStyle GetStyle() const;
     void SetStyle(const ContainerStyle value);
@@ -152,8 +156,36 @@ public:
         const std::string& fallbackText, const std::string& language, const std::string& speak);
 
 #endif // __ANDROID__
+
+    // Parses the same cards as DeserializeFromString, with the same results, without ever building a Json::Value of the
+    // whole card. Each element and action is read from jsonString when its parser gets to it, so the only json held at
+    // any time is that of the element being parsed and of the elements holding it, each less its children (see
+    // StreamingCardParser.h).
+    static std::shared_ptr<ParseResult> DeserializeFromStringStreaming(
+        const std::string& jsonString, const std::string& rendererVersion, ParseContext& context);
+    static std::shared_ptr<ParseResult> DeserializeFromStringStreaming(const std::string& jsonString, const std::string& rendererVersion);
+
+    // Parses each of jsonStrings on the threads of pool and returns what came of each card in input order, so one card
+    // that fails to parse doesn't cost the others their results. Every card gets its own ParseContext, but all of them
+    // share the given registrations (a default one for each that is null), which must not be modified until this call
+    // returns.
+    static std::vector<BatchParseResult> DeserializeFromStrings(
+        const std::vector<std::string>& jsonStrings,
+        const std::string& rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementRegistration,
+        std::shared_ptr<ActionParserRegistration> actionRegistration,
+        ParseThreadPool& pool);
+    // The same, on ParseThreadPool::GetDefault()
+    static std::vector<BatchParseResult> DeserializeFromStrings(
+        const std::vector<std::string>& jsonStrings,
+        const std::string& rendererVersion,
+        std::shared_ptr<ElementParserRegistration> elementRegistration = nullptr,
+        std::shared_ptr<ActionParserRegistration> actionRegistration = nullptr);
+
     Json::Value SerializeToJsonValue() const;
     std::string Serialize() const;
+    // Writes out the json that SerializeToJsonValue returns, without building it
+    void Serialize(JsonWriter& writer) const;
 
     const InternalId GetInternalId() const
     {
@@ -161,8 +193,9 @@ public:
     }
 
 private:
+    void SerializeProperties(JsonMembers& root) const;
+
     static void _ValidateLanguage(const std::string& language, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings);
-    void PopulateKnownPropertiesSet();
 
     std::string m_version;
     std::string m_fallbackText;
@@ -177,7 +210,6 @@ private:
     unsigned int m_minHeight;
     std::optional<bool> m_rtl;
     InternalId m_internalId;
-    std::unordered_set<std::string> m_knownProperties;
     Json::Value m_additionalProperties;
 
     std::vector<std::shared_ptr<BaseCardElement>> m_body;
@@ -13,13 +13,16 @@ ShowCardAction::ShowCardAction() : BaseActionElement(ActionType::ShowCard)
     PopulateKnownPropertiesSet();
 }
 
-Json::Value ShowCardAction::SerializeToJsonValue() const
+void ShowCardAction::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseActionElement::SerializeToJsonValue();
+    BaseActionElement::SerializeProperties(root);
 
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)] = GetCard()->SerializeToJsonValue();
+    root.SetObject(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card), *GetCard());
+}
 
-    return root;
+void ShowCardAction::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::shared_ptr<AdaptiveCard> ShowCardAction::GetCard() const
@@ -45,9 +48,7 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::Deserialize(ParseContex
 {
     std::shared_ptr<ShowCardAction> showCardAction = BaseActionElement::Deserialize<ShowCardAction>(context, json);
 
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card);
-
-    auto parseResult = AdaptiveCard::Deserialize(json.get(propertyName, Json::Value()), "", context);
+    auto parseResult = AdaptiveCard::Deserialize(ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Card), "", context);
 
     auto showCardWarnings = parseResult->GetWarnings();
     auto warningsEnd = context.warnings.insert(context.warnings.end(), showCardWarnings.begin(), showCardWarnings.end());
@@ -64,7 +65,8 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::DeserializeFromString(P
 
 void ShowCardAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)});
+    static const auto knownProperties = ExtendKnownProperties({AdaptiveCardSchemaKey::Card});
+    m_knownProperties = &knownProperties;
 }
 
 void ShowCardAction::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -19,8 +19,6 @@ public:
     ShowCardAction& operator=(ShowCardAction&&) = default;
     ~ShowCardAction() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::shared_ptr<AdaptiveCards::AdaptiveCard> GetCard() const;
     void SetCard(const std::shared_ptr<AdaptiveCards::AdaptiveCard>);
 
@@ -28,6 +26,10 @@ public:
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
@@ -0,0 +1,289 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "StreamingCardParser.h"
+#include "ElementParserRegistration.h"
+#include "JsonPullReader.h"
+#include "ParseUtil.h"
+
+namespace AdaptiveCards
+{
+namespace
+{
+    // what an object read from the text is, which decides which of its arrays its parser reads through ParseUtil's
+    // collection parsers, and so can be deferred
+    enum class ObjectKind
+    {
+        Card,
+        Element,
+        Action,
+        TableRow,
+        TableCell
+    };
+
+    // an array, not yet read, under one of the keys that might hold elements or actions
+    struct CollectionMember
+    {
+        AdaptiveCardSchemaKey key;
+        std::string_view text;
+        std::vector<std::string_view> items;
+    };
+
+    class StreamedArray final : public DeferredJsonArray
+    {
+    public:
+        StreamedArray(const JsonPullReader& reader, std::vector<std::string_view> items, ObjectKind itemKind) :
+            m_reader(reader), m_items(std::move(items)), m_itemKind(itemKind)
+        {
+        }
+
+        std::size_t GetItemCount() const override
+        {
+            return m_items.size();
+        }
+
+        void ForEachItem(ParseContext& context, const std::string& impliedType, const ItemCallback& onItem) const override;
+
+    private:
+        const JsonPullReader& m_reader;
+        std::vector<std::string_view> m_items;
+        ObjectKind m_itemKind;
+    };
+
+    std::optional<AdaptiveCardSchemaKey> TryGetCollectionKey(std::string_view name)
+    {
+        static constexpr std::array<AdaptiveCardSchemaKey, 6> collectionKeys{
+            AdaptiveCardSchemaKey::Actions,
+            AdaptiveCardSchemaKey::Body,
+            AdaptiveCardSchemaKey::Cells,
+            AdaptiveCardSchemaKey::Columns,
+            AdaptiveCardSchemaKey::Items,
+            AdaptiveCardSchemaKey::Rows};
+
+        // jsoncpp's member names are case sensitive, so unlike the schema key lookup, this has to be too
+        for (const auto key : collectionKeys)
+        {
+            if (name == AdaptiveCardSchemaKeyToString(key))
+            {
+                return key;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // The kind of the items under key in object, if object's parser reads them with one of ParseUtil's collection
+    // parsers -- which are the only places that look for deferred arrays
+    std::optional<ObjectKind> TryGetDeferredItemKind(ObjectKind kind, const Json::Value& object, AdaptiveCardSchemaKey key)
+    {
+        const auto itemsUnder = [key](AdaptiveCardSchemaKey itemsKey, ObjectKind itemKind) {
+            return (key == itemsKey) ? std::optional<ObjectKind>(itemKind) : std::nullopt;
+        };
+
+        switch (kind)
+        {
+        case ObjectKind::Card:
+            if (key == AdaptiveCardSchemaKey::Body)
+            {
+                return ObjectKind::Element;
+            }
+            return itemsUnder(AdaptiveCardSchemaKey::Actions, ObjectKind::Action);
+
+        case ObjectKind::Element:
+            // custom parsers can't take over any of these types, so their parsers are known
+            if (const auto type = ElementParserRegistration::TryGetKnownElementType(ParseUtil::GetTypeAsStringView(object)))
+            {
+                switch (*type)
+                {
+                case CardElementType::Container:
+                case CardElementType::Column:
+                    return itemsUnder(AdaptiveCardSchemaKey::Items, ObjectKind::Element);
+                case CardElementType::ColumnSet:
+                    return itemsUnder(AdaptiveCardSchemaKey::Columns, ObjectKind::Element);
+                case CardElementType::ActionSet:
+                    return itemsUnder(AdaptiveCardSchemaKey::Actions, ObjectKind::Action);
+                case CardElementType::Table:
+                    return itemsUnder(AdaptiveCardSchemaKey::Rows, ObjectKind::TableRow);
+                default:
+                    break;
+                }
+            }
+            break;
+
+        case ObjectKind::TableRow:
+            return itemsUnder(AdaptiveCardSchemaKey::Cells, ObjectKind::TableCell);
+
+        case ObjectKind::TableCell:
+            return itemsUnder(AdaptiveCardSchemaKey::Items, ObjectKind::Element);
+
+        case ObjectKind::Action:
+            break;
+        }
+        return std::nullopt;
+    }
+
+    std::string DecodeName(std::string_view name)
+    {
+        if (name.find('\\') == std::string_view::npos)
+        {
+            return std::string(name.substr(1, name.size() - 2));
+        }
+        return ParseUtil::GetJsonValueFromString(name).asString();
+    }
+
+    Json::Value ParseValue(std::string_view text)
+    {
+        // plain strings, literals and small integers are most of what's in a card; there's no need to start up the
+        // reader for them. What's made of them here is what jsoncpp would make.
+        if (text.front() == '"' && text.find('\\') == std::string_view::npos)
+        {
+            return Json::Value(std::string(text.substr(1, text.size() - 2)));
+        }
+        if (text == "true" || text == "false")
+        {
+            return Json::Value(text == "true");
+        }
+        if (text == "null")
+        {
+            return Json::Value();
+        }
+
+        const bool isNegative = (text.front() == '-');
+        const std::string_view digits = text.substr(isNegative ? 1 : 0);
+        if (digits.size() < std::numeric_limits<Json::Int>::digits10 &&
+            std::all_of(digits.begin(), digits.end(), [](char c) { return c >= '0' && c <= '9'; }))
+        {
+            Json::LargestInt value = 0;
+            for (const char digit : digits)
+            {
+                value = value * 10 + (digit - '0');
+            }
+            return Json::Value(isNegative ? -value : value);
+        }
+
+        return ParseUtil::GetJsonValueFromString(text);
+    }
+
+    // Reads the members of the object in text into object, all but the non-empty arrays that might hold elements or
+    // actions, which are set aside in collections. As in jsoncpp, the last of any members with the same name wins.
+    void ReadMembers(const JsonPullReader& reader, std::string_view text, Json::Value& object, std::vector<CollectionMember>& collections)
+    {
+        object = Json::Value(Json::objectValue);
+        reader.ForEachMember(text, [&](std::string_view nameText, std::string_view value) {
+            const std::string name = DecodeName(nameText);
+            const auto collectionKey = TryGetCollectionKey(name);
+            if (collectionKey)
+            {
+                collections.erase(
+                    std::remove_if(collections.begin(), collections.end(), [&](const CollectionMember& member) {
+                        return member.key == *collectionKey;
+                    }),
+                    collections.end());
+
+                if (value.front() == '[')
+                {
+                    std::vector<std::string_view> items;
+                    reader.ForEachItem(value, [&items](std::string_view item) { items.push_back(item); });
+                    if (!items.empty())
+                    {
+                        object.removeMember(name);
+                        collections.push_back({*collectionKey, value, std::move(items)});
+                        return;
+                    }
+                }
+            }
+            object[name] = ParseValue(value);
+        });
+    }
+
+    // Keeps a set of arrays registered as deferred for as long as the object they're deferred from is being parsed,
+    // including when parsing it throws
+    class DeferredArrayRegistration
+    {
+    public:
+        DeferredArrayRegistration(ParseContext& context, const Json::Value& owner) : m_context(context), m_owner(owner)
+        {
+        }
+        ~DeferredArrayRegistration()
+        {
+            m_context.RemoveDeferredArrays(m_owner);
+        }
+
+        DeferredArrayRegistration(const DeferredArrayRegistration&) = delete;
+        DeferredArrayRegistration& operator=(const DeferredArrayRegistration&) = delete;
+
+        void Add(AdaptiveCardSchemaKey key, const DeferredJsonArray& items)
+        {
+            m_context.AddDeferredArray(m_owner, key, items);
+        }
+
+    private:
+        ParseContext& m_context;
+        const Json::Value& m_owner;
+    };
+
+    void ParseObject(ParseContext& context,
+                     const JsonPullReader& reader,
+                     std::string_view text,
+                     ObjectKind kind,
+                     const std::string& impliedType,
+                     const DeferredJsonArray::ItemCallback& onObject)
+    {
+        Json::Value object;
+        std::vector<CollectionMember> collections;
+        if (text.front() == '{')
+        {
+            ReadMembers(reader, text, object, collections);
+        }
+        else
+        {
+            object = ParseUtil::GetJsonValueFromString(text);
+        }
+
+        // fills in the type just as GetElementCollection would, so that it doesn't have to copy the object to do it
+        if (!impliedType.empty() && ParseUtil::GetString(object, AdaptiveCardSchemaKey::Type).empty())
+        {
+            object[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = impliedType;
+        }
+
+        std::vector<StreamedArray> deferredArrays;
+        deferredArrays.reserve(collections.size());
+        DeferredArrayRegistration registration(context, object);
+        for (auto& collection : collections)
+        {
+            if (const auto itemKind = TryGetDeferredItemKind(kind, object, collection.key))
+            {
+                const auto& items = deferredArrays.emplace_back(reader, std::move(collection.items), *itemKind);
+                registration.Add(collection.key, items);
+            }
+            else
+            {
+                const auto& name = AdaptiveCardSchemaKeyToString(collection.key);
+                object[name] = ParseUtil::GetJsonValueFromString(collection.text);
+            }
+        }
+
+        onObject(object);
+    }
+
+    void StreamedArray::ForEachItem(ParseContext& context, const std::string& impliedType, const ItemCallback& onItem) const
+    {
+        for (const auto item : m_items)
+        {
+            ParseObject(context, m_reader, item, m_itemKind, impliedType, onItem);
+        }
+    }
+} // namespace
+
+void StreamingCardParser::ParseCard(ParseContext& context, std::string_view json, const DeferredJsonArray::ItemCallback& onCard)
+{
+    JsonPullReader reader(json);
+    const auto root = reader.ReadRootValue();
+    if (!root || root->front() != '{')
+    {
+        onCard(ParseUtil::GetJsonValueFromString(json));
+        return;
+    }
+
+    ParseObject(context, reader, *root, ObjectKind::Card, std::string(), onCard);
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,22 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseContext.h"
+
+namespace AdaptiveCards
+{
+// Hands the parsers a card's json a piece at a time, straight from its source text (see
+// AdaptiveCard::DeserializeFromStringStreaming). onCard gets the card's root object without its body and actions,
+// which are registered with context as DeferredJsonArrays; each of their items comes the same way, less any elements
+// or actions of its own, and so on down. Elements of custom types are the exception: their parsers may read anything
+// in their json, so each of them is handed over whole.
+//
+// Text that isn't a card -- invalid json, or json that isn't an object -- goes to ParseUtil::GetJsonValueFromString,
+// so errors come out exactly as they do for AdaptiveCard::DeserializeFromString.
+namespace StreamingCardParser
+{
+    void ParseCard(ParseContext& context, std::string_view json, const DeferredJsonArray::ItemCallback& onCard);
+} // namespace StreamingCardParser
+} // namespace AdaptiveCards
@@ -125,14 +125,13 @@ void StyledCollectionElement::SetSelectAction(const std::shared_ptr<BaseActionEl
     m_selectAction = action;
 }
 
-Json::Value StyledCollectionElement::SerializeToJsonValue() const
+void StyledCollectionElement::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = CollectionCoreElement::SerializeToJsonValue();
+    CollectionCoreElement::SerializeProperties(root);
 
     if (m_selectAction != nullptr)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction)] =
-            BaseCardElement::SerializeSelectAction(m_selectAction);
+        root.SetObject(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction), *m_selectAction);
     }
 
     if (m_backgroundImage != nullptr && !m_backgroundImage->GetUrl().empty())
@@ -160,6 +159,4 @@ Json::Value StyledCollectionElement::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight)] = std::to_string(GetMinHeight()) + "px";
     }
-
-    return root;
 }
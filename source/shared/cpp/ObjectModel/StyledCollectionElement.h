@@ -68,10 +68,12 @@ public:
     template <typename T>
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo, const std::vector<std::shared_ptr<T>>& elements);
 
-    Json::Value SerializeToJsonValue() const override;
     template <typename T>
     static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& value);
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     // Applies padding flag When appropriate
     void ConfigPadding(const AdaptiveCards::ParseContext& context);
@@ -109,10 +111,10 @@ std::shared_ptr<T> StyledCollectionElement::Deserialize(ParseContext& context, c
     collection->SetCanFallbackToAncestor(canFallbackToAncestor);
 
     collection->SetStyle(ParseUtil::GetEnumValue<ContainerStyle>(
-        value, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
+        value, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString));
 
     collection->SetVerticalContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-        value, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignmentFromString));
+        value, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignmentTryFromString));
 
     collection->SetBleed(ParseUtil::GetBool(value, AdaptiveCardSchemaKey::Bleed, false));
 
@@ -15,14 +15,15 @@ Table::Table() :
 
 void Table::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FirstRowAsHeaders),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::GridStyle),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rows),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ShowGridLines),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Columns,
+         AdaptiveCardSchemaKey::FirstRowAsHeaders,
+         AdaptiveCardSchemaKey::GridStyle,
+         AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+         AdaptiveCardSchemaKey::Rows,
+         AdaptiveCardSchemaKey::ShowGridLines,
+         AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 bool Table::GetShowGridLines() const
@@ -113,9 +114,9 @@ void Table::DeserializeChildren(ParseContext& context, const Json::Value& value)
     }
 }
 
-Json::Value Table::SerializeToJsonValue() const
+void Table::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = CollectionCoreElement::SerializeToJsonValue();
+    CollectionCoreElement::SerializeProperties(root);
 
     if (!m_columnDefinitions.empty())
     {
@@ -129,12 +130,7 @@ Json::Value Table::SerializeToJsonValue() const
 
     if (!m_rows.empty())
     {
-        const std::string& rowsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rows);
-        root[rowsPropertyName] = Json::Value(Json::arrayValue);
-        for (const auto& row : m_rows)
-        {
-            root[rowsPropertyName].append(row->SerializeToJsonValue());
-        }
+        root.SetArray(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rows), m_rows);
     }
 
     if (m_showGridLines != true)
@@ -163,8 +159,6 @@ Json::Value Table::SerializeToJsonValue() const
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)] =
             VerticalContentAlignmentToString(m_verticalCellContentAlignment.value_or(VerticalContentAlignment::Top));
     }
-
-    return root;
 }
 
 std::shared_ptr<BaseCardElement> TableParser::Deserialize(ParseContext& context, const Json::Value& json)
@@ -184,12 +178,12 @@ std::shared_ptr<BaseCardElement> TableParser::Deserialize(ParseContext& context,
 
     table->SetShowGridLines(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::ShowGridLines, true, false));
     table->SetGridStyle(ParseUtil::GetEnumValue<ContainerStyle>(
-        json, AdaptiveCardSchemaKey::GridStyle, ContainerStyle::None, ContainerStyleFromString));
+        json, AdaptiveCardSchemaKey::GridStyle, ContainerStyle::None, ContainerStyleTryFromString));
     table->SetFirstRowAsHeaders(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::FirstRowAsHeaders, true, false));
     table->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
     table->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
+        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
 
     return table;
 }
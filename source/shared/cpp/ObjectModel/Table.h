@@ -20,7 +20,6 @@ public:
     Table& operator=(Table&&) = default;
     virtual ~Table() = default;
 
-    Json::Value SerializeToJsonValue() const override;
     void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
 
     bool GetShowGridLines() const;
@@ -46,6 +45,9 @@ public:
     const std::vector<std::shared_ptr<AdaptiveCards::TableRow>>& GetRows() const;
     void SetRows(const std::vector<std::shared_ptr<AdaptiveCards::TableRow>>& value);
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
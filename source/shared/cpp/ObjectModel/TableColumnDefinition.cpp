@@ -93,12 +93,12 @@ void TableColumnDefinition::SetPixelWidth(const std::optional<unsigned int>& val
 
 std::shared_ptr<TableColumnDefinition> TableColumnDefinition::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    auto tableColumnDefinition = std::make_shared<TableColumnDefinition>();
+    auto tableColumnDefinition = context.MakeShared<TableColumnDefinition>();
 
     tableColumnDefinition->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
     tableColumnDefinition->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
+        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
 
     if (const auto& widthValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Width, false); !widthValue.empty())
     {
@@ -114,13 +114,13 @@ std::shared_ptr<TableColumnDefinition> TableColumnDefinition::Deserialize(ParseC
             }
             else if (!pixelWidth.has_value())
             {
-                context.warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+                context.warnings.emplace_back(context.MakeShared<AdaptiveCardParseWarning>(
                     WarningStatusCode::InvalidDimensionSpecified, "Supplied value for \"width\" could not be parsed"));
             }
         }
         else
         {
-            context.warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+            context.warnings.emplace_back(context.MakeShared<AdaptiveCardParseWarning>(
                 WarningStatusCode::InvalidValue, "Invalid type for \"width\""));
         }
     }
@@ -18,12 +18,13 @@ TableRow::TableRow() :
 
 void TableRow::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Cells),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Cells,
+         AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+         AdaptiveCardSchemaKey::Rtl,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 std::vector<std::shared_ptr<TableCell>>& TableRow::GetCells()
@@ -66,18 +67,13 @@ void TableRow::SetStyle(const ContainerStyle value)
     m_style = value;
 }
 
-Json::Value TableRow::SerializeToJsonValue() const
+void TableRow::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseCardElement::SerializeToJsonValue();
+    BaseCardElement::SerializeProperties(root);
 
     if (!m_cells.empty())
     {
-        const std::string& cellsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Cells);
-        root[cellsPropertyName] = Json::Value(Json::arrayValue);
-        for (const auto& cardElement : m_cells)
-        {
-            root[cellsPropertyName].append(cardElement->SerializeToJsonValue());
-        }
+        root.SetArray(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Cells), m_cells);
     }
 
     if (m_horizontalCellContentAlignment.has_value())
@@ -96,8 +92,11 @@ Json::Value TableRow::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = ContainerStyleToString(m_style);
     }
+}
 
-    return root;
+void TableRow::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::shared_ptr<TableRow> TableRow::DeserializeTableRowFromString(ParseContext& context, const std::string& json)
@@ -115,11 +114,11 @@ std::shared_ptr<TableRow> TableRow::DeserializeTableRow(ParseContext& context, c
     std::shared_ptr<TableRow> tableRow = BaseCardElement::Deserialize<TableRow>(context, json);
 
     tableRow->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
     tableRow->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
+        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
     tableRow->SetStyle(ParseUtil::GetEnumValue<ContainerStyle>(
-        json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
+        json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString));
 
     auto cells = ParseUtil::GetElementCollectionOfSingleType<TableCell>(
         context, json, AdaptiveCardSchemaKey::Cells, &TableCell::DeserializeTableCell, false);
@@ -20,8 +20,6 @@ public:
     TableRow& operator=(TableRow&&) = default;
     virtual ~TableRow() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::vector<std::shared_ptr<AdaptiveCards::TableCell>>& GetCells();
     const std::vector<std::shared_ptr<AdaptiveCards::TableCell>>& GetCells() const;
     void SetCells(const std::vector<std::shared_ptr<AdaptiveCards::TableCell>>& value);
@@ -38,6 +36,10 @@ public:
     static std::shared_ptr<TableRow> DeserializeTableRowFromString(ParseContext& context, const std::string& root);
     static std::shared_ptr<TableRow> DeserializeTableRow(ParseContext& context, const Json::Value& root);
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
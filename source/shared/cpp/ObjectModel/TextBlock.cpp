@@ -2,7 +2,6 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include <iomanip>
-#include <regex>
 #include <iostream>
 #include <codecvt>
 #include "ParseContext.h"
@@ -20,12 +19,11 @@ TextBlock::TextBlock() :
     PopulateKnownPropertiesSet();
 }
 
-Json::Value TextBlock::SerializeToJsonValue() const
+void TextBlock::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseCardElement::SerializeToJsonValue();
+    BaseCardElement::SerializeProperties(root);
 
-    // ignore return -- properties are added directly to root
-    (void)m_textElementProperties->SerializeToJsonValue(root);
+    m_textElementProperties->SerializeProperties(root);
 
     if (m_hAlignment.has_value())
     {
@@ -48,8 +46,11 @@ Json::Value TextBlock::SerializeToJsonValue() const
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] =
             TextStyleToString(m_textStyle.value_or(TextStyle::Default));
     }
+}
 
-    return root;
+void TextBlock::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::string TextBlock::GetText() const
@@ -62,7 +63,12 @@ void TextBlock::SetText(const std::string& value)
     m_textElementProperties->SetText(value);
 }
 
-DateTimePreparser TextBlock::GetTextForDateParsing() const
+void TextBlock::SetText(std::string&& value)
+{
+    m_textElementProperties->SetText(std::move(value));
+}
+
+const DateTimePreparser& TextBlock::GetTextForDateParsing() const
 {
     return m_textElementProperties->GetTextForDateParsing();
 }
@@ -175,10 +181,10 @@ std::shared_ptr<BaseCardElement> TextBlockParser::Deserialize(ParseContext& cont
     textBlock->m_textElementProperties->Deserialize(context, json);
 
     textBlock->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false));
-    textBlock->SetStyle(ParseUtil::GetOptionalEnumValue<TextStyle>(json, AdaptiveCardSchemaKey::Style, TextStyleFromString));
+    textBlock->SetStyle(ParseUtil::GetOptionalEnumValue<TextStyle>(json, AdaptiveCardSchemaKey::Style, TextStyleTryFromString));
     textBlock->SetMaxLines(ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::MaxLines, 0));
     textBlock->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     return textBlock;
 }
@@ -190,11 +196,14 @@ std::shared_ptr<BaseCardElement> TextBlockParser::DeserializeFromString(ParseCon
 
 void TextBlock::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
-
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)});
+    static const auto knownProperties = [this]() {
+        auto properties = ExtendKnownProperties(
+            {AdaptiveCardSchemaKey::Wrap,
+             AdaptiveCardSchemaKey::Style,
+             AdaptiveCardSchemaKey::MaxLines,
+             AdaptiveCardSchemaKey::HorizontalAlignment});
+        m_textElementProperties->PopulateKnownPropertiesSet(properties);
+        return properties;
+    }();
+    m_knownProperties = &knownProperties;
 }
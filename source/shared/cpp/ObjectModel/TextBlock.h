@@ -24,11 +24,10 @@ public:
     TextBlock& operator=(TextBlock&&) = default;
     ~TextBlock() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::string GetText() const;
     void SetText(const std::string& value);
-    DateTimePreparser GetTextForDateParsing() const;
+    void SetText(std::string&& value);
+    const DateTimePreparser& GetTextForDateParsing() const;
 
     std::optional<TextStyle> GetStyle() const;
     void SetStyle(const std::optional<TextStyle> value);
@@ -60,6 +59,10 @@ public:
     void SetLanguage(const std::string& value);
     const std::string& GetLanguage() const;
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
+
 private:
     bool m_wrap;
     unsigned int m_maxLines;
@@ -2,13 +2,13 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include <iomanip>
-#include <regex>
 #include <iostream>
 #include <codecvt>
 #include "ParseContext.h"
 #include "TextElementProperties.h"
 #include "DateTimePreparser.h"
 #include "ParseUtil.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
@@ -24,6 +24,18 @@ TextElementProperties::TextElementProperties(const TextStyleConfig& config, cons
 }
 
 Json::Value TextElementProperties::SerializeToJsonValue(Json::Value& root) const
+{
+    SetProperties(root);
+    return root;
+}
+
+void TextElementProperties::SerializeProperties(JsonMembers& root) const
+{
+    SetProperties(root);
+}
+
+template <typename T>
+void TextElementProperties::SetProperties(T& root) const
 {
     if (m_textSize.has_value())
     {
@@ -55,8 +67,6 @@ Json::Value TextElementProperties::SerializeToJsonValue(Json::Value& root) const
     }
 
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Text)] = GetText();
-
-    return root;
 }
 
 std::string TextElementProperties::GetText() const
@@ -65,48 +75,24 @@ std::string TextElementProperties::GetText() const
 }
 
 // Convert some HTML entities into characters
-std::string TextElementProperties::_ProcessHTMLEntities(const std::string& input)
+void TextElementProperties::SetText(const std::string& value)
 {
-    static const std::regex htmlEntities("&(amp|quot|lt|gt|nbsp);");
-
-    if (std::regex_search(input, htmlEntities))
-    {
-        // this needs to be kept up to date with htmlEntities above
-        // clang-format off
-        static const std::vector<std::pair<std::regex, std::string>> replacements =
-            {
-                { std::regex("&quot;"), "\"" },
-                { std::regex("&lt;"), "<" },
-                { std::regex("&gt;"), ">" },
-                { std::regex("&nbsp;"), " " },
-                { std::regex("&amp;"), "&" } // amp must be last
-            };
-        // clang-format on
-
-        // handle entities
-        std::string output = input;
-
-        for (const auto& replacement : replacements)
-        {
-            output = std::regex_replace(output, replacement.first, replacement.second);
-        }
-
-        return output;
-    }
-    else
-    {
-        return input;
-    }
+    m_text = value;
+    DecodeHtmlEntitiesInPlace(m_text);
+    m_dateTimePreparser.Reset();
 }
 
-void TextElementProperties::SetText(const std::string& value)
+void TextElementProperties::SetText(std::string&& value)
 {
-    m_text = _ProcessHTMLEntities(value);
+    m_text = std::move(value);
+    DecodeHtmlEntitiesInPlace(m_text);
+    m_dateTimePreparser.Reset();
 }
 
-DateTimePreparser TextElementProperties::GetTextForDateParsing() const
+// Renderers ask for this on every layout, so it's only worked out again when the text changes
+const DateTimePreparser& TextElementProperties::GetTextForDateParsing() const
 {
-    return DateTimePreparser(m_text);
+    return m_dateTimePreparser.Get(m_text);
 }
 
 std::optional<TextSize> TextElementProperties::GetTextSize() const
@@ -172,16 +158,16 @@ void TextElementProperties::SetLanguage(const std::string& value)
 void TextElementProperties::Deserialize(ParseContext& context, const Json::Value& json)
 {
     SetText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Text, false));
-    if (GetText().empty())
+    if (m_text.empty())
     {
-        context.warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+        context.warnings.emplace_back(context.MakeShared<AdaptiveCardParseWarning>(
             WarningStatusCode::RequiredPropertyMissing, "required property, \"text\", is either empty or missing"));
     }
 
-    SetTextSize(ParseUtil::GetOptionalEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, TextSizeFromString));
-    SetTextColor(ParseUtil::GetOptionalEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColorFromString));
-    SetTextWeight(ParseUtil::GetOptionalEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::TextWeight, TextWeightFromString));
-    SetFontType(ParseUtil::GetOptionalEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, FontTypeFromString));
+    SetTextSize(ParseUtil::GetOptionalEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, TextSizeTryFromString));
+    SetTextColor(ParseUtil::GetOptionalEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColorTryFromString));
+    SetTextWeight(ParseUtil::GetOptionalEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::TextWeight, TextWeightTryFromString));
+    SetFontType(ParseUtil::GetOptionalEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, FontTypeTryFromString));
     SetIsSubtle(ParseUtil::GetOptionalBool(json, AdaptiveCardSchemaKey::IsSubtle));
     SetLanguage(context.GetLanguage());
 }
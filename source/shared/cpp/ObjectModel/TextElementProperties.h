@@ -22,10 +22,13 @@ public:
     virtual ~TextElementProperties() = default;
 
     virtual Json::Value SerializeToJsonValue(Json::Value& root) const;
+    // The same properties, for an element serializing through JsonMembers
+    void SerializeProperties(JsonMembers& root) const;
 
     std::string GetText() const;
     void SetText(const std::string& value);
-    DateTimePreparser GetTextForDateParsing() const;
+    void SetText(std::string&& value);
+    const DateTimePreparser& GetTextForDateParsing() const;
 
     std::optional<TextSize> GetTextSize() const;
     void SetTextSize(const std::optional<TextSize> value);
@@ -49,7 +52,8 @@ public:
     virtual void PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties);
 
 private:
-    static std::string _ProcessHTMLEntities(const std::string& input);
+    template <typename T>
+    void SetProperties(T& root) const;
 
     std::string m_text;
     std::optional<TextSize> m_textSize;
@@ -58,5 +62,6 @@ private:
     std::optional<ForegroundColor> m_textColor;
     std::optional<bool> m_isSubtle;
     std::string m_language;
+    MemoizedDateTimePreparser m_dateTimePreparser;
 };
 } // namespace AdaptiveCards
@@ -13,9 +13,9 @@ TextInput::TextInput() :
     PopulateKnownPropertiesSet();
 }
 
-Json::Value TextInput::SerializeToJsonValue() const
+void TextInput::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseInputElement::SerializeToJsonValue();
+    BaseInputElement::SerializeProperties(root);
 
     if (m_isMultiline)
     {
@@ -44,16 +44,13 @@ Json::Value TextInput::SerializeToJsonValue() const
 
     if (m_inlineAction != nullptr)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::InlineAction)] =
-            BaseCardElement::SerializeSelectAction(m_inlineAction);
+        root.SetObject(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::InlineAction), *m_inlineAction);
     }
 
     if (!m_regex.empty())
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Regex)] = m_regex;
     }
-
-    return root;
 }
 
 std::string TextInput::GetPlaceholder() const
@@ -61,6 +58,11 @@ std::string TextInput::GetPlaceholder() const
     return m_placeholder;
 }
 
+void TextInput::SetPlaceholder(std::string&& value)
+{
+    m_placeholder = std::move(value);
+}
+
 void TextInput::SetPlaceholder(const std::string& value)
 {
     m_placeholder = value;
@@ -71,6 +73,11 @@ std::string TextInput::GetValue() const
     return m_value;
 }
 
+void TextInput::SetValue(std::string&& value)
+{
+    m_value = std::move(value);
+}
+
 void TextInput::SetValue(const std::string& value)
 {
     m_value = value;
@@ -121,6 +128,11 @@ std::string TextInput::GetRegex() const
     return m_regex;
 }
 
+void TextInput::SetRegex(std::string&& value)
+{
+    m_regex = std::move(value);
+}
+
 void TextInput::SetRegex(const std::string& value)
 {
     m_regex = value;
@@ -139,14 +151,14 @@ std::shared_ptr<BaseCardElement> TextInputParser::Deserialize(ParseContext& cont
     textInput->SetIsMultiline(isMultiline);
 
     const auto textInputStyle =
-        ParseUtil::GetEnumValue<TextInputStyle>(json, AdaptiveCardSchemaKey::Style, TextInputStyle::Text, TextInputStyleFromString);
+        ParseUtil::GetEnumValue<TextInputStyle>(json, AdaptiveCardSchemaKey::Style, TextInputStyle::Text, TextInputStyleTryFromString);
     textInput->SetTextInputStyle(textInputStyle);
 
     // emit warning in the case where style is `password` but multiline is specified (this is an invalid combination.
     // renderers should ignore multiline in this case)
     if (isMultiline && textInputStyle == TextInputStyle::Password)
     {
-        context.warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+        context.warnings.emplace_back(context.MakeShared<AdaptiveCardParseWarning>(
             WarningStatusCode::InvalidValue, "Input.Text ignores isMultiline when using password style"));
     }
 
@@ -163,10 +175,11 @@ std::shared_ptr<BaseCardElement> TextInputParser::DeserializeFromString(ParseCon
 
 void TextInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiline),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLength),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextInput)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::IsMultiline,
+         AdaptiveCardSchemaKey::MaxLength,
+         AdaptiveCardSchemaKey::TextInput});
+    m_knownProperties = &knownProperties;
 }
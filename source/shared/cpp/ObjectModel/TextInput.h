@@ -18,12 +18,12 @@ public:
     TextInput& operator=(TextInput&&) = default;
     ~TextInput() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::string GetPlaceholder() const;
+    void SetPlaceholder(std::string&& value);
     void SetPlaceholder(const std::string& value);
 
     std::string GetValue() const;
+    void SetValue(std::string&& value);
     void SetValue(const std::string& value);
 
     bool GetIsMultiline() const;
@@ -39,8 +39,12 @@ public:
     void SetInlineAction(const std::shared_ptr<BaseActionElement> action);
 
     std::string GetRegex() const;
+    void SetRegex(std::string&& value);
     void SetRegex(const std::string& value);
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
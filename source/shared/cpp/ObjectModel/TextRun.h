@@ -25,7 +25,8 @@ public:
 
     std::string GetText() const;
     void SetText(const std::string& value);
-    DateTimePreparser GetTextForDateParsing() const;
+    void SetText(std::string&& value);
+    const DateTimePreparser& GetTextForDateParsing() const;
 
     std::optional<TextSize> GetTextSize() const;
     void SetTextSize(const std::optional<TextSize> value);
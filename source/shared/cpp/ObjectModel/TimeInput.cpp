@@ -12,9 +12,9 @@ TimeInput::TimeInput() : BaseInputElement(CardElementType::TimeInput)
     PopulateKnownPropertiesSet();
 }
 
-Json::Value TimeInput::SerializeToJsonValue() const
+void TimeInput::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseInputElement::SerializeToJsonValue();
+    BaseInputElement::SerializeProperties(root);
 
     if (!m_max.empty())
     {
@@ -35,8 +35,6 @@ Json::Value TimeInput::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = GetValue();
     }
-
-    return root;
 }
 
 std::string TimeInput::GetMax() const
@@ -44,6 +42,11 @@ std::string TimeInput::GetMax() const
     return m_max;
 }
 
+void TimeInput::SetMax(std::string&& value)
+{
+    m_max = std::move(value);
+}
+
 void TimeInput::SetMax(const std::string& value)
 {
     m_max = value;
@@ -54,6 +57,11 @@ std::string TimeInput::GetMin() const
     return m_min;
 }
 
+void TimeInput::SetMin(std::string&& value)
+{
+    m_min = std::move(value);
+}
+
 void TimeInput::SetMin(const std::string& value)
 {
     m_min = value;
@@ -64,6 +72,11 @@ std::string TimeInput::GetPlaceholder() const
     return m_placeholder;
 }
 
+void TimeInput::SetPlaceholder(std::string&& value)
+{
+    m_placeholder = std::move(value);
+}
+
 void TimeInput::SetPlaceholder(const std::string& value)
 {
     m_placeholder = value;
@@ -74,6 +87,11 @@ std::string TimeInput::GetValue() const
     return m_value;
 }
 
+void TimeInput::SetValue(std::string&& value)
+{
+    m_value = std::move(value);
+}
+
 void TimeInput::SetValue(const std::string& value)
 {
     m_value = value;
@@ -100,9 +118,10 @@ std::shared_ptr<BaseCardElement> TimeInputParser::DeserializeFromString(ParseCon
 
 void TimeInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Min,
+         AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Value});
+    m_knownProperties = &knownProperties;
 }
@@ -18,20 +18,25 @@ public:
     TimeInput& operator=(TimeInput&&) = default;
     ~TimeInput() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::string GetMax() const;
+    void SetMax(std::string&& value);
     void SetMax(const std::string& value);
 
     std::string GetMin() const;
+    void SetMin(std::string&& value);
     void SetMin(const std::string& value);
 
     std::string GetPlaceholder() const;
+    void SetPlaceholder(std::string&& value);
     void SetPlaceholder(const std::string& value);
 
     std::string GetValue() const;
+    void SetValue(std::string&& value);
     void SetValue(const std::string& value);
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
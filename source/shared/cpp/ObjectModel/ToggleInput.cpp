@@ -13,9 +13,9 @@ ToggleInput::ToggleInput() :
     PopulateKnownPropertiesSet();
 }
 
-Json::Value ToggleInput::SerializeToJsonValue() const
+void ToggleInput::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseInputElement::SerializeToJsonValue();
+    BaseInputElement::SerializeProperties(root);
 
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title)] = GetTitle();
 
@@ -38,8 +38,6 @@ Json::Value ToggleInput::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOn)] = m_valueOn;
     }
-
-    return root;
 }
 
 std::string ToggleInput::GetTitle() const
@@ -47,6 +45,11 @@ std::string ToggleInput::GetTitle() const
     return m_title;
 }
 
+void ToggleInput::SetTitle(std::string&& value)
+{
+    m_title = std::move(value);
+}
+
 void ToggleInput::SetTitle(const std::string& value)
 {
     m_title = value;
@@ -57,10 +60,20 @@ std::string ToggleInput::GetValue() const
     return m_value;
 }
 
+void ToggleInput::SetValue(std::string&& value)
+{
+    m_value = std::move(value);
+}
+
 void ToggleInput::SetValue(const std::string& value)
 {
     m_value = value;
 }
+void ToggleInput::SetValueOff(std::string&& value)
+{
+    m_valueOff = std::move(value);
+}
+
 void ToggleInput::SetValueOff(const std::string& valueOff)
 {
     m_valueOff = valueOff;
@@ -76,6 +89,11 @@ std::string ToggleInput::GetValueOn() const
     return m_valueOn;
 }
 
+void ToggleInput::SetValueOn(std::string&& value)
+{
+    m_valueOn = std::move(value);
+}
+
 void ToggleInput::SetValueOn(const std::string& valueOn)
 {
     m_valueOn = valueOn;
@@ -113,10 +131,11 @@ std::shared_ptr<BaseCardElement> ToggleInputParser::DeserializeFromString(ParseC
 
 void ToggleInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOn),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOff),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    static const auto knownProperties = ExtendKnownProperties(
+        {AdaptiveCardSchemaKey::Title,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::ValueOn,
+         AdaptiveCardSchemaKey::ValueOff,
+         AdaptiveCardSchemaKey::Wrap});
+    m_knownProperties = &knownProperties;
 }
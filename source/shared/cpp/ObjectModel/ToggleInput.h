@@ -18,23 +18,28 @@ public:
     ToggleInput& operator=(ToggleInput&&) = default;
     ~ToggleInput() = default;
 
-    Json::Value SerializeToJsonValue() const override;
-
     std::string GetTitle() const;
+    void SetTitle(std::string&& value);
     void SetTitle(const std::string& value);
 
     std::string GetValue() const;
+    void SetValue(std::string&& value);
     void SetValue(const std::string& value);
 
     std::string GetValueOff() const;
+    void SetValueOff(std::string&& value);
     void SetValueOff(const std::string& value);
 
     std::string GetValueOn() const;
+    void SetValueOn(std::string&& value);
     void SetValueOn(const std::string& value);
 
     bool GetWrap() const;
     void SetWrap(bool value);
 
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+
 private:
     void PopulateKnownPropertiesSet();
 
@@ -21,9 +21,9 @@ std::vector<std::shared_ptr<ToggleVisibilityTarget>>& ToggleVisibilityAction::Ge
     return m_targetElements;
 }
 
-Json::Value ToggleVisibilityAction::SerializeToJsonValue() const
+void ToggleVisibilityAction::SerializeProperties(JsonMembers& root) const
 {
-    Json::Value root = BaseActionElement::SerializeToJsonValue();
+    BaseActionElement::SerializeProperties(root);
 
     const std::string& targetElementsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TargetElements);
     root[targetElementsPropertyName] = Json::Value(Json::arrayValue);
@@ -31,7 +31,11 @@ Json::Value ToggleVisibilityAction::SerializeToJsonValue() const
     {
         root[targetElementsPropertyName].append(targetElement->SerializeToJsonValue());
     }
-    return root;
+}
+
+void ToggleVisibilityAction::WriteJson(JsonWriter& writer) const
+{
+    WriteProperties(writer);
 }
 
 std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::Deserialize(ParseContext& context, const Json::Value& json)
@@ -53,5 +57,6 @@ std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::DeserializeFrom
 
 void ToggleVisibilityAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TargetElements)});
+    static const auto knownProperties = ExtendKnownProperties({AdaptiveCardSchemaKey::TargetElements});
+    m_knownProperties = &knownProperties;
 }
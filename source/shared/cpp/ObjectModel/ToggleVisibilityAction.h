@@ -19,7 +19,9 @@ public:
     const std::vector<std::shared_ptr<ToggleVisibilityTarget>>& GetTargetElements() const;
     std::vector<std::shared_ptr<ToggleVisibilityTarget>>& GetTargetElements();
 
-    Json::Value SerializeToJsonValue() const override;
+protected:
+    void SerializeProperties(JsonMembers& root) const override;
+    void WriteJson(JsonWriter& writer) const override;
 
 private:
     void PopulateKnownPropertiesSet();
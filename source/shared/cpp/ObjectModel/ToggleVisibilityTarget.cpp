@@ -15,6 +15,11 @@ std::string ToggleVisibilityTarget::GetElementId() const
     return m_targetId;
 }
 
+void ToggleVisibilityTarget::SetElementId(std::string&& value)
+{
+    m_targetId = std::move(value);
+}
+
 void ToggleVisibilityTarget::SetElementId(const std::string& value)
 {
     m_targetId = value;
@@ -30,9 +35,9 @@ void ToggleVisibilityTarget::SetIsVisible(IsVisible value)
     m_visibilityToggle = value;
 }
 
-std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(ParseContext&, const Json::Value& json)
+std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    auto toggleVisibilityTargetElement = std::make_shared<ToggleVisibilityTarget>();
+    auto toggleVisibilityTargetElement = context.MakeShared<ToggleVisibilityTarget>();
 
     if (json.isString())
     {
@@ -42,7 +47,7 @@ std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(Pars
     {
         toggleVisibilityTargetElement->SetElementId(ParseUtil::GetString(json, AdaptiveCardSchemaKey::ElementId, true));
 
-        auto propertyValue = json.get(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible), Json::Value());
+        const auto& propertyValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::IsVisible);
         if (!propertyValue.empty())
         {
             if (!propertyValue.isBool())
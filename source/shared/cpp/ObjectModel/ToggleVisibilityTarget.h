@@ -21,6 +21,7 @@ public:
     ToggleVisibilityTarget();
 
     std::string GetElementId() const;
+    void SetElementId(std::string&& value);
     void SetElementId(const std::string& value);
 
     IsVisible GetIsVisible() const;
@@ -84,9 +84,9 @@ Json::Value TokenExchangeResource::SerializeToJsonValue() const
     return root;
 }
 
-std::shared_ptr<TokenExchangeResource> TokenExchangeResource::Deserialize(ParseContext&, const Json::Value& json)
+std::shared_ptr<TokenExchangeResource> TokenExchangeResource::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<TokenExchangeResource> resource = std::make_shared<TokenExchangeResource>();
+    std::shared_ptr<TokenExchangeResource> resource = context.MakeShared<TokenExchangeResource>();
 
     resource->SetId(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Id));
     resource->SetUri(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Uri));
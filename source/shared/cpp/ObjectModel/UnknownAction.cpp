@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "UnknownAction.h"
+#include "ParseInstrumentation.h"
 
 using namespace AdaptiveCards;
 
@@ -14,9 +15,20 @@ Json::Value AdaptiveCards::UnknownAction::SerializeToJsonValue() const
     return GetAdditionalProperties();
 }
 
+void UnknownAction::WriteJson(JsonWriter& writer) const
+{
+    writer.WriteValue(GetAdditionalProperties());
+}
+
 std::shared_ptr<BaseActionElement> UnknownActionParser::Deserialize(ParseContext& context, const Json::Value& json)
 {
     std::string actualType = ParseUtil::GetTypeAsString(json);
+#ifndef ADAPTIVECARDS_DISABLE_PARSE_INSTRUMENTATION
+    if (auto instrumentation = context.GetInstrumentation())
+    {
+        instrumentation->OnUnknownType(ParseInstrumentation::ElementKind::Action, actualType);
+    }
+#endif
     std::shared_ptr<UnknownAction> unknown = BaseActionElement::Deserialize<UnknownAction>(context, json);
     unknown->SetAdditionalProperties(json);
     unknown->SetElementTypeString(actualType);
@@ -14,6 +14,9 @@ class UnknownAction : public BaseActionElement
 public:
     UnknownAction();
     Json::Value SerializeToJsonValue() const override;
+
+protected:
+    void WriteJson(JsonWriter& writer) const override;
 };
 
 class UnknownActionParser : public ActionElementParser
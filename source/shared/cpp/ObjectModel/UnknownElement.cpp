@@ -4,6 +4,7 @@
 
 #include "UnknownElement.h"
 #include "ParseContext.h"
+#include "ParseInstrumentation.h"
 #include "ParseUtil.h"
 #include "Util.h"
 
@@ -21,6 +22,12 @@ std::shared_ptr<BaseCardElement> UnknownElementParser::Deserialize(ParseContext&
     // BaseCardElement::Deserialize() do its work, then put the real string back with SetElementTypeString (otherwise,
     // the string will be initialized as "Unknown").
     std::string actualType = ParseUtil::GetTypeAsString(json);
+#ifndef ADAPTIVECARDS_DISABLE_PARSE_INSTRUMENTATION
+    if (auto instrumentation = context.GetInstrumentation())
+    {
+        instrumentation->OnUnknownType(ParseInstrumentation::ElementKind::CardElement, actualType);
+    }
+#endif
     std::shared_ptr<UnknownElement> unknown = BaseCardElement::Deserialize<UnknownElement>(context, json);
     unknown->SetAdditionalProperties(json);
     unknown->SetElementTypeString(actualType);
@@ -37,3 +44,8 @@ Json::Value UnknownElement::SerializeToJsonValue() const
 {
     return GetAdditionalProperties();
 }
+
+void UnknownElement::WriteJson(JsonWriter& writer) const
+{
+    writer.WriteValue(GetAdditionalProperties());
+}
@@ -12,6 +12,9 @@ class UnknownElement : public BaseCardElement
 public:
     UnknownElement();
     Json::Value SerializeToJsonValue() const override;
+
+protected:
+    void WriteJson(JsonWriter& writer) const override;
 };
 
 class UnknownElementParser : public BaseCardElementParser
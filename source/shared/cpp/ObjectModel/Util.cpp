@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 
+#include "ArgbColor.h"
 #include "ColumnSet.h"
 #include "Container.h"
 #include "FactSet.h"
@@ -19,14 +20,7 @@ std::string ValidateColor(const std::string& backgroundColor, std::vector<std::s
         return backgroundColor;
     }
 
-    const size_t backgroundColorLength = backgroundColor.length();
-    bool isValidColor = ((backgroundColor.at(0) == '#') && (backgroundColorLength == 7 || backgroundColorLength == 9));
-    for (size_t i = 1; i < backgroundColorLength && isValidColor; ++i)
-    {
-        isValidColor = isxdigit(backgroundColor.at(i));
-    }
-
-    if (!isValidColor)
+    if (!ArgbColor::TryParse(backgroundColor).has_value())
     {
         warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
             WarningStatusCode::InvalidColorFormat,
@@ -34,20 +28,62 @@ std::string ValidateColor(const std::string& backgroundColor, std::vector<std::s
         return "#00000000";
     }
 
-    std::string validBackgroundColor;
     // If format given was #RRGGBB
-    if (backgroundColorLength == 7)
+    if (backgroundColor.length() == 7)
     {
-        validBackgroundColor = "#FF" + backgroundColor.substr(1, 6);
+        std::string validBackgroundColor;
+        validBackgroundColor.reserve(9);
+        validBackgroundColor.append("#FF").append(backgroundColor, 1, 6);
+        return validBackgroundColor;
     }
-    else
+
+    return backgroundColor;
+}
+
+namespace
+{
+    bool IsAsciiDigit(char c)
     {
-        validBackgroundColor = backgroundColor;
+        return c >= '0' && c <= '9';
     }
 
-    return validBackgroundColor;
-}
+    // Returns the length of the integral part if number matches [1-9]\d*(\.\d+)? in its entirety, or 0 otherwise.
+    size_t ScanPositiveDecimal(const char* number, size_t length)
+    {
+        if (length == 0 || number[0] < '1' || number[0] > '9')
+        {
+            return 0;
+        }
+
+        size_t integralLength = 1;
+        while (integralLength < length && IsAsciiDigit(number[integralLength]))
+        {
+            ++integralLength;
+        }
+
+        if (integralLength == length)
+        {
+            return integralLength;
+        }
 
+        if (number[integralLength] != '.' || integralLength + 1 == length)
+        {
+            return 0;
+        }
+
+        for (size_t i = integralLength + 1; i < length; ++i)
+        {
+            if (!IsAsciiDigit(number[i]))
+            {
+                return 0;
+            }
+        }
+        return integralLength;
+    }
+} // namespace
+
+// Accepts requestedDimension if it's a positive decimal number immediately followed by unit (taken literally), and
+// sets parsedDimension to the number's integral part.
 void ValidateUserInputForDimensionWithUnit(
     const std::string& unit,
     const std::string& requestedDimension,
@@ -56,33 +92,29 @@ void ValidateUserInputForDimensionWithUnit(
 {
     constexpr auto warningMessage =
         "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received ";
-    std::string stringPattern = "^([1-9]+\\d*)(\\.\\d+)?";
-    stringPattern += ("(" + unit + ")$");
-    std::regex pattern(stringPattern);
-    std::smatch matches;
 
-    if (std::regex_search(requestedDimension, matches, pattern))
+    size_t integralLength = 0;
+    if (requestedDimension.size() > unit.size() &&
+        requestedDimension.compare(requestedDimension.size() - unit.size(), unit.size(), unit) == 0)
     {
-        try
-        {
-            // stoi will get integral value upto non digit char indexed by idx
-            parsedDimension = std::stoi(matches[0]);
-        }
-        catch (const std::invalid_argument&)
+        integralLength = ScanPositiveDecimal(requestedDimension.data(), requestedDimension.size() - unit.size());
+    }
+
+    if (integralLength != 0)
+    {
+        int value = 0;
+        const char* integralEnd = requestedDimension.data() + integralLength;
+        if (std::from_chars(requestedDimension.data(), integralEnd, value).ec == std::errc::result_out_of_range)
         {
             if (warnings)
             {
                 warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
-                    WarningStatusCode::InvalidDimensionSpecified, warningMessage + requestedDimension));
+                    WarningStatusCode::InvalidDimensionSpecified, "out of range: " + requestedDimension));
             }
         }
-        catch (const std::out_of_range&)
+        else
         {
-            if (warnings)
-            {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
-                    WarningStatusCode::InvalidDimensionSpecified, "out of range: " + requestedDimension));
-            }
+            parsedDimension = value;
         }
     }
     else
@@ -134,6 +166,82 @@ std::optional<int> ParseSizeForPixelSize(const std::string& sizeString, std::vec
     return parsedSize;
 }
 
+namespace
+{
+    struct HtmlEntity
+    {
+        std::string_view name; // without the leading '&'
+        std::string_view value;
+    };
+
+    constexpr HtmlEntity c_htmlEntities[] = {
+        {"amp;", "&"}, {"quot;", "\""}, {"lt;", "<"}, {"gt;", ">"}, {"nbsp;", "\xC2\xA0"} // U+00A0 in UTF-8
+    };
+
+    // Returns the entity whose name follows the '&' at text[ampersand], if there is one
+    const HtmlEntity* MatchHtmlEntity(std::string_view text, size_t ampersand)
+    {
+        const auto name = text.substr(ampersand + 1);
+        for (const auto& entity : c_htmlEntities)
+        {
+            if (name.compare(0, entity.name.size(), entity.name) == 0)
+            {
+                return &entity;
+            }
+        }
+        return nullptr;
+    }
+} // namespace
+
+// Both decoders jump from one '&' to the next with find(), which is memchr underneath, so text without entities is
+// only looked at in bulk.
+void DecodeHtmlEntitiesInPlace(std::string& text)
+{
+    size_t read = text.find('&');
+    size_t write = read;
+    while (read != std::string::npos)
+    {
+        const auto entity = MatchHtmlEntity(text, read);
+        if (entity)
+        {
+            // every value is shorter than its entity, so decoding only ever moves the text down
+            write += entity->value.copy(&text[write], entity->value.size());
+            read += entity->name.size() + 1;
+        }
+        else
+        {
+            text[write++] = text[read++];
+        }
+
+        const size_t next = std::min(text.find('&', read), text.size());
+        // until the first entity is decoded nothing has moved, and std::copy can't copy a range onto itself
+        if (write != read)
+        {
+            std::copy(text.begin() + read, text.begin() + next, text.begin() + write);
+        }
+        write += next - read;
+        read = (next == text.size()) ? std::string::npos : next;
+    }
+
+    if (write != std::string::npos)
+    {
+        text.resize(write);
+    }
+}
+
+void AppendDecodedHtmlEntities(std::string_view text, std::string& output)
+{
+    size_t read = 0;
+    for (size_t ampersand = text.find('&'); ampersand != std::string_view::npos; ampersand = text.find('&', read))
+    {
+        output.append(text, read, ampersand - read);
+        const auto entity = MatchHtmlEntity(text, ampersand);
+        output.append(entity ? entity->value : "&");
+        read = ampersand + (entity ? entity->name.size() + 1 : 1);
+    }
+    output.append(text, read);
+}
+
 void EnsureShowCardVersions(const std::vector<std::shared_ptr<BaseActionElement>>& actions, const std::string& version)
 {
     for (auto& action : actions)
@@ -151,9 +259,18 @@ void EnsureShowCardVersions(const std::vector<std::shared_ptr<BaseActionElement>
 
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties)
 {
+    // read each member name in place and reuse one buffer for the set lookup rather than materializing a
+    // Json::Value and a std::string per property
+    thread_local std::string key;
     for (auto it = json.begin(); it != json.end(); ++it)
     {
-        std::string key = it.key().asCString();
+        char const* keyEnd = nullptr;
+        char const* keyBegin = it.memberName(&keyEnd);
+        if (keyBegin == nullptr)
+        {
+            continue;
+        }
+        key.assign(keyBegin, keyEnd);
         if (knownProperties.find(key) == knownProperties.end())
         {
             unknownProperties[key] = *it;
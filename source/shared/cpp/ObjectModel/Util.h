@@ -10,6 +10,11 @@ std::string ValidateColor(const std::string& backgroundColor, std::vector<std::s
 std::optional<int> ParseSizeForPixelSize(
     const std::string& sizeString, std::vector<std::shared_ptr<AdaptiveCards::AdaptiveCardParseWarning>>* warnings);
 
+// Decodes the HTML entities card text may contain (&amp; &quot; &lt; &gt; and &nbsp;) in a single pass. Any other
+// '&' is left alone, and decoded characters aren't rescanned, so "&amp;lt;" decodes to "&lt;".
+void DecodeHtmlEntitiesInPlace(std::string& text);
+void AppendDecodedHtmlEntities(std::string_view text, std::string& output);
+
 void EnsureShowCardVersions(const std::vector<std::shared_ptr<AdaptiveCards::BaseActionElement>>& actions, const std::string& version);
 
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties);
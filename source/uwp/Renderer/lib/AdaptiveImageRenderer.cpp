@@ -357,8 +357,8 @@ namespace AdaptiveCards::Rendering::Uwp
         {
             // Decode base 64 string
             winrt::hstring dataPath = imageUrl.Path();
-            std::string data = AdaptiveBase64Util::ExtractDataFromUri(HStringToUTF8(dataPath));
-            std::vector<char> decodedData = AdaptiveBase64Util::Decode(data);
+            const std::string dataUri = HStringToUTF8(dataPath);
+            std::vector<char> decodedData = AdaptiveBase64Util::Decode(AdaptiveBase64Util::GetDataFromUri(dataUri));
 
             winrt::DataWriter dataWriter{winrt::InMemoryRandomAccessStream{}};
 
@@ -4,6 +4,7 @@
 #include "InputValue.h"
 #include "json/json.h"
 #include "XamlHelpers.h"
+#include <regex>
 
 namespace winrt::AdaptiveCards::Rendering::Uwp
 {
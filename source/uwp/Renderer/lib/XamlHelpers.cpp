@@ -865,8 +865,8 @@ namespace AdaptiveCards::Rendering::Uwp::XamlHelpers
         bitmapImage.CreateOptions(winrt::BitmapCreateOptions::IgnoreImageCache);
 
         // Decode base 64 string
-        std::string data = AdaptiveBase64Util::ExtractDataFromUri(HStringToUTF8(imageUrl.Path()));
-        std::vector<char> decodedData = AdaptiveBase64Util::Decode(data);
+        const std::string dataUri = HStringToUTF8(imageUrl.Path());
+        std::vector<char> decodedData = AdaptiveBase64Util::Decode(AdaptiveBase64Util::GetDataFromUri(dataUri));
 
         winrt::DataWriter dataWriter{winrt::InMemoryRandomAccessStream{}};
 